@@ -0,0 +1,114 @@
+#ifndef MPM_ARENA_H_
+#define MPM_ARENA_H_
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace mpm {
+
+//! Arena
+//! \brief Monotonic arena which places objects in large contiguous slabs and
+//! releases all of them at once when it is destroyed
+//! \details Memory of a deallocated object isn't reused. Allocation is
+//! thread safe.
+class Arena {
+ public:
+  //! Construct an arena with the size of a slab
+  //! \param[in] slab_size Size of a slab in bytes
+  explicit Arena(std::size_t slab_size = 1 << 20);
+
+  //! Delete copy constructor
+  Arena(const Arena&) = delete;
+
+  //! Delete assignment operator
+  Arena& operator=(const Arena&) = delete;
+
+  //! Allocate memory in the current slab, or in a new slab if it is full
+  //! \param[in] bytes Number of bytes
+  //! \param[in] alignment Alignment, which is a power of two
+  //! \retval ptr Pointer to the memory
+  void* allocate(std::size_t bytes, std::size_t alignment);
+
+  //! Return the number of bytes allocated to objects
+  std::size_t allocated() const;
+
+  //! Return the number of bytes reserved in slabs
+  std::size_t reserved() const;
+
+  //! Return the number of slabs
+  std::size_t nslabs() const;
+
+ private:
+  //! Size of a slab
+  std::size_t slab_size_;
+  //! Slabs
+  std::vector<std::unique_ptr<char[]>> slabs_;
+  //! Free memory of the current slab
+  char* current_{nullptr};
+  //! Number of free bytes of the current slab
+  std::size_t remaining_{0};
+  //! Number of bytes allocated to objects
+  std::size_t allocated_{0};
+  //! Number of bytes reserved in slabs
+  std::size_t reserved_{0};
+  //! Mutex of allocation
+  mutable std::mutex mutex_;
+};
+
+//! Arena allocator
+//! \brief Standard allocator of objects in an arena, e.g. for
+//! std::allocate_shared
+//! \details The allocator shares ownership of the arena, so the arena
+//! outlives every object allocated in it. Deallocation is a no-op.
+//! \tparam T Type of object
+template <typename T>
+class ArenaAllocator {
+ public:
+  //! Type of object
+  using value_type = T;
+
+  //! Construct an allocator in an arena
+  //! \param[in] arena Arena
+  explicit ArenaAllocator(std::shared_ptr<Arena> arena)
+      : arena_{std::move(arena)} {}
+
+  //! Construct an allocator of another type in the same arena
+  //! \param[in] allocator Allocator of another type
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& allocator)
+      : arena_{allocator.arena()} {}
+
+  //! Allocate memory of objects
+  //! \param[in] n Number of objects
+  T* allocate(std::size_t n) {
+    return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  //! Memory is released with the arena
+  void deallocate(T*, std::size_t) {}
+
+  //! Return the arena
+  const std::shared_ptr<Arena>& arena() const { return arena_; }
+
+ private:
+  //! Arena
+  std::shared_ptr<Arena> arena_;
+};
+
+//! Allocators are equal if they allocate in the same arena
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) {
+  return lhs.arena() == rhs.arena();
+}
+
+//! Allocators are different if they allocate in different arenas
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) {
+  return !(lhs == rhs);
+}
+
+}  // namespace mpm
+
+#endif  // MPM_ARENA_H_
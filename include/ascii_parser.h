@@ -0,0 +1,53 @@
+#ifndef MPM_ASCII_PARSER_H_
+#define MPM_ASCII_PARSER_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace mpm {
+
+//! Global index type
+using Index = unsigned long long;
+
+//! Allocation-free parsing of ASCII input in memory, e.g. a mapped file
+namespace ascii {
+
+//! A line of ASCII text without its line break
+struct Line {
+  //! First character
+  const char* begin;
+  //! One past the last character
+  const char* end;
+};
+
+//! Check if a line has data, i.e., it isn't blank and isn't a comment line
+//! with a '#' or '!'
+//! \param[in] line Line of text
+bool is_data_line(const Line& line);
+
+//! Split text into data lines, skipping blank and comment lines
+//! \details Text is split into line-aligned chunks, which are scanned in
+//! parallel and concatenated in order
+//! \param[in] data Text
+//! \param[in] size Size of the text in bytes
+//! \retval lines Data lines in order
+std::vector<Line> data_lines(const char* data, std::size_t size);
+
+//! Parse the next number of a line as a double
+//! \param[in,out] current Position in the line, advanced past the number
+//! \param[in] end End of the line
+//! \param[out] value Parsed number
+//! \retval status False if the line has no further number
+bool parse_double(const char*& current, const char* end, double& value);
+
+//! Parse the next number of a line as an unsigned index
+//! \param[in,out] current Position in the line, advanced past the number
+//! \param[in] end End of the line
+//! \param[out] value Parsed number
+//! \retval status False if the line has no further index
+bool parse_index(const char*& current, const char* end, mpm::Index& value);
+
+}  // namespace ascii
+}  // namespace mpm
+
+#endif  // MPM_ASCII_PARSER_H_
@@ -0,0 +1,96 @@
+#ifndef MPM_BINARY_MESH_H_
+#define MPM_BINARY_MESH_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mapped_file.h"
+
+namespace mpm {
+
+//! Header of a binary mesh input file
+//! \details The header is followed by the sections of points (npoints x
+//! dimension doubles), cells (ncells x nodes_per_cell node ids) and velocity
+//! constraints (nconstraints records), all of which may be empty. A mesh file
+//! has nodes as points and cells, a particles file has particles as points.
+struct BinaryMeshHeader {
+  //! File signature
+  char signature[8];
+  //! Format version
+  uint32_t version;
+  //! Dimension
+  uint32_t dimension;
+  //! Number of points, i.e., nodes or particles
+  uint64_t npoints;
+  //! Number of cells
+  uint64_t ncells;
+  //! Number of nodes of each cell
+  uint64_t nodes_per_cell;
+  //! Number of velocity constraints
+  uint64_t nconstraints;
+};
+
+//! Velocity constraint in a binary mesh input file
+struct BinaryConstraint {
+  //! Node id
+  uint64_t id;
+  //! Direction
+  uint64_t direction;
+  //! Velocity
+  double velocity;
+};
+
+//! Write a binary mesh input file
+//! \param[in] filename Name of the binary file
+//! \param[in] dimension Dimension
+//! \param[in] points Coordinates of points, dimension values per point
+//! \param[in] nodes_per_cell Number of nodes of each cell
+//! \param[in] cells Node ids of cells, nodes_per_cell values per cell
+//! \param[in] constraints Velocity constraints
+//! \retval status Status of writing the file
+bool write_binary_mesh(const std::string& filename, unsigned dimension,
+                       const std::vector<double>& points,
+                       uint64_t nodes_per_cell,
+                       const std::vector<uint64_t>& cells,
+                       const std::vector<BinaryConstraint>& constraints);
+
+//! Memory-mapped binary mesh input file
+//! \brief Maps a binary mesh file read-only, sections are accessed in place
+class MappedBinaryMesh {
+ public:
+  //! Map a binary mesh file, throws if the file is missing or invalid
+  //! \param[in] filename Name of the binary file
+  explicit MappedBinaryMesh(const std::string& filename);
+
+  //! Return header
+  const BinaryMeshHeader& header() const {
+    return *reinterpret_cast<const BinaryMeshHeader*>(file_.data());
+  }
+
+  //! Return coordinates of points
+  const double* points() const {
+    return reinterpret_cast<const double*>(file_.data() +
+                                           sizeof(BinaryMeshHeader));
+  }
+
+  //! Return node ids of cells
+  const uint64_t* cells() const {
+    return reinterpret_cast<const uint64_t*>(
+        this->points() + this->header().npoints * this->header().dimension);
+  }
+
+  //! Return velocity constraints
+  const BinaryConstraint* constraints() const {
+    return reinterpret_cast<const BinaryConstraint*>(
+        this->cells() + this->header().ncells * this->header().nodes_per_cell);
+  }
+
+ private:
+  //! Mapped file
+  MappedFile file_;
+};
+
+}  // namespace mpm
+
+#endif  // MPM_BINARY_MESH_H_
@@ -1,6 +1,7 @@
 #ifndef MPM_CELL_H_
 #define MPM_CELL_H_
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <vector>
@@ -13,6 +14,7 @@
 #include "logger.h"
 #include "map.h"
 #include "node_base.h"
+#include "step_errors.h"
 
 namespace mpm {
 
@@ -29,7 +31,10 @@ class Cell {
   using VectorDim = Eigen::Matrix<double, Tdim, 1>;
 
   //! Define DOF for stresses
-  static const unsigned Tdof = (Tdim == 2) ? 3 : 6;
+  static const unsigned Tdof = (Tdim == 1) ? 1 : (Tdim == 2) ? 3 : 6;
+
+  //! Define a vector of stress / strain components
+  using VectorStrain = Eigen::Matrix<double, Tdof, 1>;
 
   //! Constructor with id, number of nodes and elemetn
   //! \param[in] id Global cell id
@@ -66,11 +71,19 @@ class Cell {
   //! Number of nodes
   unsigned nnodes() const { return nodes_.size(); }
 
+  //! Return a node of the cell
+  //! \param[in] local_id local id of the node
+  std::shared_ptr<NodeBase<Tdim>> node(unsigned local_id) const {
+    return nodes_[local_id];
+  }
+
   //! Activate nodes if particle is present
   bool activate_nodes();
 
   //! Return a pointer to element type of a cell
-  std::shared_ptr<const Element<Tdim>> element_ptr() { return element_; }
+  const std::shared_ptr<const Element<Tdim>>& element_ptr() const {
+    return element_;
+  }
 
   //! Return the number of shape functions, returns zero if the element type is
   //! not set.
@@ -94,6 +107,10 @@ class Cell {
   //! Number of neighbours
   unsigned nneighbours() const { return neighbour_cells_.size(); }
 
+  //! Return the memory footprint of the cell in bytes, including the memory
+  //! it owns on the heap
+  std::size_t footprint() const;
+
   //! Add an id of a particle in the cell
   //! \param[in] id Global id of a particle
   //! \retval status Return the successful addition of a particle id
@@ -121,8 +138,8 @@ class Cell {
   //! Return the mean_length
   double mean_length() const { return mean_length_; }
 
-  //! Return nodal coordinates
-  Eigen::MatrixXd nodal_coordinates();
+  //! Return nodal coordinates, which are stored on initialisation
+  const Eigen::MatrixXd& nodal_coordinates();
 
   //! Check if a point is in a cell
   //! Cell is broken into sub-triangles with point as one of the
@@ -170,46 +187,56 @@ class Cell {
   //! \param[in] pmass Mass of a particle
   //! \param[in] pvelocity velocity of a particle
   void compute_nodal_momentum(const Eigen::VectorXd& shapefn, unsigned phase,
-                              double pmass, const Eigen::VectorXd& pvelocity);
+                              double pmass, const VectorDim& pvelocity);
 
   //! Map particle mass and momentum to nodes for a phase
   //! \param[in] shapefn Shapefns at local coordinates of particle
   //! \param[in] phase Phase associate to the particle
   //! \param[in] pmass mass of a particle
   //! \param[in] velocity velocity of a particle
+  template <typename Tnode = NodeBase<Tdim>>
   void map_mass_momentum_to_nodes(const Eigen::VectorXd& shapefn,
                                   unsigned phase, double pmass,
-                                  const Eigen::VectorXd& pvelocity);
+                                  const VectorDim& pvelocity);
+
+  //! Return the largest speed of the nodes of the cell
+  //! \param[in] phase Phase associate to the particle
+  double max_nodal_speed(unsigned phase) const;
 
   //! Return velocity at given location by interpolating from nodes
   //! \param[in] shapefn Shapefns at local coordinates of particle
   //! \param[in] phase Phase associate to the particle
   //! \retval velocity Interpolated velocity at xi
-  Eigen::VectorXd interpolate_nodal_velocity(const Eigen::VectorXd& shapefn,
-                                             unsigned phase);
+  template <typename Tnode = NodeBase<Tdim>>
+  VectorDim interpolate_nodal_velocity(const Eigen::VectorXd& shapefn,
+                                       unsigned phase);
 
   //! Return acceleration at given location by interpolating from nodes
   //! \param[in] shapefn Shapefns at local coordinates of particle
   //! \param[in] phase Phase associate to the particle
   //! \retval acceleration Interpolated acceleration at xi
-  Eigen::VectorXd interpolate_nodal_acceleration(const Eigen::VectorXd& shapefn,
-                                                 unsigned phase);
+  template <typename Tnode = NodeBase<Tdim>>
+  VectorDim interpolate_nodal_acceleration(const Eigen::VectorXd& shapefn,
+                                           unsigned phase);
 
   //! Compute strain rate
   //! \param[in] bmatrix Bmatrix corresponding to local coordinates of particle
   //! \param[in] phase Phase associate to the particle
-  Eigen::VectorXd compute_strain_rate(
-      const std::vector<Eigen::MatrixXd>& bmatrix, unsigned phase);
+  template <typename Tnode = NodeBase<Tdim>>
+  VectorStrain compute_strain_rate(const std::vector<Eigen::MatrixXd>& bmatrix,
+                                   unsigned phase);
 
   //! Compute strain rate for reduced integration at the centroid of cell
   //! \param[in] phase Phase associate to the particle
-  Eigen::VectorXd compute_strain_rate_centroid(unsigned phase);
+  template <typename Tnode = NodeBase<Tdim>>
+  VectorStrain compute_strain_rate_centroid(unsigned phase);
 
   //! Compute the nodal body force of a cell from particle mass and gravity
   //! \param[in] shapefn Shapefns at local coordinates of particle
   //! \param[in] phase Phase associate to the particle
   //! \param[in] pmass Mass of a particle
   //! \param[in] pgravity Gravity of a particle
+  template <typename Tnode = NodeBase<Tdim>>
   void compute_nodal_body_force(const Eigen::VectorXd& shapefn, unsigned phase,
                                 double pmass, const VectorDim& pgravity);
 
@@ -218,6 +245,7 @@ class Cell {
   //! \param[in] phase Phase associate to the particle
   //! \param[in] pvolume Volume of particle
   //! \param[in] pstress Stress of particle
+  template <typename Tnode = NodeBase<Tdim>>
   void compute_nodal_internal_force(const std::vector<Eigen::MatrixXd>& bmatrix,
                                     unsigned phase, double pvolume,
                                     const Eigen::Matrix<double, 6, 1>& pstress);
@@ -238,6 +266,12 @@ class Cell {
   //! mean_length of cell
   double mean_length_{std::numeric_limits<double>::max()};
 
+  //! Nodal coordinates
+  Eigen::MatrixXd nodal_coordinates_;
+
+  //! B-matrix at the centroid
+  std::vector<Eigen::MatrixXd> bmatrix_centroid_;
+
   //! particles ids in cell
   std::vector<Index> particles_;
 
@@ -250,7 +284,7 @@ class Cell {
   //! Shape function
   std::shared_ptr<const Element<Tdim>> element_{nullptr};
   //! Logger
-  std::unique_ptr<spdlog::logger> console_;
+  std::shared_ptr<spdlog::logger> console_;
 };  // Cell class
 }  // namespace mpm
 
@@ -7,9 +7,11 @@ mpm::Cell<Tdim>::Cell(Index id, unsigned nnodes,
   static_assert((Tdim >= 1 && Tdim <= 3), "Invalid global dimension");
 
   //! Logger
-  std::string logger =
-      "cell" + std::to_string(Tdim) + "d::" + std::to_string(id);
-  console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
+  console_ =
+      mpm::Logger::entity_logger("cell" + std::to_string(Tdim) + "d", id);
+
+  // Nodal coordinates are assigned on initialisation
+  nodal_coordinates_.setZero(nnodes_, Tdim);
 
   try {
     if (elementptr->nfunctions() == this->nnodes_) {
@@ -34,6 +36,13 @@ bool mpm::Cell<Tdim>::initialise() {
       this->compute_volume();
       this->compute_centroid();
       this->compute_mean_length();
+
+      // Store nodal coordinates and the B-matrix at the centroid, as the
+      // background mesh doesn't deform
+      for (unsigned i = 0; i < nodes_.size(); ++i)
+        nodal_coordinates_.row(i) = nodes_[i]->coordinates().transpose();
+      element_->evaluate_bmatrix(VectorDim::Zero(), nodal_coordinates_,
+                                 bmatrix_centroid_);
       status = true;
     } else {
       throw std::runtime_error(
@@ -86,21 +95,12 @@ bool mpm::Cell<Tdim>::add_node(
 //! Activate nodes if particle is present
 template <unsigned Tdim>
 bool mpm::Cell<Tdim>::activate_nodes() {
-  bool status = true;
-  try {
-    // If number of particles are present, set node status to active
-    if (particles_.size() > 0) {
-      // Activate all nodes
-      for (unsigned i = 0; i < nodes_.size(); ++i)
-        nodes_[i]->assign_status(true);
-    } else {
-      throw std::runtime_error("No particles in cell, can't activate nodes");
-    }
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
-  }
-  return status;
+  // An empty cell has no active nodes, which is not an error
+  if (particles_.empty()) return false;
+
+  // If number of particles are present, set node status to active
+  for (unsigned i = 0; i < nodes_.size(); ++i) nodes_[i]->assign_status(true);
+  return true;
 }
 
 //! Add a neighbour cell and return the status of addition of a node
@@ -289,23 +289,16 @@ void mpm::Cell<Tdim>::compute_mean_length() {
 
 //! Return nodal coordinates
 template <unsigned Tdim>
-Eigen::MatrixXd mpm::Cell<Tdim>::nodal_coordinates() {
-  Eigen::MatrixXd coordinates;
-  coordinates.resize(this->nnodes_, Tdim);
-  coordinates.setZero();
+const Eigen::MatrixXd& mpm::Cell<Tdim>::nodal_coordinates() {
   try {
-    // If cell is initialised
-    if (this->is_initialised()) {
-      for (unsigned i = 0; i < nodes_.size(); ++i)
-        coordinates.row(i) = nodes_[i]->coordinates().transpose();
-    } else {
+    // If cell is not initialised, nodal coordinates are zero
+    if (!this->is_initialised())
       throw std::runtime_error(
           "Cell is not initialised to return nodal coordinates!");
-    }
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
   }
-  return coordinates;
+  return nodal_coordinates_;
 }
 
 //! Check if a point is in a 1D cell by breaking the cell into sub-volumes
@@ -611,22 +604,11 @@ inline Eigen::Matrix<double, 2, 1> mpm::Cell<2>::transform_real_to_unit_cell(
   // Tolerance for newton raphson
   const double tolerance = 1.e-10;
 
-  // Get indices of corner nodes
-  Eigen::VectorXi indices = element_->corner_indices();
-
-  // Matrix of nodal coordinates
-  Eigen::MatrixXd nodal_coords;
-  nodal_coords.resize(2, indices.size());
-
-  for (unsigned j = 0; j < indices.size(); ++j) {
-    Eigen::Matrix<double, 2, 1> node = nodes_[indices(j)]->coordinates();
-    for (unsigned i = 0; i < 2; ++i) {
-      nodal_coords(i, j) = node[i];
-    }
-  }
-
-  // Coordinates of a unit cell
-  const auto unit_cell = element_->unit_cell_coordinates();
+  // Matrix of nodal coordinates of the corner nodes, which are the first
+  // 4 nodes of the cell
+  Eigen::Matrix<double, 2, 4> nodal_coords;
+  for (unsigned j = 0; j < 4; ++j)
+    nodal_coords.col(j) = nodes_[j]->coordinates();
 
   // Affine transformation, using linear interpolation for the initial guess
   if (element_->degree() == mpm::ElementDegree::Linear) {
@@ -650,7 +632,8 @@ inline Eigen::Matrix<double, 2, 1> mpm::Cell<2>::transform_real_to_unit_cell(
     if (!guess_nan) xi = affine_guess;
 
     // Shape function
-    const auto sf = element_->shapefn(xi);
+    Eigen::Matrix<double, 4, 1> sf;
+    element_->evaluate_shapefn(xi, sf);
 
     // f(x) = p(x) - p, where p is the real point
     Eigen::Matrix<double, 2, 1> fx = (nodal_coords * sf) - point;
@@ -660,6 +643,9 @@ inline Eigen::Matrix<double, 2, 1> mpm::Cell<2>::transform_real_to_unit_cell(
       return xi;
   }
 
+  // Coordinates of a unit cell
+  const auto unit_cell = element_->unit_cell_coordinates();
+
   // Newton Raphson iteration to solve for x
   // x_{n+1} = x_n - f(x)/f'(x)
   // f(x) = p(x) - p, where p is the real point
@@ -699,22 +685,11 @@ inline Eigen::Matrix<double, 3, 1> mpm::Cell<3>::transform_real_to_unit_cell(
   // Tolerance for newton raphson
   const double tolerance = 1.e-11;
 
-  // Get indices of corner nodes
-  Eigen::VectorXi indices = element_->corner_indices();
-
-  // Matrix of nodal coordinates
-  Eigen::MatrixXd nodal_coords;
-  nodal_coords.resize(3, indices.size());
-
-  for (unsigned j = 0; j < indices.size(); ++j) {
-    Eigen::Matrix<double, 3, 1> node = nodes_[indices(j)]->coordinates();
-    for (unsigned i = 0; i < 3; ++i) {
-      nodal_coords(i, j) = node[i];
-    }
-  }
-
-  // Coordinates of a unit cell
-  const auto unit_cell = element_->unit_cell_coordinates();
+  // Matrix of nodal coordinates of the corner nodes, which are the first
+  // 8 nodes of the cell
+  Eigen::Matrix<double, 3, 8> nodal_coords;
+  for (unsigned j = 0; j < 8; ++j)
+    nodal_coords.col(j) = nodes_[j]->coordinates();
 
   // Affine transformation, using linear interpolation for the initial guess
   if (element_->degree() == mpm::ElementDegree::Linear) {
@@ -738,7 +713,8 @@ inline Eigen::Matrix<double, 3, 1> mpm::Cell<3>::transform_real_to_unit_cell(
     if (!guess_nan) xi = affine_guess;
 
     // Shape function
-    const auto sf = element_->shapefn(xi);
+    Eigen::Matrix<double, 8, 1> sf;
+    element_->evaluate_shapefn(xi, sf);
 
     // f(x) = p(x) - p, where p is the real point
     Eigen::Matrix<double, 3, 1> fx = (nodal_coords * sf) - point;
@@ -748,6 +724,9 @@ inline Eigen::Matrix<double, 3, 1> mpm::Cell<3>::transform_real_to_unit_cell(
       return xi;
   }
 
+  // Coordinates of a unit cell
+  const auto unit_cell = element_->unit_cell_coordinates();
+
   // Newton Raphson iteration to solve for x
   // x_{n+1} = x_n - f(x)/f'(x)
   // f(x) = p(x) - p, where p is the real point
@@ -793,13 +772,16 @@ void mpm::Cell<Tdim>::map_particle_volume_to_nodes(
 
 //! Map particle mass and momentum to nodes for a given phase
 template <unsigned Tdim>
+template <typename Tnode>
 void mpm::Cell<Tdim>::map_mass_momentum_to_nodes(
     const Eigen::VectorXd& shapefn, unsigned phase, double pmass,
-    const Eigen::VectorXd& pvelocity) {
+    const VectorDim& pvelocity) {
 
   for (unsigned i = 0; i < this->nfunctions(); ++i) {
-    nodes_[i]->update_mass(true, phase, shapefn(i) * pmass);
-    nodes_[i]->update_momentum(true, phase, shapefn(i) * pmass * pvelocity);
+    const VectorDim momentum = shapefn(i) * pmass * pvelocity;
+    const auto node = static_cast<Tnode*>(nodes_[i].get());
+    node->update_mass(true, phase, shapefn(i) * pmass);
+    node->update_momentum(true, phase, momentum);
   }
 }
 
@@ -807,73 +789,52 @@ void mpm::Cell<Tdim>::map_mass_momentum_to_nodes(
 template <unsigned Tdim>
 void mpm::Cell<Tdim>::compute_nodal_momentum(const Eigen::VectorXd& shapefn,
                                              unsigned phase, double pmass,
-                                             const Eigen::VectorXd& pvelocity) {
+                                             const VectorDim& pvelocity) {
 
-  for (unsigned i = 0; i < this->nfunctions(); ++i)
-    nodes_[i]->update_momentum(true, phase, shapefn(i) * pmass * pvelocity);
+  for (unsigned i = 0; i < this->nfunctions(); ++i) {
+    const VectorDim momentum = shapefn(i) * pmass * pvelocity;
+    nodes_[i]->update_momentum(true, phase, momentum);
+  }
 }
 
 //! Compute strain rate
 template <unsigned Tdim>
-Eigen::VectorXd mpm::Cell<Tdim>::compute_strain_rate(
+template <typename Tnode>
+typename mpm::Cell<Tdim>::VectorStrain mpm::Cell<Tdim>::compute_strain_rate(
     const std::vector<Eigen::MatrixXd>& bmatrix, unsigned phase) {
   // Define strain rate
-  Eigen::VectorXd strain_rate;
+  VectorStrain strain_rate = VectorStrain::Zero();
 
-  switch (Tdim) {
-    case (1): {
-      strain_rate.resize(1);
-      break;
-    }
-    case (2): {
-      strain_rate.resize(3);
-      break;
-    }
-    default: {
-      strain_rate.resize(6);
-      break;
-    }
+  // Check if B-Matrix size and number of nodes match
+  if (this->nfunctions() != bmatrix.size() ||
+      this->nnodes() != bmatrix.size()) {
+    mpm::StepErrors::current().record(mpm::StepError::DegreesOfFreedom);
+    return strain_rate;
   }
 
-  strain_rate.setZero();
-
-  try {
-    // Check if B-Matrix size and number of nodes match
-    if (this->nfunctions() != bmatrix.size() ||
-        this->nnodes() != bmatrix.size())
-      throw std::runtime_error(
-          "Number of nodes / shapefn doesn't match BMatrix");
-
-    for (unsigned i = 0; i < this->nnodes(); ++i) {
-      Eigen::Matrix<double, Tdim, 1> node_velocity = nodes_[i]->velocity(phase);
-      strain_rate += bmatrix.at(i) * node_velocity;
-    }
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+  for (unsigned i = 0; i < this->nnodes(); ++i) {
+    const VectorDim node_velocity =
+        static_cast<Tnode*>(nodes_[i].get())->velocity(phase);
+    strain_rate.noalias() += bmatrix[i] * node_velocity;
   }
   return strain_rate;
 }
 
 //! Compute strain rate for reduced integration at the centroid of cell
 template <unsigned Tdim>
-Eigen::VectorXd mpm::Cell<Tdim>::compute_strain_rate_centroid(unsigned phase) {
-  // Get centroid of a cell in natural coordinates which are zeros
-  Eigen::Matrix<double, Tdim, 1> xi_centroid;
-  xi_centroid.setZero();
-
-  // Get B-Matrix at the centroid
-  auto bmatrix = element_->bmatrix(xi_centroid, this->nodal_coordinates());
-
+template <typename Tnode>
+typename mpm::Cell<Tdim>::VectorStrain
+    mpm::Cell<Tdim>::compute_strain_rate_centroid(unsigned phase) {
   // Define strain rate at centroid
-  Eigen::VectorXd strain_rate_centroid;
-  strain_rate_centroid.resize(bmatrix.at(0).rows());
-  strain_rate_centroid.setZero();
+  VectorStrain strain_rate_centroid = VectorStrain::Zero();
 
-  // Compute strain rate
-  for (unsigned i = 0; i < bmatrix.size(); ++i) {
+  // Compute strain rate from the B-matrix at the centroid, which is
+  // evaluated once on initialisation
+  for (unsigned i = 0; i < bmatrix_centroid_.size(); ++i) {
     for (unsigned i = 0; i < this->nnodes(); ++i) {
-      Eigen::Matrix<double, Tdim, 1> node_velocity = nodes_[i]->velocity(phase);
-      strain_rate_centroid += bmatrix.at(i) * node_velocity;
+      const VectorDim node_velocity =
+          static_cast<Tnode*>(nodes_[i].get())->velocity(phase);
+      strain_rate_centroid.noalias() += bmatrix_centroid_[i] * node_velocity;
     }
   }
   return strain_rate_centroid;
@@ -881,71 +842,98 @@ Eigen::VectorXd mpm::Cell<Tdim>::compute_strain_rate_centroid(unsigned phase) {
 
 //! Compute the nodal body force of a cell from particle mass and gravity
 template <unsigned Tdim>
+template <typename Tnode>
 void mpm::Cell<Tdim>::compute_nodal_body_force(const Eigen::VectorXd& shapefn,
                                                unsigned phase, double pmass,
                                                const VectorDim& pgravity) {
   // Map external forces from particle to nodes
-  for (unsigned i = 0; i < this->nfunctions(); ++i)
-    nodes_[i]->update_external_force(true, phase,
-                                     (shapefn(i) * pgravity * pmass));
+  for (unsigned i = 0; i < this->nfunctions(); ++i) {
+    const VectorDim force = shapefn(i) * pgravity * pmass;
+    static_cast<Tnode*>(nodes_[i].get())
+        ->update_external_force(true, phase, force);
+  }
 }
 
 //! Compute the nodal internal force  of a cell from particle stress and
 //! volume
 template <unsigned Tdim>
+template <typename Tnode>
 inline void mpm::Cell<Tdim>::compute_nodal_internal_force(
     const std::vector<Eigen::MatrixXd>& bmatrix, unsigned phase, double pvolume,
     const Eigen::Matrix<double, 6, 1>& pstress) {
-  // Define strain rate
-  Eigen::VectorXd stress;
+  // Define stress
+  VectorStrain stress;
 
   switch (Tdim) {
     case (1): {
-      stress.resize(1);
-      stress.setZero();
       stress(0) = pstress(0);
       break;
     }
     case (2): {
-      stress.resize(3);
-      stress.setZero();
       stress(0) = pstress(0);
       stress(1) = pstress(1);
       stress(2) = pstress(3);
       break;
     }
     default: {
-      stress.resize(6);
-      stress = pstress;
+      for (unsigned i = 0; i < stress.size(); ++i) stress(i) = pstress(i);
       break;
     }
   }
   // Map internal forces from particle to nodes
-  for (unsigned j = 0; j < this->nfunctions(); ++j)
-    nodes_[j]->update_internal_force(
-        true, phase, (pvolume * bmatrix.at(j).transpose() * stress));
+  for (unsigned j = 0; j < this->nfunctions(); ++j) {
+    VectorDim force;
+    force.noalias() = pvolume * bmatrix[j].transpose() * stress;
+    static_cast<Tnode*>(nodes_[j].get())
+        ->update_internal_force(true, phase, force);
+  }
+}
+
+//! Return the largest speed of the nodes of the cell
+template <unsigned Tdim>
+double mpm::Cell<Tdim>::max_nodal_speed(unsigned phase) const {
+  double speed = 0.;
+  for (const auto& node : nodes_)
+    speed = std::max(speed, node.second->velocity(phase).norm());
+  return speed;
 }
 
 //! Return velocity at a given point by interpolating from nodes
 template <unsigned Tdim>
-Eigen::VectorXd mpm::Cell<Tdim>::interpolate_nodal_velocity(
+template <typename Tnode>
+typename mpm::Cell<Tdim>::VectorDim mpm::Cell<Tdim>::interpolate_nodal_velocity(
     const Eigen::VectorXd& shapefn, unsigned phase) {
-  Eigen::Matrix<double, Tdim, 1> velocity =
-      Eigen::Matrix<double, Tdim, 1>::Zero();
+  VectorDim velocity = VectorDim::Zero();
   for (unsigned i = 0; i < this->nfunctions(); ++i)
-    velocity += shapefn(i) * nodes_[i]->velocity(phase);
+    velocity +=
+        shapefn(i) * static_cast<Tnode*>(nodes_[i].get())->velocity(phase);
 
   return velocity;
 }
 
 //! Return acceleration at a point by interpolating from nodes
 template <unsigned Tdim>
-Eigen::VectorXd mpm::Cell<Tdim>::interpolate_nodal_acceleration(
-    const Eigen::VectorXd& shapefn, unsigned phase) {
-  Eigen::Matrix<double, Tdim, 1> acceleration =
-      Eigen::Matrix<double, Tdim, 1>::Zero();
+template <typename Tnode>
+typename mpm::Cell<Tdim>::VectorDim
+    mpm::Cell<Tdim>::interpolate_nodal_acceleration(
+        const Eigen::VectorXd& shapefn, unsigned phase) {
+  VectorDim acceleration = VectorDim::Zero();
   for (unsigned i = 0; i < this->nfunctions(); ++i)
-    acceleration += shapefn(i) * nodes_[i]->acceleration(phase);
+    acceleration += shapefn(i) *
+                    static_cast<Tnode*>(nodes_[i].get())->acceleration(phase);
 
   return acceleration;
 }
+
+//! Return the memory footprint of the cell in bytes
+template <unsigned Tdim>
+std::size_t mpm::Cell<Tdim>::footprint() const {
+  std::size_t bytes = sizeof(*this) +
+                      nodal_coordinates_.size() * sizeof(double) +
+                      bmatrix_centroid_.capacity() * sizeof(Eigen::MatrixXd) +
+                      particles_.capacity() * sizeof(Index) +
+                      nodes_.footprint() + neighbour_cells_.footprint();
+  for (const auto& bmatrix : bmatrix_centroid_)
+    bytes += bmatrix.size() * sizeof(double);
+  return bytes + mpm::Logger::footprint(console_);
+}
@@ -0,0 +1,119 @@
+#ifndef MPM_CHECKPOINT_H_
+#define MPM_CHECKPOINT_H_
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "mapped_file.h"
+
+namespace mpm {
+
+//! Global index type for the particle
+using Index = unsigned long long;
+
+//! Header of a binary checkpoint file
+struct CheckpointHeader {
+  //! File signature
+  char signature[8];
+  //! Format version
+  uint32_t version;
+  //! Dimension of the analysis
+  uint32_t dimension;
+  //! Number of particles
+  uint64_t nparticles;
+  //! Analysis step
+  uint64_t step;
+  //! Simulation time
+  double time;
+};
+
+//! Complete state of a particle in a binary checkpoint file
+//! \details Besides the kinematic and stress state the particle stores its
+//! cell id, reference location and material id, which avoids a global search
+//! to relocate the particle when restoring a checkpoint
+struct CheckpointParticle {
+  // Index
+  mpm::Index id;
+  // Cell id
+  mpm::Index cell_id;
+  // Material id
+  uint32_t material_id;
+  // Status
+  uint32_t status;
+  // Coordinates
+  double coordinates[3];
+  // Reference location in the cell
+  double xi[3];
+  // Mass
+  double mass;
+  // Volume
+  double volume;
+  // Velocity
+  double velocity[3];
+  // Stresses
+  double stress[6];
+  // Strains
+  double strain[6];
+  // Strain rate
+  double strain_rate[6];
+  // Strain increment
+  double dstrain[6];
+  // Volumetric strain centroid
+  double volumetric_strain;
+};
+
+//! Undefined cell or material id in a checkpoint
+const mpm::Index CheckpointUndefinedCell = std::numeric_limits<Index>::max();
+const uint32_t CheckpointUndefinedMaterial =
+    std::numeric_limits<uint32_t>::max();
+
+//! Create a header of a binary checkpoint file
+//! \param[in] dimension Dimension of the analysis
+//! \param[in] nparticles Number of particles
+//! \param[in] step Analysis step
+//! \param[in] time Simulation time
+CheckpointHeader checkpoint_header(unsigned dimension, mpm::Index nparticles,
+                                   mpm::Index step, double time);
+
+//! Write a binary checkpoint file, particles are written in parallel to a
+//! temporary file, which replaces the checkpoint once it is complete
+//! \param[in] filename Name of the checkpoint file
+//! \param[in] header Header of the checkpoint
+//! \param[in] particles State of particles
+//! \retval status Status of writing the checkpoint
+bool write_checkpoint(const std::string& filename,
+                      const CheckpointHeader& header,
+                      const std::vector<CheckpointParticle>& particles);
+
+//! Memory-mapped binary checkpoint file
+//! \brief Maps a checkpoint read-only, the particles are accessed in place
+class MappedCheckpoint {
+ public:
+  //! Map a checkpoint file, throws if the file is missing or invalid
+  //! \param[in] filename Name of the checkpoint file
+  explicit MappedCheckpoint(const std::string& filename);
+
+  //! Return header of the checkpoint
+  const CheckpointHeader& header() const {
+    return *reinterpret_cast<const CheckpointHeader*>(file_.data());
+  }
+
+  //! Return state of particles
+  const CheckpointParticle* particles() const {
+    return reinterpret_cast<const CheckpointParticle*>(
+        file_.data() + sizeof(CheckpointHeader));
+  }
+
+  //! Return number of particles
+  mpm::Index nparticles() const { return this->header().nparticles; }
+
+ private:
+  //! Mapped file
+  MappedFile file_;
+};
+
+}  // namespace mpm
+
+#endif  // MPM_CHECKPOINT_H_
@@ -23,7 +23,9 @@ class Container {
 
   //! Add a pointer to an element
   //! \param[in] ptr A shared pointer
-  bool add(const std::shared_ptr<T>&);
+  //! \param[in] check_duplicates Search the container for an element with the
+  //! same id, which may be skipped if ids are known to be unique
+  bool add(const std::shared_ptr<T>&, bool check_duplicates = true);
 
   //! Remove an element pointer
   //! \param[in] ptr A shared pointer
@@ -35,6 +37,12 @@ class Container {
   //! Clear
   void clear() { elements_.clear(); }
 
+  //! Return element at a given position in the container
+  //! \param[in] i Position of the element
+  const std::shared_ptr<T>& operator[](std::size_t i) const {
+    return elements_[i];
+  }
+
   //! Return begin iterator of nodes
   typename tbb::concurrent_vector<std::shared_ptr<T>>::const_iterator cbegin()
       const {
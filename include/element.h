@@ -99,6 +99,21 @@ class Element {
       const VectorDim& particle_size,
       const VectorDim& deformation_gradient) const = 0;
 
+  //! Evaluate shape functions at given local coordinates into a buffer
+  //! \param[in] xi given local coordinates
+  //! \param[out] shapefn Shape functions, sized to the number of functions
+  virtual void evaluate_shapefn(const VectorDim& xi,
+                                Eigen::Ref<Eigen::VectorXd> shapefn) const = 0;
+
+  //! Evaluate the B matrix at given local coordinates for a real cell into a
+  //! buffer, which is only resized if its size doesn't match
+  //! \param[in] xi given local coordinates
+  //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
+  //! \param[out] bmatrix B matrix
+  virtual void evaluate_bmatrix(
+      const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+      std::vector<Eigen::MatrixXd>& bmatrix) const = 0;
+
   //! Evaluate the mass matrix
   //! \param[in] xi_s Vector of local coordinates
   //! \retval mass_matrix mass matrix
@@ -0,0 +1,162 @@
+#ifndef MPM_EXPLICIT_PIPELINE_H_
+#define MPM_EXPLICIT_PIPELINE_H_
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <tbb/flow_graph.h>
+
+#include "json.hpp"
+
+#include "particle.h"
+
+// JSON
+using Json = nlohmann::json;
+
+namespace mpm {
+
+//! Access of a stage to a state of the mesh, e.g. particles, nodes or cells
+enum class StageAccess {
+  //! Reads the state, which other stages may read concurrently
+  Read,
+  //! Accumulates into the state under a lock, which other stages may
+  //! accumulate into concurrently
+  Accumulate,
+  //! Writes the state, exclusively
+  Write
+};
+
+//! Explicit stage struct
+//! \brief A named operation of an explicit step over the mesh
+//! \details A stage which only iterates over particles lists its kernels,
+//! so it can be fused with neighbouring particle stages into a single loop.
+//! A stage which declares its access to the states of the mesh runs
+//! concurrently with the stages it doesn't conflict with, otherwise it
+//! waits for all stages before it.
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+struct ExplicitStage {
+  //! Kernel of a particle
+  using ParticleKernel =
+      std::function<void(const std::shared_ptr<ParticleBase<Tdim>>&)>;
+
+  //! Name of the stage, under which its wall time is accumulated
+  std::string name;
+  //! Run the stage over the mesh
+  std::function<void()> run;
+  //! Kernels run in order on each particle when the stage is fused, empty if
+  //! the stage can't be fused
+  std::vector<ParticleKernel> particle_kernels;
+  //! Access to states of the mesh by name, empty if undeclared
+  std::map<std::string, StageAccess> access;
+};
+
+//! Explicit pipeline class
+//! \brief Ordered stages of an explicit step, which may be reordered,
+//! skipped and fused
+//! \details Stages run in a TBB flow graph, in which a stage depends on the
+//! stages before it which it conflicts with, or in order if the graph is
+//! disabled
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+class ExplicitPipeline {
+ public:
+  //! Kernel of a particle
+  using ParticleKernel = typename ExplicitStage<Tdim>::ParticleKernel;
+  //! Iterate a kernel over all particles of the mesh
+  using ParticleIterator = std::function<void(const ParticleKernel&)>;
+  //! Called with the name and wall time in seconds of a stage when it's done
+  using StageDone = std::function<void(const std::string&, double)>;
+
+  //! Construct a pipeline of stages in the order of a scheme
+  //! \param[in] stages Stages which are available by name
+  //! \param[in] order Names of the stages of the scheme in order
+  //! \param[in] iterate Iterate a kernel over particles in fused stages
+  ExplicitPipeline(const std::map<std::string, ExplicitStage<Tdim>>& stages,
+                   const std::vector<std::string>& order,
+                   const ParticleIterator& iterate);
+
+  //! Delete copy constructor
+  ExplicitPipeline(const ExplicitPipeline&) = delete;
+
+  //! Delete assignement operator
+  ExplicitPipeline& operator=(const ExplicitPipeline&) = delete;
+
+  //! Configure the stages, e.g. {"order": ["initialise_nodes", ...],
+  //! "skip": ["locate"], "fuse": [["stress", "body_force"]], "graph": true},
+  //! which throws a std::domain_error if a stage is unknown or can't be fused
+  //! \param[in] config Stages of the analysis
+  void configure(const Json& config);
+
+  //! Return the names of the stages in order
+  std::vector<std::string> names() const;
+
+  //! Return the names of the stages a stage waits for in the flow graph
+  //! \param[in] name Name of the stage
+  std::vector<std::string> dependencies(const std::string& name) const;
+
+  //! Run the stages of a step
+  //! \param[in] done Called with the name and wall time of each stage when
+  //! it is done, which isn't called concurrently
+  void run(const StageDone& done);
+
+ private:
+  //! Node of a stage in the flow graph
+  using StageNode = tbb::flow::continue_node<tbb::flow::continue_msg>;
+
+  //! Return if a stage has to wait for an earlier stage
+  //! \param[in] before Earlier stage
+  //! \param[in] after Later stage
+  static bool conflict(const ExplicitStage<Tdim>& before,
+                       const ExplicitStage<Tdim>& after);
+
+  //! Build the flow graph of the stages
+  void build_graph();
+
+  //! Run a stage and report its wall time
+  //! \param[in] stage Stage
+  void run_stage(const ExplicitStage<Tdim>& stage);
+
+  //! Set the stages in an order
+  //! \param[in] order Names of the stages in order
+  void order(const std::vector<std::string>& order);
+
+  //! Remove a stage
+  //! \param[in] name Name of the stage
+  void skip(const std::string& name);
+
+  //! Fuse consecutive particle stages into a stage with a single loop
+  //! \param[in] names Names of the stages in order
+  void fuse(const std::vector<std::string>& names);
+
+  //! Stages which are available by name
+  std::map<std::string, ExplicitStage<Tdim>> available_;
+  //! Stages of a step in order
+  std::vector<ExplicitStage<Tdim>> stages_;
+  //! Iterate a kernel over particles
+  ParticleIterator iterate_;
+  //! Run stages in a flow graph
+  bool graph_enabled_{true};
+  //! Report of the stages of the running step
+  StageDone done_;
+  //! Mutex of the report of stages
+  std::mutex done_mutex_;
+  //! Flow graph of the stages, built on the first run
+  std::unique_ptr<tbb::flow::graph> graph_;
+  //! Start of a step in the flow graph
+  std::unique_ptr<tbb::flow::broadcast_node<tbb::flow::continue_msg>> start_;
+  //! Nodes of the stages in the flow graph
+  std::vector<std::unique_ptr<StageNode>> nodes_;
+};  // ExplicitPipeline class
+}  // namespace mpm
+
+#include "explicit_pipeline.tcc"
+
+#endif  // MPM_EXPLICIT_PIPELINE_H_
@@ -0,0 +1,198 @@
+//! Construct a pipeline of stages in the order of a scheme
+template <unsigned Tdim>
+mpm::ExplicitPipeline<Tdim>::ExplicitPipeline(
+    const std::map<std::string, ExplicitStage<Tdim>>& stages,
+    const std::vector<std::string>& order, const ParticleIterator& iterate)
+    : available_{stages}, iterate_{iterate} {
+  this->order(order);
+}
+
+//! Configure the stages
+template <unsigned Tdim>
+void mpm::ExplicitPipeline<Tdim>::configure(const Json& config) {
+  if (config.find("order") != config.end())
+    this->order(config.at("order").template get<std::vector<std::string>>());
+
+  if (config.find("skip") != config.end())
+    for (const auto& name :
+         config.at("skip").template get<std::vector<std::string>>())
+      this->skip(name);
+
+  if (config.find("fuse") != config.end()) {
+    const auto groups =
+        config.at("fuse").template get<std::vector<std::vector<std::string>>>();
+    for (const auto& names : groups) this->fuse(names);
+  }
+
+  if (config.find("graph") != config.end())
+    graph_enabled_ = config.at("graph").template get<bool>();
+  // Stages have changed
+  graph_.reset();
+}
+
+//! Return the names of the stages in order
+template <unsigned Tdim>
+std::vector<std::string> mpm::ExplicitPipeline<Tdim>::names() const {
+  std::vector<std::string> names;
+  for (const auto& stage : stages_) names.emplace_back(stage.name);
+  return names;
+}
+
+//! Return the names of the stages a stage waits for in the flow graph
+template <unsigned Tdim>
+std::vector<std::string> mpm::ExplicitPipeline<Tdim>::dependencies(
+    const std::string& name) const {
+  std::vector<std::string> names;
+  for (unsigned i = 0; i < stages_.size(); ++i) {
+    if (stages_[i].name != name) continue;
+    for (unsigned j = 0; j < i; ++j)
+      if (conflict(stages_[j], stages_[i])) names.emplace_back(stages_[j].name);
+    break;
+  }
+  return names;
+}
+
+//! Run the stages of a step
+template <unsigned Tdim>
+void mpm::ExplicitPipeline<Tdim>::run(const StageDone& done) {
+  done_ = done;
+  if (!graph_enabled_) {
+    for (const auto& stage : stages_) this->run_stage(stage);
+    return;
+  }
+
+  if (!graph_) this->build_graph();
+  start_->try_put(tbb::flow::continue_msg());
+  // Rethrows an exception of a stage
+  graph_->wait_for_all();
+}
+
+//! Return if a stage has to wait for an earlier stage
+template <unsigned Tdim>
+bool mpm::ExplicitPipeline<Tdim>::conflict(const ExplicitStage<Tdim>& before,
+                                           const ExplicitStage<Tdim>& after) {
+  // Stages with undeclared access wait for, and are waited for by, all stages
+  if (before.access.empty() || after.access.empty()) return true;
+
+  for (const auto& access : after.access) {
+    const auto itr = before.access.find(access.first);
+    if (itr == before.access.end()) continue;
+    // Reads and accumulations of a state don't conflict among themselves
+    if (itr->second == StageAccess::Write ||
+        access.second == StageAccess::Write || itr->second != access.second)
+      return true;
+  }
+  return false;
+}
+
+//! Build the flow graph of the stages
+template <unsigned Tdim>
+void mpm::ExplicitPipeline<Tdim>::build_graph() {
+  nodes_.clear();
+  start_.reset();
+  graph_ = std::make_unique<tbb::flow::graph>();
+  start_ = std::make_unique<tbb::flow::broadcast_node<tbb::flow::continue_msg>>(
+      *graph_);
+
+  for (unsigned i = 0; i < stages_.size(); ++i) {
+    nodes_.emplace_back(std::make_unique<StageNode>(
+        *graph_, [this, i](const tbb::flow::continue_msg&) {
+          this->run_stage(stages_[i]);
+        }));
+
+    // A stage waits for the earlier stages it conflicts with
+    bool root = true;
+    for (unsigned j = 0; j < i; ++j)
+      if (conflict(stages_[j], stages_[i])) {
+        tbb::flow::make_edge(*nodes_[j], *nodes_[i]);
+        root = false;
+      }
+    if (root) tbb::flow::make_edge(*start_, *nodes_[i]);
+  }
+}
+
+//! Run a stage and report its wall time
+template <unsigned Tdim>
+void mpm::ExplicitPipeline<Tdim>::run_stage(const ExplicitStage<Tdim>& stage) {
+  const auto start = std::chrono::steady_clock::now();
+  stage.run();
+  const double seconds = std::chrono::duration<double>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+  std::lock_guard<std::mutex> guard(done_mutex_);
+  done_(stage.name, seconds);
+}
+
+//! Set the stages in an order
+template <unsigned Tdim>
+void mpm::ExplicitPipeline<Tdim>::order(const std::vector<std::string>& order) {
+  stages_.clear();
+  for (const auto& name : order) {
+    const auto itr = available_.find(name);
+    if (itr == available_.end())
+      throw std::domain_error("Unknown stage of an explicit step: " + name);
+    stages_.emplace_back(itr->second);
+  }
+}
+
+//! Remove a stage
+template <unsigned Tdim>
+void mpm::ExplicitPipeline<Tdim>::skip(const std::string& name) {
+  const auto itr = std::find_if(
+      stages_.begin(), stages_.end(),
+      [&name](const ExplicitStage<Tdim>& stage) { return stage.name == name; });
+  if (itr == stages_.end())
+    throw std::domain_error("Skipped stage is not in the step: " + name);
+  stages_.erase(itr);
+}
+
+//! Fuse consecutive particle stages into a stage with a single loop
+template <unsigned Tdim>
+void mpm::ExplicitPipeline<Tdim>::fuse(const std::vector<std::string>& names) {
+  if (names.size() < 2)
+    throw std::domain_error("Fused stages need at least two stages");
+
+  const auto first =
+      std::find_if(stages_.begin(), stages_.end(),
+                   [&names](const ExplicitStage<Tdim>& stage) {
+                     return stage.name == names.front();
+                   });
+  if (first == stages_.end() ||
+      static_cast<std::size_t>(stages_.end() - first) < names.size())
+    throw std::domain_error("Fused stages are not consecutive stages");
+
+  ExplicitStage<Tdim> fused;
+  for (unsigned i = 0; i < names.size(); ++i) {
+    const auto& stage = *(first + i);
+    if (stage.name != names.at(i))
+      throw std::domain_error("Fused stages are not consecutive stages");
+    if (stage.particle_kernels.empty())
+      throw std::domain_error("Stage doesn't only iterate over particles: " +
+                              stage.name);
+    fused.name += (i == 0 ? "" : "+") + stage.name;
+    fused.particle_kernels.insert(fused.particle_kernels.end(),
+                                  stage.particle_kernels.begin(),
+                                  stage.particle_kernels.end());
+    // Access of the fused stage is the union of the access of its stages,
+    // which writes a state if its stages access it differently
+    for (const auto& access : stage.access) {
+      const auto itr = fused.access.find(access.first);
+      if (itr == fused.access.end())
+        fused.access.insert(access);
+      else if (itr->second != access.second)
+        itr->second = StageAccess::Write;
+    }
+  }
+
+  // Kernels are run in order on each particle in a single loop
+  const auto kernels = fused.particle_kernels;
+  const auto iterate = iterate_;
+  fused.run = [kernels, iterate]() {
+    iterate([&kernels](const std::shared_ptr<ParticleBase<Tdim>>& particle) {
+      for (const auto& kernel : kernels) kernel(particle);
+    });
+  };
+
+  const auto position = stages_.erase(first, first + names.size());
+  stages_.insert(position, fused);
+}
@@ -7,6 +7,8 @@
 #include <string>
 #include <vector>
 
+#include "arena.h"
+
 //! \brief Singleton factory implementation
 //! \tparam Tbaseclass Base class
 //! \tparam Targs variadic template arguments
@@ -35,6 +37,18 @@ class Factory {
     return registry.at(key)->create(std::forward<Targs>(args)...);
   }
 
+  //! Create an instance of a registered class in an arena
+  //! \param[in] key key to item in registry
+  //! \param[in] arena Arena in which the instance is allocated
+  //! \param[in] args Variadic template arguments
+  //! \retval shared_ptr<Tbaseclass> Shared pointer to a base class
+  std::shared_ptr<Tbaseclass> create(const std::string& key,
+                                     const std::shared_ptr<mpm::Arena>& arena,
+                                     Targs&&... args) {
+    return registry.at(key)->create(mpm::ArenaAllocator<char>(arena),
+                                    std::forward<Targs>(args)...);
+  }
+
   //! List registered elements
   //! \retval factory_items Return list of items in the registry
   std::vector<std::string> list() const {
@@ -52,6 +66,9 @@ class Factory {
   struct CreatorBase {
     //! A virtual create function
     virtual std::shared_ptr<Tbaseclass> create(Targs&&...) = 0;
+    //! A virtual create function in an arena
+    virtual std::shared_ptr<Tbaseclass> create(
+        const mpm::ArenaAllocator<char>& allocator, Targs&&...) = 0;
   };
 
   //! Creator class
@@ -62,6 +79,13 @@ class Factory {
     std::shared_ptr<Tbaseclass> create(Targs&&... args) override {
       return std::make_shared<Tderivedclass>(std::forward<Targs>(args)...);
     }
+    //! Create instance of object in an arena, with its control block
+    std::shared_ptr<Tbaseclass> create(
+        const mpm::ArenaAllocator<char>& allocator, Targs&&... args) override {
+      return std::allocate_shared<Tderivedclass>(
+          mpm::ArenaAllocator<Tderivedclass>(allocator),
+          std::forward<Targs>(args)...);
+    }
   };
   // Register of factory functions
   std::map<std::string, std::shared_ptr<CreatorBase>> registry;
@@ -0,0 +1,84 @@
+#ifndef MPM_FIELD_VIEW_H_
+#define MPM_FIELD_VIEW_H_
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Dense>
+
+namespace mpm {
+
+//! Field span struct
+//! \brief Contiguous components of a field in the storage of an entity
+struct FieldSpan {
+  //! First component, nullptr if the entity has no such field
+  double* data{nullptr};
+  //! Number of components
+  unsigned size{0};
+  //! Components are only read, e.g. as they are cached by other entities
+  bool read_only{false};
+};
+
+//! Field view class
+//! \brief Read and write access to a field of the particles or nodes of a
+//! mesh, without copying
+//! \details Fields are stored by each entity, so a view holds a span of the
+//! components in the storage of each entity. A view is valid until entities
+//! are added to or removed from the mesh. Fields which are read-only are
+//! only accessed through a const view.
+class FieldView {
+ public:
+  //! Components of the field of an entity
+  using Components = Eigen::Map<Eigen::VectorXd>;
+  //! Read-only components of the field of an entity
+  using ConstComponents = Eigen::Map<const Eigen::VectorXd>;
+
+  //! Default constructor of an empty view
+  FieldView() = default;
+
+  //! Constructor with the spans of the entities
+  //! \param[in] spans Spans of the field of the entities, of equal size
+  explicit FieldView(std::vector<FieldSpan>&& spans)
+      : spans_(std::move(spans)) {}
+
+  //! Return the number of entities
+  std::size_t size() const { return spans_.size(); }
+
+  //! Return the number of components of the field of an entity
+  unsigned ncomponents() const {
+    return spans_.empty() ? 0 : spans_.front().size;
+  }
+
+  //! Return if the field is read-only
+  bool read_only() const {
+    return !spans_.empty() && spans_.front().read_only;
+  }
+
+  //! Return the span of the field of an entity
+  //! \param[in] i Index of the entity in the view
+  const FieldSpan& span(std::size_t i) const { return spans_[i]; }
+
+  //! Return the components of the field of an entity, which throws if the
+  //! field is read-only
+  //! \param[in] i Index of the entity in the view
+  Components operator[](std::size_t i) {
+    if (spans_[i].read_only)
+      throw std::runtime_error("Field is read-only, and is read by a const "
+                               "view");
+    return Components(spans_[i].data, spans_[i].size);
+  }
+
+  //! Return the read-only components of the field of an entity
+  //! \param[in] i Index of the entity in the view
+  ConstComponents operator[](std::size_t i) const {
+    return ConstComponents(spans_[i].data, spans_[i].size);
+  }
+
+ private:
+  //! Spans of the field of the entities
+  std::vector<FieldSpan> spans_;
+};  // FieldView class
+}  // namespace mpm
+
+#endif  // MPM_FIELD_VIEW_H_
@@ -1,12 +1,18 @@
 #ifndef MPM_HDF5_H_
 #define MPM_HDF5_H_
 
+#include <string>
+#include <vector>
+
 // HDF5
 #include "hdf5.h"
 #include "hdf5_hl.h"
 
 namespace mpm {
 
+//! Global index type for the particle
+using Index = unsigned long long;
+
 // Define a struct of particle
 typedef struct HDF5Particle {
   // Index
@@ -29,6 +35,162 @@ typedef struct HDF5Particle {
   bool status;
 } HDF5Particle;
 
+//! Particle data stored as one contiguous array per field
+struct HDF5ParticleColumns {
+  //! Number of components of vector fields
+  static const unsigned Nvector = 3;
+  //! Number of components of tensor fields
+  static const unsigned Ntensor = 6;
+
+  //! Resize all fields to a number of particles
+  //! \param[in] nparticles Number of particles
+  void resize(hsize_t nparticles) {
+    id.resize(nparticles);
+    mass.resize(nparticles);
+    coordinates.resize(nparticles * Nvector);
+    velocities.resize(nparticles * Nvector);
+    stresses.resize(nparticles * Ntensor);
+    strains.resize(nparticles * Ntensor);
+    volumetric_strains.resize(nparticles);
+    status.resize(nparticles);
+  }
+
+  //! Return the number of particles
+  hsize_t size() const { return id.size(); }
+
+  // Index
+  std::vector<mpm::Index> id;
+  // Mass
+  std::vector<double> mass;
+  // Coordinates (x, y, z) of each particle
+  std::vector<double> coordinates;
+  // Velocities (x, y, z) of each particle
+  std::vector<double> velocities;
+  // Stresses (xx, yy, zz, xy, yz, xz) of each particle
+  std::vector<double> stresses;
+  // Strains (xx, yy, zz, xy, yz, xz) of each particle
+  std::vector<double> strains;
+  // Volumetric strain centroid
+  std::vector<double> volumetric_strains;
+  // Status
+  std::vector<unsigned char> status;
+};
+
+//! HDF5 particle output options
+struct HDF5Options {
+  //! Write one dataset per field instead of a compound table
+  bool columnar{false};
+  //! Number of particles in a chunk
+  hsize_t chunk_size{10000};
+  //! Deflate (gzip) compression level 0 - 9, 0 disables compression
+  unsigned compression{0};
+  //! Apply byte shuffle filter before compression
+  bool shuffle{false};
+  //! Append every output step as a group of one time-series file
+  bool time_series{false};
+};
+
+//! Output step stored as a group of a time-series HDF5 file
+struct HDF5Step {
+  //! Name of the group
+  std::string group;
+  //! Analysis step
+  mpm::Index step;
+  //! Simulation time
+  double time;
+  //! Number of particles
+  hsize_t nparticles;
+};
+
+//! Write a 2D dataset of nrows x ncols to a HDF5 file or group
+//! \param[in] location_id HDF5 file or group
+//! \param[in] name Name of the dataset
+//! \param[in] type HDF5 native type of the data
+//! \param[in] nrows Number of rows
+//! \param[in] ncols Number of columns
+//! \param[in] data Pointer to contiguous data
+//! \param[in] options Chunking and compression options
+//! \retval status Status of writing the dataset
+bool write_hdf5_dataset(hid_t location_id, const std::string& name,
+                        hid_t type, hsize_t nrows, hsize_t ncols,
+                        const void* data, const HDF5Options& options);
+
+//! Return the number of rows of a dataset, zero if not found
+//! \param[in] location_id HDF5 file or group
+//! \param[in] name Name of the dataset
+hsize_t hdf5_dataset_rows(hid_t location_id, const std::string& name);
+
+//! Read a complete dataset from a HDF5 file or group
+//! \param[in] location_id HDF5 file or group
+//! \param[in] name Name of the dataset
+//! \param[in] type HDF5 native type of the data
+//! \param[out] data Pointer to a buffer large enough for the dataset
+//! \retval status Status of reading the dataset
+bool read_hdf5_dataset(hid_t location_id, const std::string& name, hid_t type,
+                       void* data);
+
+//! Write columnar particle data, one dataset per field, to a file or group
+//! \param[in] location_id HDF5 file or group
+//! \param[in] columns HDF5 data of particles
+//! \param[in] options Chunking and compression options
+//! \retval status Status of writing particle data
+bool write_hdf5_particles(hid_t location_id, const HDF5ParticleColumns& columns,
+                          const HDF5Options& options);
+
+//! Read columnar particle data from a file or group
+//! \param[in] location_id HDF5 file or group
+//! \param[in] nparticles Expected number of particles
+//! \param[out] columns HDF5 data of particles
+//! \retval status Status of reading particle data
+bool read_hdf5_particles(hid_t location_id, hsize_t nparticles,
+                         HDF5ParticleColumns& columns);
+
+//! Name of the group of an output step in a time-series HDF5 file
+//! \param[in] step Analysis step
+std::string hdf5_step_group(mpm::Index step);
+
+//! Append an output step as a group to a time-series HDF5 file, the file is
+//! created if it doesn't exist and a group of the same step is replaced, whose
+//! space is reused by later groups
+//! \param[in] filename Name of the time-series HDF5 file
+//! \param[in] step Analysis step
+//! \param[in] time Simulation time
+//! \param[in] columns HDF5 data of particles
+//! \param[in] options Chunking and compression options
+//! \retval status Status of writing the output step
+bool write_hdf5_time_series(const std::string& filename, mpm::Index step,
+                            double time, const HDF5ParticleColumns& columns,
+                            const HDF5Options& options);
+
+//! Return the output steps of a time-series HDF5 file sorted by step
+//! \param[in] filename Name of the time-series HDF5 file
+std::vector<HDF5Step> hdf5_time_series(const std::string& filename);
+
+//! Delete the output steps after a step from a time-series HDF5 file, e.g.
+//! when an analysis is resumed from that step
+//! \param[in] filename Name of the time-series HDF5 file
+//! \param[in] step Last analysis step which is kept
+//! \retval steps Output steps which are kept, sorted by step
+std::vector<HDF5Step> truncate_hdf5_time_series(const std::string& filename,
+                                                mpm::Index step);
+
+//! Write an XDMF index of a time-series HDF5 file to browse it in ParaView
+//! \param[in] filename Name of the XDMF file
+//! \param[in] hdf5_file Name of the HDF5 file relative to the XDMF file
+//! \param[in] steps Output steps in the HDF5 file
+//! \retval status Status of writing the XDMF file
+bool write_xdmf(const std::string& filename, const std::string& hdf5_file,
+                const std::vector<HDF5Step>& steps);
+
+//! Append an output step to an XDMF index, without rewriting the steps
+//! already in the index, which is created if it doesn't exist
+//! \param[in] filename Name of the XDMF file
+//! \param[in] hdf5_file Name of the HDF5 file relative to the XDMF file
+//! \param[in] step Output step appended to the HDF5 file
+//! \retval status Status of appending to the XDMF file
+bool append_xdmf(const std::string& filename, const std::string& hdf5_file,
+                 const HDF5Step& step);
+
 }  // namespace mpm
 
 #endif  // MPM_HDF5_H_
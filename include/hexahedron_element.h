@@ -103,7 +103,7 @@ namespace mpm {
 //! \tparam Tdim Dimension
 //! \tparam Tnfunctions Number of functions
 template <unsigned Tdim, unsigned Tnfunctions>
-class HexahedronElement : public Element<Tdim> {
+class HexahedronElement final : public Element<Tdim> {
 
  public:
   //! Define a vector of size dimension
@@ -194,6 +194,21 @@ class HexahedronElement : public Element<Tdim> {
       const VectorDim& particle_size,
       const VectorDim& deformation_gradient) const override;
 
+  //! Evaluate shape functions at given local coordinates into a buffer
+  //! \param[in] xi given local coordinates
+  //! \param[out] shapefn Shape functions, sized to the number of functions
+  void evaluate_shapefn(const VectorDim& xi,
+                        Eigen::Ref<Eigen::VectorXd> shapefn) const override;
+
+  //! Evaluate the B matrix at given local coordinates for a real cell into a
+  //! buffer, which is only resized if its size doesn't match
+  //! \param[in] xi given local coordinates
+  //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
+  //! \param[out] bmatrix B matrix
+  void evaluate_bmatrix(const VectorDim& xi,
+                        const Eigen::MatrixXd& nodal_coordinates,
+                        std::vector<Eigen::MatrixXd>& bmatrix) const override;
+
   //! Evaluate the mass matrix
   //! \param[in] xi_s Vector of local coordinates
   //! \retval mass_matrix mass matrix
@@ -236,6 +251,18 @@ class HexahedronElement : public Element<Tdim> {
   Eigen::VectorXi face_indices(unsigned face_id) const override;
 
  private:
+  //! Evaluate shape functions at given local coordinates
+  //! \param[in] xi given local coordinates
+  //! \retval shapefn Shape functions as a fixed-size vector
+  Eigen::Matrix<double, Tnfunctions, 1> fixed_shapefn(
+      const VectorDim& xi) const;
+
+  //! Evaluate gradient of shape functions
+  //! \param[in] xi given local coordinates
+  //! \retval grad_shapefn Gradient of shape functions as a fixed-size matrix
+  Eigen::Matrix<double, Tnfunctions, Tdim> fixed_grad_shapefn(
+      const VectorDim& xi) const;
+
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
 };
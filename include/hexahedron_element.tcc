@@ -16,8 +16,9 @@
 //! \param[in] xi Coordinates of point of interest
 //! \retval shapefn Shape function of a given cell
 template <>
-inline Eigen::VectorXd mpm::HexahedronElement<3, 8>::shapefn(
-    const Eigen::Matrix<double, 3, 1>& xi) const {
+inline Eigen::Matrix<double, 8, 1>
+    mpm::HexahedronElement<3, 8>::fixed_shapefn(
+        const Eigen::Matrix<double, 3, 1>& xi) const {
   // 8-noded
   Eigen::Matrix<double, 8, 1> shapefn;
   shapefn(0) = 0.125 * (1 - xi(0)) * (1 - xi(1)) * (1 - xi(2));
@@ -35,8 +36,9 @@ inline Eigen::VectorXd mpm::HexahedronElement<3, 8>::shapefn(
 //! \param[in] xi Coordinates of point of interest
 //! \retval grad_shapefn Gradient of shape function of a given cell
 template <>
-inline Eigen::MatrixXd mpm::HexahedronElement<3, 8>::grad_shapefn(
-    const Eigen::Matrix<double, 3, 1>& xi) const {
+inline Eigen::Matrix<double, 8, 3>
+    mpm::HexahedronElement<3, 8>::fixed_grad_shapefn(
+        const Eigen::Matrix<double, 3, 1>& xi) const {
   Eigen::Matrix<double, 8, 3> grad_shapefn;
   grad_shapefn(0, 0) = -0.125 * (1 - xi(1)) * (1 - xi(2));
   grad_shapefn(1, 0) = 0.125 * (1 - xi(1)) * (1 - xi(2));
@@ -106,8 +108,9 @@ inline Eigen::MatrixXd mpm::HexahedronElement<3, 8>::unit_cell_coordinates()
 //! \param[in] xi Coordinates of point of interest
 //! \retval shapefn Shape function of a given cell
 template <>
-inline Eigen::VectorXd mpm::HexahedronElement<3, 20>::shapefn(
-    const Eigen::Matrix<double, 3, 1>& xi) const {
+inline Eigen::Matrix<double, 20, 1>
+    mpm::HexahedronElement<3, 20>::fixed_shapefn(
+        const Eigen::Matrix<double, 3, 1>& xi) const {
   Eigen::Matrix<double, 20, 1> shapefn;
   shapefn(0) = -0.125 * (1 - xi(0)) * (1 - xi(1)) * (1 - xi(2)) *
                (2 + xi(0) + xi(1) + xi(2));
@@ -145,8 +148,9 @@ inline Eigen::VectorXd mpm::HexahedronElement<3, 20>::shapefn(
 //! \param[in] xi Coordinates of point of interest
 //! \retval grad_shapefn Gradient of shape function of a given cell
 template <>
-inline Eigen::MatrixXd mpm::HexahedronElement<3, 20>::grad_shapefn(
-    const Eigen::Matrix<double, 3, 1>& xi) const {
+inline Eigen::Matrix<double, 20, 3>
+    mpm::HexahedronElement<3, 20>::fixed_grad_shapefn(
+        const Eigen::Matrix<double, 3, 1>& xi) const {
   Eigen::Matrix<double, 20, 3> grad_shapefn;
 
   grad_shapefn(0, 0) =
@@ -238,6 +242,22 @@ inline Eigen::MatrixXd mpm::HexahedronElement<3, 20>::grad_shapefn(
   return grad_shapefn;
 }
 
+//! Return shape functions of a Hexahedron Element at a given local
+//! coordinate
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::VectorXd mpm::HexahedronElement<Tdim, Tnfunctions>::shapefn(
+    const Eigen::Matrix<double, Tdim, 1>& xi) const {
+  return this->fixed_shapefn(xi);
+}
+
+//! Return gradient of shape functions of a Hexahedron Element at a given
+//! local coordinate
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::MatrixXd mpm::HexahedronElement<Tdim, Tnfunctions>::grad_shapefn(
+    const Eigen::Matrix<double, Tdim, 1>& xi) const {
+  return this->fixed_grad_shapefn(xi);
+}
+
 //! Return shape functions of a Hexahedron Element at a given local
 //! coordinate, with particle size and deformation gradient
 template <unsigned Tdim, unsigned Tnfunctions>
@@ -380,6 +400,60 @@ inline std::vector<Eigen::MatrixXd>
       xi, nodal_coordinates);
 }
 
+//! Evaluate shape functions of a Hexahedron Element into a buffer
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void mpm::HexahedronElement<Tdim, Tnfunctions>::evaluate_shapefn(
+    const VectorDim& xi, Eigen::Ref<Eigen::VectorXd> shapefn) const {
+  shapefn = this->fixed_shapefn(xi);
+}
+
+//! Evaluate the B-matrix of a Hexahedron Element at a given local
+//! coordinate for a real cell into a buffer
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void mpm::HexahedronElement<Tdim, Tnfunctions>::evaluate_bmatrix(
+    const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+    std::vector<Eigen::MatrixXd>& bmatrix) const {
+  try {
+    // Check if matrices dimensions are correct
+    if ((Tnfunctions != nodal_coordinates.rows()) ||
+        (xi.rows() != nodal_coordinates.cols()))
+      throw std::runtime_error(
+          "BMatrix - Jacobian calculation: Incorrect dimension of xi and "
+          "nodal_coordinates");
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    return;
+  }
+
+  // Get gradient shape functions
+  const Eigen::Matrix<double, Tnfunctions, Tdim> grad_sf =
+      this->fixed_grad_shapefn(xi);
+
+  // Jacobian dx_i/dxi_j
+  const Eigen::Matrix<double, Tdim, Tdim> jacobian =
+      grad_sf.transpose().lazyProduct(nodal_coordinates);
+
+  // Gradient shapefn of the cell
+  // dN/dx = [J]^-1 * dN/dxi
+  const Eigen::Matrix<double, Tnfunctions, Tdim> grad_shapefn =
+      grad_sf * jacobian.inverse();
+
+  // Only allocate on the first call
+  bmatrix.resize(Tnfunctions);
+  for (unsigned i = 0; i < Tnfunctions; ++i) {
+    auto& bi = bmatrix[i];
+    bi.resize(6, Tdim);
+    // clang-format off
+    bi(0, 0) = grad_shapefn(i, 0); bi(0, 1) = 0.;                 bi(0, 2) = 0.;
+    bi(1, 0) = 0.;                 bi(1, 1) = grad_shapefn(i, 1); bi(1, 2) = 0.;
+    bi(2, 0) = 0.;                 bi(2, 1) = 0.;                 bi(2, 2) = grad_shapefn(i, 2);
+    bi(3, 0) = grad_shapefn(i, 1); bi(3, 1) = grad_shapefn(i, 0); bi(3, 2) = 0.;
+    bi(4, 0) = 0.;                 bi(4, 1) = grad_shapefn(i, 2); bi(4, 2) = grad_shapefn(i, 1);
+    bi(5, 0) = grad_shapefn(i, 2); bi(5, 1) = 0.;                 bi(5, 2) = grad_shapefn(i, 0);
+    // clang-format on
+  }
+}
+
 //! Return mass_matrix of a Hexahedron Element
 template <unsigned Tdim, unsigned Tnfunctions>
 inline Eigen::MatrixXd mpm::HexahedronElement<Tdim, Tnfunctions>::mass_matrix(
@@ -0,0 +1,131 @@
+#ifndef MPM_IMPLICIT_OPERATOR_H_
+#define MPM_IMPLICIT_OPERATOR_H_
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <Eigen/Dense>
+#include <tbb/blocked_range.h>
+#include <tbb/concurrent_vector.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+
+#include "mesh.h"
+#include "step_errors.h"
+
+namespace mpm {
+
+//! Implicit operator class
+//! \brief Matrix-free operator of an implicit step, M / (beta dt^2) + K, over
+//! the degrees of freedom of the active nodes of a mesh
+//! \details The lumped nodal mass M is mapped from the particles, and the
+//! tangent stiffness K is applied as the sum over particles of
+//! V B^T D B, with the B-matrices at the particles and the elastic tensor D
+//! of their material, without assembling a matrix. Linear systems are
+//! solved with a Jacobi preconditioned conjugate gradient over the free
+//! degrees of freedom.
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+class ImplicitOperator {
+ public:
+  //! Number of components of strain
+  static const unsigned Tnstrain = (Tdim == 1) ? 1 : (Tdim == 2) ? 3 : 6;
+
+  //! Constructor
+  ImplicitOperator() = default;
+
+  //! Delete copy constructor
+  ImplicitOperator(const ImplicitOperator&) = delete;
+
+  //! Delete assignement operator
+  ImplicitOperator& operator=(const ImplicitOperator&) = delete;
+
+  //! Collect the active nodes, their masses and constraints, and the
+  //! stiffness of the particles of a mesh, after the shape functions, volume
+  //! and mass of the particles are computed and mapped to the nodes
+  //! \param[in] mesh Mesh
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] mass_coefficient Coefficient of the nodal mass in the
+  //! operator, 1 / (beta dt^2) of a Newmark step
+  void assemble(Mesh<Tdim>& mesh, unsigned phase, double mass_coefficient);
+
+  //! Return the number of degrees of freedom
+  unsigned ndofs() const { return nodes_.size() * Tdim; }
+
+  //! Return the active nodes, whose degrees of freedom are Tdim consecutive
+  //! entries in the order of the nodes
+  const std::vector<std::shared_ptr<NodeBase<Tdim>>>& nodes() const {
+    return nodes_;
+  }
+
+  //! Return one for free and zero for constrained degrees of freedom
+  const Eigen::VectorXd& free() const { return free_; }
+
+  //! Return the diagonal of the operator
+  const Eigen::VectorXd& diagonal() const { return diagonal_; }
+
+  //! Apply the operator to a vector
+  //! \param[in] x Vector over the degrees of freedom
+  //! \retval y Product of the operator and the vector
+  Eigen::VectorXd apply(const Eigen::VectorXd& x) const;
+
+  //! Solve the operator for the free degrees of freedom, with the
+  //! constrained degrees of freedom prescribed by the initial guess
+  //! \param[in] rhs Right-hand side
+  //! \param[in,out] x Initial guess and solution
+  //! \param[in] tolerance Residual relative to the right-hand side
+  //! \param[in] max_iterations Maximum number of iterations
+  //! \retval status Status of convergence
+  bool solve(const Eigen::VectorXd& rhs, Eigen::VectorXd& x, double tolerance,
+             unsigned max_iterations);
+
+  //! Return the number of iterations of the last solve
+  unsigned iterations() const { return iterations_; }
+
+  //! Return the relative residual of the last solve
+  double residual() const { return residual_; }
+
+ private:
+  //! Stiffness of a particle
+  struct Stiffness {
+    //! Indices of the nodes of the cell of the particle in the active nodes
+    std::vector<unsigned> nodes;
+    //! B-matrix of each node of the cell at the particle
+    std::vector<Eigen::MatrixXd> bmatrix;
+    //! Elastic tensor of the components of strain, times the volume
+    Eigen::MatrixXd elastic;
+  };
+
+  //! Add the product of the stiffness of a particle and a vector
+  //! \param[in] stiffness Stiffness of a particle
+  //! \param[in] x Vector over the degrees of freedom
+  //! \param[in,out] y Product
+  static void add_stiffness(const Stiffness& stiffness,
+                            const Eigen::VectorXd& x, Eigen::VectorXd& y);
+
+  //! Active nodes
+  std::vector<std::shared_ptr<NodeBase<Tdim>>> nodes_;
+  //! Index of each active node by id
+  std::unordered_map<mpm::Index, unsigned> indices_;
+  //! Mass term of each degree of freedom
+  Eigen::VectorXd mass_;
+  //! One for free and zero for constrained degrees of freedom
+  Eigen::VectorXd free_;
+  //! Diagonal of the operator
+  Eigen::VectorXd diagonal_;
+  //! Stiffness of the particles
+  tbb::concurrent_vector<Stiffness> stiffness_;
+  //! Number of iterations of the last solve
+  unsigned iterations_{0};
+  //! Relative residual of the last solve
+  double residual_{0.};
+};  // ImplicitOperator class
+}  // namespace mpm
+
+#include "implicit_operator.tcc"
+
+#endif  // MPM_IMPLICIT_OPERATOR_H_
@@ -0,0 +1,163 @@
+//! Collect the active nodes and the stiffness of the particles of a mesh
+template <unsigned Tdim>
+void mpm::ImplicitOperator<Tdim>::assemble(Mesh<Tdim>& mesh, unsigned phase,
+                                           double mass_coefficient) {
+  using NodePtr = std::shared_ptr<mpm::NodeBase<Tdim>>;
+  using ParticlePtr = std::shared_ptr<mpm::ParticleBase<Tdim>>;
+
+  // Index the active nodes
+  nodes_.clear();
+  indices_.clear();
+  mesh.iterate_over_nodes_predicate(
+      [this](const NodePtr& node) {
+        indices_.emplace(node->id(), nodes_.size());
+        nodes_.emplace_back(node);
+      },
+      [](const NodePtr& node) { return node->status(); });
+
+  // Mass and constraints of the degrees of freedom of the nodes
+  mass_.resize(this->ndofs());
+  free_.setOnes(this->ndofs());
+  for (unsigned i = 0; i < nodes_.size(); ++i) {
+    mass_.segment(i * Tdim, Tdim)
+        .setConstant(mass_coefficient * nodes_[i]->mass(phase));
+    // Direction: dir % Tdim, phase: dir / Tdim
+    for (const auto& constraint : nodes_[i]->velocity_constraints())
+      if (constraint.first / Tdim == phase)
+        free_(i * Tdim + constraint.first % Tdim) = 0.;
+  }
+
+  // Components of strain in the elastic tensor, e.g. xx, yy and xy in 2D
+  std::array<unsigned, Tnstrain> components;
+  for (unsigned i = 0; i < Tnstrain; ++i)
+    components[i] = (Tdim == 2 && i == 2) ? 3 : i;
+
+  // Stiffness of the particles
+  stiffness_.clear();
+  mesh.iterate_over_particles([this, &components](const ParticlePtr& particle) {
+    const auto& cell = particle->cell();
+    if (cell == nullptr) {
+      mpm::StepErrors::current().record(mpm::StepError::ParticleCell);
+      return;
+    }
+    if (particle->material() == nullptr) {
+      mpm::StepErrors::current().record(mpm::StepError::ParticleMaterial);
+      return;
+    }
+    if (particle->bmatrix().size() != cell->nnodes()) {
+      mpm::StepErrors::current().record(mpm::StepError::DegreesOfFreedom);
+      return;
+    }
+
+    Stiffness stiffness;
+    stiffness.bmatrix = particle->bmatrix();
+    stiffness.nodes.reserve(cell->nnodes());
+    for (unsigned i = 0; i < cell->nnodes(); ++i)
+      stiffness.nodes.emplace_back(indices_.at(cell->node(i)->id()));
+
+    const Eigen::Matrix<double, 6, 6> elastic =
+        particle->material()->elastic_tensor();
+    stiffness.elastic.resize(Tnstrain, Tnstrain);
+    for (unsigned i = 0; i < Tnstrain; ++i)
+      for (unsigned j = 0; j < Tnstrain; ++j)
+        stiffness.elastic(i, j) =
+            particle->volume() * elastic(components[i], components[j]);
+    stiffness_.emplace_back(std::move(stiffness));
+  });
+
+  // Diagonal of the operator
+  const auto diagonal = [this](const tbb::blocked_range<std::size_t>& range,
+                               Eigen::VectorXd diagonal) {
+    for (std::size_t p = range.begin(); p != range.end(); ++p) {
+      const auto& stiffness = stiffness_[p];
+      for (unsigned i = 0; i < stiffness.nodes.size(); ++i)
+        diagonal.segment(stiffness.nodes[i] * Tdim, Tdim) +=
+            (stiffness.bmatrix[i].transpose() * stiffness.elastic *
+             stiffness.bmatrix[i])
+                .diagonal();
+    }
+    return diagonal;
+  };
+  diagonal_ =
+      mass_ + tbb::parallel_reduce(
+                  tbb::blocked_range<std::size_t>(0, stiffness_.size()),
+                  Eigen::VectorXd::Zero(this->ndofs()).eval(), diagonal,
+                  [](const Eigen::VectorXd& lhs, const Eigen::VectorXd& rhs)
+                      -> Eigen::VectorXd { return lhs + rhs; });
+}
+
+//! Add the product of the stiffness of a particle and a vector
+template <unsigned Tdim>
+void mpm::ImplicitOperator<Tdim>::add_stiffness(const Stiffness& stiffness,
+                                                const Eigen::VectorXd& x,
+                                                Eigen::VectorXd& y) {
+  // Strain of the nodal displacements at the particle
+  Eigen::Matrix<double, Tnstrain, 1> strain =
+      Eigen::Matrix<double, Tnstrain, 1>::Zero();
+  for (unsigned i = 0; i < stiffness.nodes.size(); ++i)
+    strain.noalias() +=
+        stiffness.bmatrix[i] * x.segment(stiffness.nodes[i] * Tdim, Tdim);
+
+  // Nodal forces of the stress times the volume
+  const Eigen::Matrix<double, Tnstrain, 1> stress = stiffness.elastic * strain;
+  for (unsigned i = 0; i < stiffness.nodes.size(); ++i)
+    y.segment(stiffness.nodes[i] * Tdim, Tdim).noalias() +=
+        stiffness.bmatrix[i].transpose() * stress;
+}
+
+//! Apply the operator to a vector
+template <unsigned Tdim>
+Eigen::VectorXd mpm::ImplicitOperator<Tdim>::apply(
+    const Eigen::VectorXd& x) const {
+  Eigen::VectorXd y = tbb::parallel_reduce(
+      tbb::blocked_range<std::size_t>(0, stiffness_.size()),
+      Eigen::VectorXd::Zero(x.size()).eval(),
+      [&](const tbb::blocked_range<std::size_t>& range, Eigen::VectorXd y) {
+        for (std::size_t p = range.begin(); p != range.end(); ++p)
+          add_stiffness(stiffness_[p], x, y);
+        return y;
+      },
+      [](const Eigen::VectorXd& lhs,
+         const Eigen::VectorXd& rhs) -> Eigen::VectorXd { return lhs + rhs; });
+  y += mass_.cwiseProduct(x);
+  return y;
+}
+
+//! Solve the operator with a Jacobi preconditioned conjugate gradient
+template <unsigned Tdim>
+bool mpm::ImplicitOperator<Tdim>::solve(const Eigen::VectorXd& rhs,
+                                        Eigen::VectorXd& x, double tolerance,
+                                        unsigned max_iterations) {
+  // Constrained degrees of freedom keep the values of the initial guess
+  const Eigen::VectorXd preconditioner = free_.cwiseQuotient(diagonal_);
+  const double norm = std::max(free_.cwiseProduct(rhs).norm(),
+                               std::numeric_limits<double>::min());
+
+  Eigen::VectorXd residual = free_.cwiseProduct(rhs - this->apply(x));
+  iterations_ = 0;
+  residual_ = residual.norm() / norm;
+  if (residual_ <= tolerance) return true;
+
+  Eigen::VectorXd z = preconditioner.cwiseProduct(residual);
+  Eigen::VectorXd direction = z;
+  double rz = residual.dot(z);
+  while (iterations_ < max_iterations) {
+    ++iterations_;
+    const Eigen::VectorXd q = free_.cwiseProduct(this->apply(direction));
+    // The operator isn't positive definite
+    const double curvature = direction.dot(q);
+    if (!(curvature > 0.)) return false;
+
+    const double alpha = rz / curvature;
+    x += alpha * direction;
+    residual -= alpha * q;
+    residual_ = residual.norm() / norm;
+    if (residual_ <= tolerance) return true;
+
+    z = preconditioner.cwiseProduct(residual);
+    const double rz_next = residual.dot(z);
+    direction = z + (rz_next / rz) * direction;
+    rz = rz_next;
+  }
+  return false;
+}
@@ -23,6 +23,14 @@ class IO {
   //! \param[in] argv Input arguments
   IO(int argc, char** argv);
 
+  //! Constructor with an input JSON object, e.g. of an analysis which is
+  //! created by another analysis instead of from the command line
+  //! \param[in] working_dir Working directory of the input files
+  //! \param[in] analysis Analysis type
+  //! \param[in] json Input JSON object
+  IO(const std::string& working_dir, const std::string& analysis,
+     const Json& json);
+
   //! Return input file name of mesh/submesh/soil particles
   //! or an empty string if specified file for the key is not found
   //! \param[in] key Input key in JSON for the filename of
@@ -42,6 +50,12 @@ class IO {
   //! Return json object
   Json json_object(const std::string& name) const { return json_[name]; }
 
+  //! Return the input JSON object
+  const Json& json() const { return json_; }
+
+  //! Return the working directory
+  std::string working_dir() const { return working_dir_; }
+
   //! Return post processing object
   Json post_processing() const { return json_["post_processing"]; }
 
@@ -60,7 +74,20 @@ class IO {
                                       const std::string& analysis_id,
                                       unsigned step, unsigned max_steps);
 
+  //! Create output file name of a time series, which holds all steps
+  //! \param[in] attribute Attribute being written (eg., particles)
+  //! \param[in] file_extension File Extension (*.h5 or *.xdmf)
+  //! \param[in] analysis_id Unique id of the analysis
+  //! \return file_name File name with the attribute and extension
+  boost::filesystem::path output_file(const std::string& attribute,
+                                      const std::string& file_extension,
+                                      const std::string& analysis_id);
+
  private:
+  //! Create and return the output folder of an analysis
+  //! \param[in] analysis_id Unique id of the analysis
+  std::string analysis_folder(const std::string& analysis_id);
+
   //! Working directory
   std::string working_dir_;
   //! Input file name
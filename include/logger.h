@@ -1,7 +1,9 @@
 #ifndef MPM_LOGGER_H_
 #define MPM_LOGGER_H_
 
+#include <cstddef>
 #include <memory>
+#include <string>
 
 // Speed log
 #include "spdlog/sinks/stdout_color_sinks.h"
@@ -24,6 +26,9 @@ struct Logger {
   // Create a logger for reading ascii mesh
   static const std::shared_ptr<spdlog::logger> read_mesh_ascii;
 
+  // Create a logger for reading binary mesh
+  static const std::shared_ptr<spdlog::logger> read_mesh_binary;
+
   // Create a logger for MPM
   static const std::shared_ptr<spdlog::logger> mpm_logger;
 
@@ -35,6 +40,34 @@ struct Logger {
 
   // Create a logger for MPM Explicit USL
   static const std::shared_ptr<spdlog::logger> mpm_explicit_usl_logger;
+
+  // Create a logger for MPM Explicit DR
+  static const std::shared_ptr<spdlog::logger> mpm_explicit_dr_logger;
+
+  // Create a logger for MPM Implicit
+  static const std::shared_ptr<spdlog::logger> mpm_implicit_logger;
+
+  // Create a logger for MPM Ensemble
+  static const std::shared_ptr<spdlog::logger> mpm_ensemble_logger;
+
+  //! Set if entities share a logger per type (slim entities), instead of
+  //! creating a logger each, which applies to entities created afterwards
+  //! \param[in] slim Entities share loggers
+  static void slim_entities(bool slim);
+
+  //! Return if entities share a logger per type
+  static bool slim_entities();
+
+  //! Return a logger of a particle, node or cell, which is shared by all
+  //! entities of a type with slim entities, otherwise named after the id
+  //! \param[in] type Type of the entity, e.g. particle2d
+  //! \param[in] id Id of the entity
+  static std::shared_ptr<spdlog::logger> entity_logger(const std::string& type,
+                                                       unsigned long long id);
+
+  //! Return the bytes of a logger owned by an entity, or zero if it is shared
+  //! \param[in] logger Logger of an entity
+  static std::size_t footprint(const std::shared_ptr<spdlog::logger>& logger);
 };
 
 }  // namespace mpm
@@ -2,6 +2,7 @@
 #define MPM_MAP_H_
 
 #include <algorithm>
+#include <memory>
 #include <unordered_map>
 
 namespace mpm {
@@ -34,6 +35,15 @@ class Map {
   //! Return number of elements in the container
   std::size_t size() const { return elements_.size(); }
 
+  //! Return an estimate of the bytes the container owns on the heap, which
+  //! are its buckets and a node per element
+  std::size_t footprint() const {
+    return elements_.bucket_count() * sizeof(void*) +
+           elements_.size() *
+               (sizeof(std::pair<const Index, std::shared_ptr<T>>) +
+                sizeof(void*));
+  }
+
   //! Return value at a given index
   std::shared_ptr<T> operator[](Index id) const { return elements_.at(id); }
 
@@ -0,0 +1,41 @@
+#ifndef MPM_MAPPED_FILE_H_
+#define MPM_MAPPED_FILE_H_
+
+#include <cstddef>
+#include <string>
+
+namespace mpm {
+
+//! Memory-mapped file
+//! \brief Maps a complete file read-only, its content is accessed in place
+class MappedFile {
+ public:
+  //! Map a file, throws if the file can't be opened or mapped
+  //! \param[in] filename Name of the file
+  explicit MappedFile(const std::string& filename);
+
+  //! Destructor unmaps the file
+  ~MappedFile();
+
+  //! Delete copy constructor
+  MappedFile(const MappedFile&) = delete;
+
+  //! Delete assignment operator
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  //! Return mapped content, which is not null terminated
+  const char* data() const { return data_; }
+
+  //! Return size of the file in bytes
+  std::size_t size() const { return size_; }
+
+ private:
+  //! Mapped content
+  const char* data_{nullptr};
+  //! Size of the file
+  std::size_t size_{0};
+};
+
+}  // namespace mpm
+
+#endif  // MPM_MAPPED_FILE_H_
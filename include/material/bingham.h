@@ -1,6 +1,7 @@
 #ifndef MPM_MATERIAL_BINGHAM_H_
 #define MPM_MATERIAL_BINGHAM_H_
 
+#include <cmath>
 #include <iostream>
 #include <limits>
 
@@ -15,7 +16,7 @@ namespace mpm {
 //! \details Bingham class stresses and strains
 //! \tparam Tdim Dimension
 template <unsigned Tdim>
-class Bingham : public Material<Tdim> {
+class Bingham final : public Material<Tdim> {
  public:
   //! Define a vector of 6 dof
   using Vector6d = Eigen::Matrix<double, 6, 1>;
@@ -59,6 +60,9 @@ class Bingham : public Material<Tdim> {
   //! Check if this material needs a particle handle
   bool property_handle() const override { return true; }
 
+  //! Return the speed of a compression wave from the bulk modulus
+  double wave_speed() const override;
+
  protected:
   //! material id
   using Material<Tdim>::id_;
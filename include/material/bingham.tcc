@@ -119,3 +119,12 @@ inline Eigen::Matrix<double, 6, 1> mpm::Bingham<3>::dirac_delta() const {
   return (Eigen::Matrix<double, 6, 1>() << 1.f, 1.f, 1.f, 0.f, 0.f, 0.f)
       .finished();
 }
+
+//! Return the speed of a compression wave from the bulk modulus, as the
+//! shear response of the fluid is viscous
+template <unsigned Tdim>
+double mpm::Bingham<Tdim>::wave_speed() const {
+  const double bulk_modulus =
+      youngs_modulus_ / (3.0 * (1. - 2. * poisson_ratio_));
+  return std::sqrt(bulk_modulus / density_);
+}
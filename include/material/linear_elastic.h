@@ -1,6 +1,7 @@
 #ifndef MPM_MATERIAL_LINEAR_ELASTIC_H_
 #define MPM_MATERIAL_LINEAR_ELASTIC_H_
 
+#include <cmath>
 #include <limits>
 
 #include "Eigen/Dense"
@@ -14,7 +15,7 @@ namespace mpm {
 //! \details LinearElastic class stresses and strains
 //! \tparam Tdim Dimension
 template <unsigned Tdim>
-class LinearElastic : public Material<Tdim> {
+class LinearElastic final : public Material<Tdim> {
  public:
   //! Define a vector of 6 dof
   using Vector6d = Eigen::Matrix<double, 6, 1>;
@@ -63,6 +64,9 @@ class LinearElastic : public Material<Tdim> {
   //! Check if this material needs a particle handle
   bool property_handle() const override { return false; }
 
+  //! Return the speed of a compression wave in the material
+  double wave_speed() const override;
+
  protected:
   //! material id
   using Material<Tdim>::id_;
@@ -54,3 +54,12 @@ Eigen::Matrix<double, 6, 1> mpm::LinearElastic<Tdim>::compute_stress(
 
   return this->compute_stress(stress, dstrain);
 }
+
+//! Return the speed of a compression wave in the material
+template <unsigned Tdim>
+double mpm::LinearElastic<Tdim>::wave_speed() const {
+  // Bulk and shear modulus
+  const double K = youngs_modulus_ / (3.0 * (1. - 2. * poisson_ratio_));
+  const double G = youngs_modulus_ / (2.0 * (1. + poisson_ratio_));
+  return std::sqrt((K + (4.0 / 3.0) * G) / density_);
+}
@@ -89,6 +89,10 @@ class Material {
   //! For eg, dstrain_rate. These function calls can only to const functions
   virtual bool property_handle() const = 0;
 
+  //! Return the speed of a compression wave in the material
+  //! \retval wave_speed Wave speed, which limits a stable time step
+  virtual double wave_speed() const = 0;
+
  protected:
   //! material id
   unsigned id_{std::numeric_limits<unsigned>::max()};
@@ -1,28 +1,92 @@
 #ifndef MPM_MESH_H_
 #define MPM_MESH_H_
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <limits>
+#include <map>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 // Eigen
 #include "Eigen/Dense"
 // TBB
+#include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_for_each.h>
+#include <tbb/parallel_reduce.h>
 
+#include "arena.h"
 #include "cell.h"
+#include "checkpoint.h"
 #include "container.h"
 #include "factory.h"
+#include "field_view.h"
 #include "hdf5.h"
+#include "hexahedron_quadrature.h"
 #include "logger.h"
 #include "material/material.h"
 #include "node.h"
 #include "particle.h"
 #include "particle_base.h"
+#include "quadrilateral_quadrature.h"
+#include "step_errors.h"
 
 namespace mpm {
 
+//! Memory footprint of the entities of a mesh
+//! \brief Number and bytes of particles, nodes and cells, and the memory of
+//! the arena they are placed in
+struct MeshFootprint {
+  //! Number of particles
+  mpm::Index nparticles{0};
+  //! Bytes of particles, including the memory they own on the heap
+  std::size_t particles{0};
+  //! Number of nodes
+  mpm::Index nnodes{0};
+  //! Bytes of nodes, including the memory they own on the heap
+  std::size_t nodes{0};
+  //! Number of cells
+  mpm::Index ncells{0};
+  //! Bytes of cells, including the memory they own on the heap
+  std::size_t cells{0};
+  //! Bytes of the arena allocated to entities and their control blocks
+  std::size_t arena_allocated{0};
+  //! Bytes reserved in slabs of the arena
+  std::size_t arena_reserved{0};
+
+  //! Return the total bytes of entities, including unused memory of the arena
+  std::size_t total() const {
+    return particles + nodes + cells + arena_reserved - arena_allocated;
+  }
+};
+
+//! Global diagnostics of the particles of a mesh
+//! \brief Kinetic energy, momentum and maximum speed of the particles
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+struct MeshDiagnostics {
+  //! Kinetic energy
+  double kinetic_energy{0.};
+  //! Momentum
+  Eigen::Matrix<double, Tdim, 1> momentum{
+      Eigen::Matrix<double, Tdim, 1>::Zero()};
+  //! Maximum speed of a particle
+  double max_velocity{0.};
+
+  //! Add the diagnostics of other particles
+  MeshDiagnostics& operator+=(const MeshDiagnostics& diagnostics) {
+    kinetic_energy += diagnostics.kinetic_energy;
+    momentum += diagnostics.momentum;
+    max_velocity = std::max(max_velocity, diagnostics.max_velocity);
+    return *this;
+  }
+};
+
 //! Mesh class
 //! \brief Base class that stores the information about meshes
 //! \details Mesh class which stores the particles, nodes, cells and neighbours
@@ -49,6 +113,12 @@ class Mesh {
   //! Return id of the mesh
   unsigned id() const { return id_; }
 
+  //! Return the arena of the nodes, cells and particles created by the mesh
+  const std::shared_ptr<Arena>& arena() const { return arena_; }
+
+  //! Return the memory footprint of the particles, nodes and cells
+  MeshFootprint footprint() const;
+
   //! Create nodes from coordinates
   //! \param[in] gnid Global node id
   //! \param[in] node_type Node type
@@ -70,7 +140,8 @@ class Mesh {
   //! Return the number of nodes
   mpm::Index nnodes() const { return nodes_.size(); }
 
-  //! Iterate over nodes
+  //! Iterate over nodes, whose kernels record failures in the step errors
+  //! of the mesh
   //! \tparam Toper Callable object typically a baseclass functor
   template <typename Toper>
   void iterate_over_nodes(Toper oper);
@@ -103,7 +174,8 @@ class Mesh {
   //! Number of cells in the mesh
   mpm::Index ncells() const { return cells_.size(); }
 
-  //! Iterate over cells
+  //! Iterate over cells, whose kernels record failures in the step errors
+  //! of the mesh
   //! \tparam Toper Callable object typically a baseclass functor
   template <typename Toper>
   void iterate_over_cells(Toper oper);
@@ -116,6 +188,23 @@ class Mesh {
   bool create_particles(mpm::Index gpid, const std::string& particle_type,
                         const std::vector<VectorDim>& coordinates);
 
+  //! Generate particles at the quadrature points of cells in parallel, the
+  //! volume of each particle is its share of the cell from the quadrature
+  //! weight. Particles are only generated in cells whose centroid lies in the
+  //! box, which covers the mesh by default.
+  //! \param[in] gpid Global id of the first particle
+  //! \param[in] particle_type Particle type
+  //! \param[in] nquadratures Number of quadrature points along each direction
+  //! \param[in] box_min Lower corner of the box
+  //! \param[in] box_max Upper corner of the box
+  //! \retval status Generate particle status
+  bool generate_particles(
+      mpm::Index gpid, const std::string& particle_type, unsigned nquadratures,
+      const VectorDim& box_min =
+          VectorDim::Constant(std::numeric_limits<double>::lowest()),
+      const VectorDim& box_max =
+          VectorDim::Constant(std::numeric_limits<double>::max()));
+
   //! Add a particle to the mesh
   //! \param[in] particle A shared pointer to particle
   //! \retval insertion_status Return the successful addition of a particle
@@ -130,24 +219,91 @@ class Mesh {
   //! Number of particles in the mesh
   mpm::Index nparticles() const { return particles_.size(); }
 
+  //! Return a view of a field of the particles in their order in the mesh,
+  //! which reads and writes the storage of the particles in place
+  //! \param[in] field Name of the field, e.g. coordinates or velocity
+  //! \param[in] phase Index corresponding to the phase
+  //! \retval view View of the field, empty if the field is unknown
+  mpm::FieldView particles_field(const std::string& field, unsigned phase);
+
+  //! Return a view of a field of the nodes in their order in the mesh,
+  //! which reads and writes the storage of the nodes in place
+  //! \param[in] field Name of the field, e.g. velocity or external_force
+  //! \param[in] phase Index corresponding to the phase
+  //! \retval view View of the field, empty if the field is unknown
+  mpm::FieldView nodes_field(const std::string& field, unsigned phase);
+
+  //! Return the critical time step of the mesh, the smallest critical time
+  //! step of its particles by a parallel reduction
+  //! \param[in] phase Index corresponding to the phase
+  double critical_time_step(unsigned phase) const;
+
+  //! Scale the inertial mass of particles whose critical time step is below
+  //! a target time step, which leaves the other particles unscaled
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] dt Target critical time step
+  //! \param[in] max_scale Maximum scale of the mass of a particle
+  //! \retval ratio Added mass as a ratio of the mass of the particles
+  double scale_mass(unsigned phase, double dt, double max_scale);
+
+  //! Return the out-of-balance force ratio of the active nodes, the norm of
+  //! their unbalanced forces over the norm of their external forces, in
+  //! which constrained directions are balanced
+  //! \param[in] phase Index corresponding to the phase
+  double unbalanced_force_ratio(unsigned phase) const;
+
+  //! Return the kinetic energy, momentum and maximum speed of the particles
+  //! by a parallel reduction
+  //! \param[in] phase Index corresponding to the phase
+  MeshDiagnostics<Tdim> diagnostics(unsigned phase) const;
+
   //! Locate particles in a cell
   //! Iterate over all cells in a mesh to find the cell in which particles
   //! are located.
   //! \retval particles Particles which cannot be located in the mesh
   std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> locate_particles_mesh();
 
-  //! Iterate over particles
+  //! Assign the particles in their order in the mesh to cells by id,
+  //! without searching for their locations in the mesh
+  //! \param[in] cell_ids Ids of the cells of the particles
+  //! \retval status Status of assigning the cells
+  bool assign_particles_cells(const std::vector<mpm::Index>& cell_ids);
+
+  //! Return the ids of the cells of the particles in their order in the mesh
+  std::vector<mpm::Index> particles_cells() const;
+
+  //! Locate a particle in its cell, or otherwise in the cells of the mesh
+  //! \param[in] particle Particle
+  //! \retval status Particle is located in a cell
+  bool locate_particle_cells(std::shared_ptr<mpm::ParticleBase<Tdim>> particle);
+
+  //! Iterate over particles, whose kernels record failures in the step
+  //! errors of the mesh
   //! \tparam Toper Callable object typically a baseclass functor
   template <typename Toper>
   void iterate_over_particles(Toper oper);
 
+  //! Return the counters of failures in the kernels of the mesh
+  mpm::StepErrors& step_errors() { return step_errors_; }
+
   //! Return coordinates of particles
   std::vector<Eigen::Matrix<double, 3, 1>> particle_coordinates();
 
+  //! Copy coordinates of particles to a buffer in parallel
+  //! \param[out] coordinates Buffer resized to the number of particles
+  void particle_coordinates(
+      std::vector<Eigen::Matrix<double, 3, 1>>& coordinates);
+
   //! Return particle stresses
   //! \param[in] phase Index corresponding to the phase
   std::vector<Eigen::Matrix<double, 3, 1>> particle_stresses(unsigned phase);
 
+  //! Copy particle stresses to a buffer in parallel
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[out] stresses Buffer resized to the number of particles
+  void particle_stresses(unsigned phase,
+                         std::vector<Eigen::Matrix<double, 3, 1>>& stresses);
+
   //! Assign velocity constraints
   //! \param[in] velocity_constraints Constraint at node, dir, and velocity
   bool assign_velocity_constraints(
@@ -175,15 +331,89 @@ class Mesh {
   //! \retval status Status of writing HDF5 output
   bool write_particles_hdf5(unsigned phase, const std::string& filename);
 
-  //! Read HDF5 particles
+  //! Copy particle data to a HDF5 buffer in parallel
   //! \param[in] phase Index corresponding to the phase
+  //! \param[out] particle_data Buffer resized to the number of particles
+  void particles_hdf5(unsigned phase, std::vector<HDF5Particle>& particle_data);
+
+  //! Copy particle data to columnar HDF5 buffers in parallel
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[out] columns Buffers resized to the number of particles
+  void particles_hdf5(unsigned phase, HDF5ParticleColumns& columns);
+
+  //! Write a buffer of HDF5 particle data as a table, does not access the mesh
+  //! \param[in] filename Name of HDF5 file to write particles data
+  //! \param[in] particle_data HDF5 data of particles
+  //! \param[in] options Chunk size and compression of the table
+  //! \retval status Status of writing HDF5 output
+  static bool write_particles_hdf5(
+      const std::string& filename,
+      const std::vector<HDF5Particle>& particle_data,
+      const HDF5Options& options = HDF5Options());
+
+  //! Write columnar HDF5 particle data, one dataset per field
   //! \param[in] filename Name of HDF5 file to write particles data
+  //! \param[in] columns HDF5 data of particles
+  //! \param[in] options Chunk size and filters of the datasets
+  //! \retval status Status of writing HDF5 output
+  static bool write_particles_hdf5(const std::string& filename,
+                                   const HDF5ParticleColumns& columns,
+                                   const HDF5Options& options);
+
+  //! Read HDF5 particles written as a table or as columns
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] filename Name of HDF5 file to write particles data
+  //! \param[in] group Group of the particles, i.e., step of a time series
   //! \retval status Status of reading HDF5 output
-  bool read_particles_hdf5(unsigned phase, const std::string& filename);
+  bool read_particles_hdf5(unsigned phase, const std::string& filename,
+                           const std::string& group = "/");
+
+  //! Copy the complete state of particles to a checkpoint buffer in parallel
+  //! \param[out] particles Checkpoint state of particles
+  void particles_checkpoint(std::vector<CheckpointParticle>& particles);
+
+  //! Create particles from the state in a checkpoint in a mesh without
+  //! particles, which are assigned to their stored cells without searching
+  //! for particles in the mesh
+  //! \param[in] particle_type Particle type
+  //! \param[in] particles Checkpoint state of particles
+  //! \param[in] nparticles Number of particles in the checkpoint
+  //! \param[in] materials Materials of the analysis
+  //! \retval status Status of creating particles
+  bool create_particles_checkpoint(
+      const std::string& particle_type, const CheckpointParticle* particles,
+      mpm::Index nparticles,
+      const std::map<unsigned, std::shared_ptr<mpm::Material<Tdim>>>&
+          materials);
+
+  //! Restore particles from the state in a checkpoint, cells and materials
+  //! are assigned by id without searching for particles in the mesh
+  //! \param[in] particles Checkpoint state of particles
+  //! \param[in] nparticles Number of particles in the checkpoint
+  //! \param[in] materials Materials of the analysis
+  //! \retval status Status of restoring particles
+  bool restore_particles_checkpoint(
+      const CheckpointParticle* particles, mpm::Index nparticles,
+      const std::map<unsigned, std::shared_ptr<mpm::Material<Tdim>>>&
+          materials);
 
  private:
-  // Locate a particle in mesh cells
-  bool locate_particle_cells(std::shared_ptr<mpm::ParticleBase<Tdim>> particle);
+  //! Return a view of a field of the entities of a container
+  //! \param[in] entities Container of particles or nodes
+  //! \param[in] field Name of the field
+  //! \param[in] phase Index corresponding to the phase
+  //! \tparam Tentity Type of the entities
+  template <typename Tentity>
+  mpm::FieldView field_view(const Container<Tentity>& entities,
+                            const std::string& field, unsigned phase);
+
+  //! Return quadrature points and weights of the unit cell
+  //! \param[in] nquadratures Number of quadrature points along each direction
+  //! \param[out] xi Local coordinates of quadrature points
+  //! \param[out] weights Weights of quadrature points
+  static void quadratures(unsigned nquadratures, Eigen::MatrixXd& xi,
+                          Eigen::VectorXd& weights);
+
   //! mesh id
   unsigned id_{std::numeric_limits<unsigned>::max()};
   //! Container of mesh neighbours
@@ -196,6 +426,11 @@ class Mesh {
   Map<NodeBase<Tdim>> map_nodes_;
   //! Container of cells
   Container<Cell<Tdim>> cells_;
+  //! Arena of the nodes, cells and particles created by the mesh, which is
+  //! released when the mesh and all its entities are destroyed
+  std::shared_ptr<Arena> arena_;
+  //! Counters of failures in the kernels of the iterations of the mesh
+  mpm::StepErrors step_errors_;
   //! Logger
   std::unique_ptr<spdlog::logger> console_;
 };  // Mesh class
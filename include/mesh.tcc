@@ -1,6 +1,7 @@
 // Constructor with id
 template <unsigned Tdim>
-mpm::Mesh<Tdim>::Mesh(unsigned id) : id_{id} {
+mpm::Mesh<Tdim>::Mesh(unsigned id)
+    : id_{id}, arena_{std::make_shared<mpm::Arena>()} {
   // Check if the dimension is between 1 & 3
   static_assert((Tdim >= 1 && Tdim <= 3), "Invalid global dimension");
   //! Logger
@@ -25,7 +26,7 @@ bool mpm::Mesh<Tdim>::create_nodes(mpm::Index gnid,
             // Create a node of particular
             Factory<mpm::NodeBase<Tdim>, mpm::Index,
                     const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                ->create(node_type, static_cast<mpm::Index>(gnid),
+                ->create(node_type, arena_, static_cast<mpm::Index>(gnid),
                          node_coordinates));
 
         // Increament node id
@@ -67,13 +68,19 @@ bool mpm::Mesh<Tdim>::remove_node(
 template <unsigned Tdim>
 template <typename Toper>
 void mpm::Mesh<Tdim>::iterate_over_nodes(Toper oper) {
-  tbb::parallel_for_each(nodes_.cbegin(), nodes_.cend(), oper);
+  tbb::parallel_for_each(
+      nodes_.cbegin(), nodes_.cend(),
+      [this, &oper](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+        mpm::StepErrors::Scope scope(&step_errors_);
+        oper(node);
+      });
 }
 
 //! Iterate over nodes
 template <unsigned Tdim>
 template <typename Toper, typename Tpred>
 void mpm::Mesh<Tdim>::iterate_over_nodes_predicate(Toper oper, Tpred pred) {
+  mpm::StepErrors::Scope scope(&step_errors_);
   for (auto itr = nodes_.cbegin(); itr != nodes_.cend(); ++itr) {
     if (pred(*itr)) oper(*itr);
   }
@@ -90,8 +97,9 @@ bool mpm::Mesh<Tdim>::create_cells(
     if (!cells.empty()) {
       for (const auto& nodes : cells) {
         // Create cell with element
-        auto cell =
-            std::make_shared<mpm::Cell<Tdim>>(gcid, nodes.size(), element);
+        auto cell = std::allocate_shared<mpm::Cell<Tdim>>(
+            mpm::ArenaAllocator<mpm::Cell<Tdim>>(arena_), gcid, nodes.size(),
+            element);
 
         // Cell local node id
         unsigned local_nid = 0;
@@ -149,7 +157,12 @@ bool mpm::Mesh<Tdim>::remove_cell(
 template <unsigned Tdim>
 template <typename Toper>
 void mpm::Mesh<Tdim>::iterate_over_cells(Toper oper) {
-  tbb::parallel_for_each(cells_.cbegin(), cells_.cend(), oper);
+  tbb::parallel_for_each(
+      cells_.cbegin(), cells_.cend(),
+      [this, &oper](const std::shared_ptr<mpm::Cell<Tdim>>& cell) {
+        mpm::StepErrors::Scope scope(&step_errors_);
+        oper(cell);
+      });
 }
 
 //! Create particles from coordinates
@@ -166,7 +179,7 @@ bool mpm::Mesh<Tdim>::create_particles(
         bool insert_status = this->add_particle(
             Factory<mpm::ParticleBase<Tdim>, mpm::Index,
                     const Eigen::Matrix<double, Tdim, 1>&>::instance()
-                ->create(particle_type, static_cast<mpm::Index>(gpid),
+                ->create(particle_type, arena_, static_cast<mpm::Index>(gpid),
                          particle_coordinates));
 
         // Increament particle id
@@ -186,6 +199,123 @@ bool mpm::Mesh<Tdim>::create_particles(
   return status;
 }
 
+//! Generate particles at quadrature points of cells
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::generate_particles(mpm::Index gpid,
+                                         const std::string& particle_type,
+                                         unsigned nquadratures,
+                                         const VectorDim& box_min,
+                                         const VectorDim& box_max) {
+  bool status = true;
+  try {
+    // Quadrature points and weights of the unit cell
+    Eigen::MatrixXd xis;
+    Eigen::VectorXd weights;
+    this->quadratures(nquadratures, xis, weights);
+    const unsigned npoints = weights.size();
+
+    // Cells whose centroid lies in the box
+    std::vector<std::shared_ptr<mpm::Cell<Tdim>>> cells;
+    for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
+      const VectorDim centroid = (*citr)->centroid();
+      if ((centroid.array() >= box_min.array()).all() &&
+          (centroid.array() <= box_max.array()).all())
+        cells.emplace_back(*citr);
+    }
+    if (cells.empty())
+      throw std::runtime_error("No cells to generate particles in");
+
+    // Particles of a cell are created by one task, as a cell's list of
+    // particles isn't thread safe, and are placed in the cell without search
+    std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> particles(
+        cells.size() * npoints);
+    std::atomic<bool> cell_status{true};
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0, cells.size()),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          for (std::size_t c = range.begin(); c != range.end(); ++c) {
+            const auto& cell = cells[c];
+            const auto element = cell->element_ptr();
+            const Eigen::MatrixXd nodal_coordinates = cell->nodal_coordinates();
+            for (unsigned q = 0; q < npoints; ++q) {
+              const VectorDim xi = xis.row(q).transpose();
+              const VectorDim coordinates =
+                  nodal_coordinates.transpose() * element->shapefn(xi);
+              const std::size_t index = c * npoints + q;
+
+              auto particle =
+                  Factory<mpm::ParticleBase<Tdim>, mpm::Index,
+                          const Eigen::Matrix<double, Tdim, 1>&>::instance()
+                      ->create(particle_type, arena_,
+                               static_cast<mpm::Index>(gpid + index),
+                               coordinates);
+              if (!particle->assign_cell_xi(cell, xi)) cell_status = false;
+              // Volume of the cell at the quadrature point
+              const double detj =
+                  element->jacobian(xi, nodal_coordinates).determinant();
+              particle->assign_volume(weights(q) * std::fabs(detj));
+              particles[index] = particle;
+            }
+          }
+        });
+    if (!cell_status)
+      throw std::runtime_error("Generated particle is not assigned to cell");
+
+    // Ids are unique by construction, so duplicates aren't searched for
+    for (const auto& particle : particles) particles_.add(particle, false);
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    status = false;
+  }
+  return status;
+}
+
+//! Return quadrature points and weights of a quadrilateral
+template <>
+inline void mpm::Mesh<2>::quadratures(unsigned nquadratures,
+                                      Eigen::MatrixXd& xi,
+                                      Eigen::VectorXd& weights) {
+  switch (nquadratures) {
+    case 1:
+      xi = mpm::QuadrilateralQuadrature<2, 1>().quadratures();
+      weights = mpm::QuadrilateralQuadrature<2, 1>().weights();
+      break;
+    case 2:
+      xi = mpm::QuadrilateralQuadrature<2, 4>().quadratures();
+      weights = mpm::QuadrilateralQuadrature<2, 4>().weights();
+      break;
+    case 3:
+      xi = mpm::QuadrilateralQuadrature<2, 9>().quadratures();
+      weights = mpm::QuadrilateralQuadrature<2, 9>().weights();
+      break;
+    default:
+      throw std::runtime_error("Invalid number of quadratures");
+  }
+}
+
+//! Return quadrature points and weights of a hexahedron
+template <>
+inline void mpm::Mesh<3>::quadratures(unsigned nquadratures,
+                                      Eigen::MatrixXd& xi,
+                                      Eigen::VectorXd& weights) {
+  switch (nquadratures) {
+    case 1:
+      xi = mpm::HexahedronQuadrature<3, 1>().quadratures();
+      weights = mpm::HexahedronQuadrature<3, 1>().weights();
+      break;
+    case 2:
+      xi = mpm::HexahedronQuadrature<3, 8>().quadratures();
+      weights = mpm::HexahedronQuadrature<3, 8>().weights();
+      break;
+    case 3:
+      xi = mpm::HexahedronQuadrature<3, 27>().quadratures();
+      weights = mpm::HexahedronQuadrature<3, 27>().weights();
+      break;
+    default:
+      throw std::runtime_error("Invalid number of quadratures");
+  }
+}
+
 //! Add a particle pointer to the mesh
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::add_particle(
@@ -223,6 +353,7 @@ std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>>
   tbb::parallel_for_each(
       particles_.cbegin(), particles_.cend(),
       [=, &particles](std::shared_ptr<mpm::ParticleBase<Tdim>> particle) {
+        mpm::StepErrors::Scope scope(&step_errors_);
         // If particle is not found in mesh add to a list of particles
         if (!this->locate_particle_cells(particle))
           // Needs a lock guard here
@@ -232,6 +363,36 @@ std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>>
   return particles;
 }
 
+//! Assign the particles to cells by id
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::assign_particles_cells(
+    const std::vector<mpm::Index>& cell_ids) {
+  if (cell_ids.size() != particles_.size()) return false;
+
+  std::unordered_map<mpm::Index, std::shared_ptr<mpm::Cell<Tdim>>> cells;
+  cells.reserve(cells_.size());
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
+    cells.emplace((*citr)->id(), *citr);
+
+  // Assign cells serially, as a cell's list of particles isn't thread safe
+  for (mpm::Index i = 0; i < cell_ids.size(); ++i) {
+    const auto citr = cells.find(cell_ids[i]);
+    if (citr == cells.end() || !particles_[i]->assign_cell(citr->second))
+      return false;
+  }
+  return true;
+}
+
+//! Return the ids of the cells of the particles
+template <unsigned Tdim>
+std::vector<mpm::Index> mpm::Mesh<Tdim>::particles_cells() const {
+  std::vector<mpm::Index> cell_ids;
+  cell_ids.reserve(particles_.size());
+  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr)
+    cell_ids.emplace_back((*pitr)->cell_id());
+  return cell_ids;
+}
+
 //! Locate particles in a cell
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::locate_particle_cells(
@@ -260,7 +421,136 @@ bool mpm::Mesh<Tdim>::locate_particle_cells(
 template <unsigned Tdim>
 template <typename Toper>
 void mpm::Mesh<Tdim>::iterate_over_particles(Toper oper) {
-  tbb::parallel_for_each(particles_.cbegin(), particles_.cend(), oper);
+  tbb::parallel_for_each(
+      particles_.cbegin(), particles_.cend(),
+      [this, &oper](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        mpm::StepErrors::Scope scope(&step_errors_);
+        oper(particle);
+      });
+}
+
+//! Return a view of a field of the particles
+template <unsigned Tdim>
+mpm::FieldView mpm::Mesh<Tdim>::particles_field(const std::string& field,
+                                                unsigned phase) {
+  return this->field_view(particles_, field, phase);
+}
+
+//! Return a view of a field of the nodes
+template <unsigned Tdim>
+mpm::FieldView mpm::Mesh<Tdim>::nodes_field(const std::string& field,
+                                            unsigned phase) {
+  return this->field_view(nodes_, field, phase);
+}
+
+//! Return a view of a field of the entities of a container
+template <unsigned Tdim>
+template <typename Tentity>
+mpm::FieldView mpm::Mesh<Tdim>::field_view(const Container<Tentity>& entities,
+                                           const std::string& field,
+                                           unsigned phase) {
+  // Spans into the storage of the entities, without copying their fields
+  std::vector<mpm::FieldSpan> spans(entities.size());
+  std::atomic<bool> known{true};
+  tbb::parallel_for(std::size_t(0), entities.size(), [&](std::size_t i) {
+    spans[i] = entities[i]->field(field, phase);
+    if (spans[i].data == nullptr) known = false;
+  });
+  if (!known) {
+    console_->error("Unknown field {} of phase {}", field, phase);
+    return mpm::FieldView();
+  }
+  return mpm::FieldView(std::move(spans));
+}
+
+//! Return the critical time step of the mesh
+template <unsigned Tdim>
+double mpm::Mesh<Tdim>::critical_time_step(unsigned phase) const {
+  return tbb::parallel_reduce(
+      tbb::blocked_range<std::size_t>(0, particles_.size()),
+      std::numeric_limits<double>::max(),
+      [&](const tbb::blocked_range<std::size_t>& range, double dt) {
+        for (std::size_t i = range.begin(); i != range.end(); ++i)
+          dt = std::min(dt, particles_[i]->critical_time_step(phase));
+        return dt;
+      },
+      [](double lhs, double rhs) { return std::min(lhs, rhs); });
+}
+
+//! Scale the inertial mass of particles to a target critical time step
+template <unsigned Tdim>
+double mpm::Mesh<Tdim>::scale_mass(unsigned phase, double dt,
+                                   double max_scale) {
+  // Mass and added mass of the particles
+  const Eigen::Vector2d mass = tbb::parallel_reduce(
+      tbb::blocked_range<std::size_t>(0, particles_.size()),
+      Eigen::Vector2d::Zero().eval(),
+      [&](const tbb::blocked_range<std::size_t>& range, Eigen::Vector2d mass) {
+        for (std::size_t i = range.begin(); i != range.end(); ++i) {
+          const double scale = particles_[i]->scale_mass(phase, dt, max_scale);
+          mass(0) += particles_[i]->mass(phase);
+          mass(1) += (scale - 1.) * particles_[i]->mass(phase);
+        }
+        return mass;
+      },
+      [](const Eigen::Vector2d& lhs, const Eigen::Vector2d& rhs) {
+        return (lhs + rhs).eval();
+      });
+  return mass(0) > 0. ? mass(1) / mass(0) : 0.;
+}
+
+//! Return the out-of-balance force ratio of the active nodes
+template <unsigned Tdim>
+double mpm::Mesh<Tdim>::unbalanced_force_ratio(unsigned phase) const {
+  // Squared norms of the unbalanced and external forces
+  const Eigen::Vector2d forces = tbb::parallel_reduce(
+      tbb::blocked_range<std::size_t>(0, nodes_.size()),
+      Eigen::Vector2d::Zero().eval(),
+      [&](const tbb::blocked_range<std::size_t>& range,
+          Eigen::Vector2d forces) {
+        for (std::size_t i = range.begin(); i != range.end(); ++i) {
+          if (!nodes_[i]->status()) continue;
+          Eigen::Matrix<double, Tdim, 1> unbalanced =
+              nodes_[i]->external_force(phase) +
+              nodes_[i]->internal_force(phase);
+          // Constrained directions are balanced by their reactions
+          for (const auto& constraint : nodes_[i]->velocity_constraints())
+            if (constraint.first / Tdim == phase)
+              unbalanced(constraint.first % Tdim) = 0.;
+          forces(0) += unbalanced.squaredNorm();
+          forces(1) += nodes_[i]->external_force(phase).squaredNorm();
+        }
+        return forces;
+      },
+      [](const Eigen::Vector2d& lhs, const Eigen::Vector2d& rhs) {
+        return (lhs + rhs).eval();
+      });
+  return forces(1) > 0. ? std::sqrt(forces(0) / forces(1)) : 0.;
+}
+
+//! Return the kinetic energy, momentum and maximum speed of the particles
+template <unsigned Tdim>
+mpm::MeshDiagnostics<Tdim> mpm::Mesh<Tdim>::diagnostics(unsigned phase) const {
+  // Velocities are read in place, as a copy of dynamic size allocates
+  const std::string velocity_field = "velocity";
+  return tbb::parallel_reduce(
+      tbb::blocked_range<std::size_t>(0, particles_.size()),
+      mpm::MeshDiagnostics<Tdim>(),
+      [&](const tbb::blocked_range<std::size_t>& range,
+          mpm::MeshDiagnostics<Tdim> diagnostics) {
+        for (std::size_t i = range.begin(); i != range.end(); ++i) {
+          const double mass = particles_[i]->mass(phase);
+          const Eigen::Map<const Eigen::Matrix<double, Tdim, 1>> velocity(
+              particles_[i]->field(velocity_field, phase).data);
+          diagnostics.kinetic_energy += 0.5 * mass * velocity.squaredNorm();
+          diagnostics.momentum += mass * velocity;
+          diagnostics.max_velocity =
+              std::max(diagnostics.max_velocity, velocity.norm());
+        }
+        return diagnostics;
+      },
+      [](mpm::MeshDiagnostics<Tdim> lhs,
+         const mpm::MeshDiagnostics<Tdim>& rhs) { return lhs += rhs; });
 }
 
 //! Add a neighbour mesh, using the local id of the mesh and a mesh pointer
@@ -286,33 +576,57 @@ template <unsigned Tdim>
 std::vector<Eigen::Matrix<double, 3, 1>>
     mpm::Mesh<Tdim>::particle_coordinates() {
   std::vector<Eigen::Matrix<double, 3, 1>> particle_coordinates;
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
-    Eigen::Vector3d coordinates;
-    coordinates.setZero();
-    auto pcoords = (*pitr)->coordinates();
-    // Fill coordinates to the size of dimensions
-    for (unsigned i = 0; i < Tdim; ++i) coordinates(i) = pcoords(i);
-    particle_coordinates.emplace_back(coordinates);
-  }
+  this->particle_coordinates(particle_coordinates);
   return particle_coordinates;
 }
 
+//! Copy particle coordinates to a buffer
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::particle_coordinates(
+    std::vector<Eigen::Matrix<double, 3, 1>>& coordinates) {
+  const mpm::Index nparticles = this->nparticles();
+  coordinates.resize(nparticles);
+
+  tbb::parallel_for(
+      tbb::blocked_range<mpm::Index>(0, nparticles),
+      [&](const tbb::blocked_range<mpm::Index>& range) {
+        for (mpm::Index i = range.begin(); i != range.end(); ++i) {
+          coordinates[i].setZero();
+          const auto pcoords = particles_[i]->coordinates();
+          // Fill coordinates to the size of dimensions
+          for (unsigned j = 0; j < Tdim; ++j) coordinates[i](j) = pcoords(j);
+        }
+      });
+}
+
 //! Return particle stresses
 template <unsigned Tdim>
 std::vector<Eigen::Matrix<double, 3, 1>> mpm::Mesh<Tdim>::particle_stresses(
     unsigned phase) {
   std::vector<Eigen::Matrix<double, 3, 1>> particle_stresses;
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
-    Eigen::Vector3d stresses;
-    stresses.setZero();
-    auto pstress = (*pitr)->stress(phase);
-    // Fill stresses to the size of dimensions
-    for (unsigned i = 0; i < Tdim; ++i) stresses(i) = pstress(i);
-    particle_stresses.emplace_back(stresses);
-  }
+  this->particle_stresses(phase, particle_stresses);
   return particle_stresses;
 }
 
+//! Copy particle stresses to a buffer
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::particle_stresses(
+    unsigned phase, std::vector<Eigen::Matrix<double, 3, 1>>& stresses) {
+  const mpm::Index nparticles = this->nparticles();
+  stresses.resize(nparticles);
+
+  tbb::parallel_for(
+      tbb::blocked_range<mpm::Index>(0, nparticles),
+      [&](const tbb::blocked_range<mpm::Index>& range) {
+        for (mpm::Index i = range.begin(); i != range.end(); ++i) {
+          stresses[i].setZero();
+          const auto pstress = particles_[i]->stress(phase);
+          // Fill stresses to the size of dimensions
+          for (unsigned j = 0; j < Tdim; ++j) stresses[i](j) = pstress(j);
+        }
+      });
+}
+
 //! Assign velocity constraints
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::assign_velocity_constraints(
@@ -351,60 +665,138 @@ bool mpm::Mesh<Tdim>::assign_velocity_constraints(
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::write_particles_hdf5(unsigned phase,
                                            const std::string& filename) {
-  const unsigned nparticles = this->nparticles();
-
-  std::vector<HDF5Particle> particle_data;  // = new HDF5Particle[nparticles];
-  particle_data.reserve(nparticles);
-
-  mpm::Index i = 0;
-  for (auto pitr = particles_.cbegin(); pitr != particles_.cend(); ++pitr) {
-
-    Eigen::Vector3d coordinates;
-    coordinates.setZero();
-    Eigen::VectorXd coords = (*pitr)->coordinates();
-    for (unsigned j = 0; j < Tdim; ++j) coordinates[j] = coords[j];
-
-    Eigen::Vector3d velocity;
-    velocity.setZero();
-    for (unsigned j = 0; j < Tdim; ++j)
-      velocity[j] = (*pitr)->velocity(phase)[j];
-
-    Eigen::Matrix<double, 6, 1> stress = (*pitr)->stress(phase);
-
-    Eigen::Matrix<double, 6, 1> strain = (*pitr)->strain(phase);
-
-    particle_data[i].id = (*pitr)->id();
-    particle_data[i].mass = (*pitr)->mass(phase);
+  std::vector<HDF5Particle> particle_data;
+  this->particles_hdf5(phase, particle_data);
+  return write_particles_hdf5(filename, particle_data);
+}
 
-    particle_data[i].coord_x = coordinates[0];
-    particle_data[i].coord_y = coordinates[1];
-    particle_data[i].coord_z = coordinates[2];
+//! Copy particle data to a HDF5 buffer
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::particles_hdf5(unsigned phase,
+                                     std::vector<HDF5Particle>& particle_data) {
+  const mpm::Index nparticles = this->nparticles();
+  particle_data.resize(nparticles);
+
+  tbb::parallel_for(
+      tbb::blocked_range<mpm::Index>(0, nparticles),
+      [&](const tbb::blocked_range<mpm::Index>& range) {
+        for (mpm::Index i = range.begin(); i != range.end(); ++i) {
+          const auto& particle = particles_[i];
+
+          Eigen::Vector3d coordinates;
+          coordinates.setZero();
+          const VectorDim coords = particle->coordinates();
+          for (unsigned j = 0; j < Tdim; ++j) coordinates[j] = coords[j];
+
+          Eigen::Vector3d velocity;
+          velocity.setZero();
+          const Eigen::VectorXd pvelocity = particle->velocity(phase);
+          for (unsigned j = 0; j < Tdim; ++j) velocity[j] = pvelocity[j];
+
+          const Eigen::Matrix<double, 6, 1> stress = particle->stress(phase);
+
+          const Eigen::Matrix<double, 6, 1> strain = particle->strain(phase);
+
+          particle_data[i].id = particle->id();
+          particle_data[i].mass = particle->mass(phase);
+
+          particle_data[i].coord_x = coordinates[0];
+          particle_data[i].coord_y = coordinates[1];
+          particle_data[i].coord_z = coordinates[2];
+
+          particle_data[i].velocity_x = velocity[0];
+          particle_data[i].velocity_y = velocity[1];
+          particle_data[i].velocity_z = velocity[2];
+
+          particle_data[i].stress_xx = stress[0];
+          particle_data[i].stress_yy = stress[1];
+          particle_data[i].stress_zz = stress[2];
+          particle_data[i].tau_xy = stress[3];
+          particle_data[i].tau_yz = stress[4];
+          particle_data[i].tau_xz = stress[5];
+
+          particle_data[i].strain_xx = strain[0];
+          particle_data[i].strain_yy = strain[1];
+          particle_data[i].strain_zz = strain[2];
+          particle_data[i].gamma_xy = strain[3];
+          particle_data[i].gamma_yz = strain[4];
+          particle_data[i].gamma_xz = strain[5];
+
+          particle_data[i].epsilon_v =
+              particle->volumetric_strain_centroid(phase);
+
+          particle_data[i].status = particle->status();
+        }
+      });
+}
 
-    particle_data[i].velocity_x = velocity[0];
-    particle_data[i].velocity_y = velocity[1];
-    particle_data[i].velocity_z = velocity[2];
+//! Copy particle data to columnar HDF5 buffers
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::particles_hdf5(unsigned phase,
+                                     HDF5ParticleColumns& columns) {
+  const mpm::Index nparticles = this->nparticles();
+  columns.resize(nparticles);
+
+  const unsigned nvector = HDF5ParticleColumns::Nvector;
+  const unsigned ntensor = HDF5ParticleColumns::Ntensor;
+
+  tbb::parallel_for(
+      tbb::blocked_range<mpm::Index>(0, nparticles),
+      [&](const tbb::blocked_range<mpm::Index>& range) {
+        for (mpm::Index i = range.begin(); i != range.end(); ++i) {
+          const auto& particle = particles_[i];
+
+          columns.id[i] = particle->id();
+          columns.mass[i] = particle->mass(phase);
+
+          // Vectors are padded with zeros to 3 components
+          const VectorDim coords = particle->coordinates();
+          const Eigen::VectorXd velocity = particle->velocity(phase);
+          for (unsigned j = 0; j < nvector; ++j) {
+            columns.coordinates[i * nvector + j] = (j < Tdim) ? coords(j) : 0.;
+            columns.velocities[i * nvector + j] =
+                (j < Tdim) ? velocity(j) : 0.;
+          }
+
+          const Eigen::Matrix<double, 6, 1> stress = particle->stress(phase);
+          const Eigen::Matrix<double, 6, 1> strain = particle->strain(phase);
+          for (unsigned j = 0; j < ntensor; ++j) {
+            columns.stresses[i * ntensor + j] = stress(j);
+            columns.strains[i * ntensor + j] = strain(j);
+          }
+
+          columns.volumetric_strains[i] =
+              particle->volumetric_strain_centroid(phase);
+          columns.status[i] = particle->status();
+        }
+      });
+}
 
-    particle_data[i].stress_xx = stress[0];
-    particle_data[i].stress_yy = stress[1];
-    particle_data[i].stress_zz = stress[2];
-    particle_data[i].tau_xy = stress[3];
-    particle_data[i].tau_yz = stress[4];
-    particle_data[i].tau_xz = stress[5];
+//! Write columnar HDF5 particle data
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::write_particles_hdf5(const std::string& filename,
+                                           const HDF5ParticleColumns& columns,
+                                           const HDF5Options& options) {
+  // Create a new file using default properties.
+  hid_t file_id =
+      H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+  // Return if the file can't be created
+  if (file_id < 0) return false;
 
-    particle_data[i].strain_xx = strain[0];
-    particle_data[i].strain_yy = strain[1];
-    particle_data[i].strain_zz = strain[2];
-    particle_data[i].gamma_xy = strain[3];
-    particle_data[i].gamma_yz = strain[4];
-    particle_data[i].gamma_xz = strain[5];
+  // One dataset per field
+  const bool status = write_hdf5_particles(file_id, columns, options);
 
-    particle_data[i].epsilon_v = (*pitr)->volumetric_strain_centroid(phase);
+  H5Fclose(file_id);
+  return status;
+}
 
-    particle_data[i].status = (*pitr)->status();
+//! Write a buffer of HDF5 particle data
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::write_particles_hdf5(
+    const std::string& filename, const std::vector<HDF5Particle>& particle_data,
+    const HDF5Options& options) {
+  const mpm::Index nparticles = particle_data.size();
 
-    // Counter
-    ++i;
-  }
   // Calculate the size and the offsets of our struct members in memory
   const hsize_t NRECORDS = nparticles;
 
@@ -450,9 +842,9 @@ bool mpm::Mesh<Tdim>::write_particles_hdf5(unsigned phase,
   hid_t field_type[NFIELDS];
   hid_t string_type;
   hid_t file_id;
-  hsize_t chunk_size = 10000;
+  hsize_t chunk_size = options.chunk_size;
   int* fill_data = NULL;
-  int compress = 0;
+  int compress = (options.compression > 0) ? 1 : 0;
 
   // Initialize the field_type
   field_type[0] = H5T_NATIVE_LLONG;
@@ -482,6 +874,9 @@ bool mpm::Mesh<Tdim>::write_particles_hdf5(unsigned phase,
   file_id =
       H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
 
+  // Return if the file can't be created
+  if (file_id < 0) return false;
+
   // make a table
   H5TBmake_table("Table Title", file_id, "table", NFIELDS, NRECORDS, dst_size,
                  field_names, dst_offset, field_type, chunk_size, fill_data,
@@ -494,7 +889,8 @@ bool mpm::Mesh<Tdim>::write_particles_hdf5(unsigned phase,
 //! Write particles to HDF5
 template <unsigned Tdim>
 bool mpm::Mesh<Tdim>::read_particles_hdf5(unsigned phase,
-                                          const std::string& filename) {
+                                          const std::string& filename,
+                                          const std::string& group) {
 
   // Create a new file using default properties.
   hid_t file_id = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
@@ -505,6 +901,66 @@ bool mpm::Mesh<Tdim>::read_particles_hdf5(unsigned phase,
   const unsigned nparticles = this->nparticles();
   const hsize_t NRECORDS = nparticles;
 
+  // Output step of a time-series file
+  hid_t group_id = H5Gopen2(file_id, group.c_str(), H5P_DEFAULT);
+  if (group_id < 0) {
+    H5Fclose(file_id);
+    throw std::runtime_error("HDF5 particle group is not found: " + group);
+  }
+
+  // Columnar layout has one dataset per field instead of a table
+  if (H5Lexists(group_id, "table", H5P_DEFAULT) <= 0) {
+    HDF5ParticleColumns columns;
+    const bool status = read_hdf5_particles(group_id, NRECORDS, columns);
+    // close the file
+    H5Gclose(group_id);
+    H5Fclose(file_id);
+
+    if (!status)
+      throw std::runtime_error("HDF5 particle columns are invalid");
+
+    const unsigned nvector = HDF5ParticleColumns::Nvector;
+    const unsigned ntensor = HDF5ParticleColumns::Ntensor;
+
+    tbb::parallel_for(
+        tbb::blocked_range<mpm::Index>(0, nparticles),
+        [&](const tbb::blocked_range<mpm::Index>& range) {
+          for (mpm::Index i = range.begin(); i != range.end(); ++i) {
+            const double* coords = &columns.coordinates[i * nvector];
+            const double* velocity = &columns.velocities[i * nvector];
+            const double* stress = &columns.stresses[i * ntensor];
+            const double* strain = &columns.strains[i * ntensor];
+
+            HDF5Particle particle;
+            particle.id = columns.id[i];
+            particle.mass = columns.mass[i];
+            particle.coord_x = coords[0];
+            particle.coord_y = coords[1];
+            particle.coord_z = coords[2];
+            particle.velocity_x = velocity[0];
+            particle.velocity_y = velocity[1];
+            particle.velocity_z = velocity[2];
+            particle.stress_xx = stress[0];
+            particle.stress_yy = stress[1];
+            particle.stress_zz = stress[2];
+            particle.tau_xy = stress[3];
+            particle.tau_yz = stress[4];
+            particle.tau_xz = stress[5];
+            particle.strain_xx = strain[0];
+            particle.strain_yy = strain[1];
+            particle.strain_zz = strain[2];
+            particle.gamma_xy = strain[3];
+            particle.gamma_yz = strain[4];
+            particle.gamma_xz = strain[5];
+            particle.epsilon_v = columns.volumetric_strains[i];
+            particle.status = columns.status[i];
+            // Initialise particle with HDF5 data
+            particles_[i]->initialise_particle(particle);
+          }
+        });
+    return true;
+  }
+
   const hsize_t NFIELDS = 22;
 
   size_t dst_size = sizeof(HDF5Particle);
@@ -540,9 +996,9 @@ bool mpm::Mesh<Tdim>::read_particles_hdf5(unsigned phase,
   };
 
   std::vector<HDF5Particle> dst_buf;
-  dst_buf.reserve(nparticles);
+  dst_buf.resize(nparticles);
   // Read the table
-  H5TBread_table(file_id, "table", dst_size, dst_offset, dst_sizes,
+  H5TBread_table(group_id, "table", dst_size, dst_offset, dst_sizes,
                  dst_buf.data());
 
   unsigned i = 0;
@@ -553,6 +1009,144 @@ bool mpm::Mesh<Tdim>::read_particles_hdf5(unsigned phase,
     ++i;
   }
   // close the file
+  H5Gclose(group_id);
   H5Fclose(file_id);
   return true;
 }
+
+//! Copy the complete state of particles to a checkpoint buffer
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::particles_checkpoint(
+    std::vector<CheckpointParticle>& particles) {
+  const mpm::Index nparticles = this->nparticles();
+  particles.resize(nparticles);
+
+  tbb::parallel_for(tbb::blocked_range<mpm::Index>(0, nparticles),
+                    [&](const tbb::blocked_range<mpm::Index>& range) {
+                      for (mpm::Index i = range.begin(); i != range.end(); ++i)
+                        particles_[i]->checkpoint_particle(particles[i]);
+                    });
+}
+
+//! Restore particles from the state in a checkpoint
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::restore_particles_checkpoint(
+    const CheckpointParticle* particles, mpm::Index nparticles,
+    const std::map<unsigned, std::shared_ptr<mpm::Material<Tdim>>>&
+        materials) {
+  if (nparticles != this->nparticles())
+    throw std::runtime_error(
+        "Number of particles in checkpoint doesn't match the mesh");
+
+  // Particles are matched by id, they needn't be in the same order
+  std::unordered_map<mpm::Index, mpm::Index> particle_index;
+  particle_index.reserve(nparticles);
+  for (mpm::Index i = 0; i < nparticles; ++i)
+    particle_index.emplace(particles_[i]->id(), i);
+
+  // Cells are found by id instead of searching for particle locations
+  std::unordered_map<mpm::Index, std::shared_ptr<mpm::Cell<Tdim>>> cells;
+  cells.reserve(cells_.size());
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
+    cells.emplace((*citr)->id(), *citr);
+
+  // Restore state and materials in parallel
+  std::atomic<bool> status{true};
+  tbb::parallel_for(
+      tbb::blocked_range<mpm::Index>(0, nparticles),
+      [&](const tbb::blocked_range<mpm::Index>& range) {
+        for (mpm::Index i = range.begin(); i != range.end(); ++i) {
+          const auto pitr = particle_index.find(particles[i].id);
+          if (pitr == particle_index.end()) {
+            status = false;
+            continue;
+          }
+          const auto& particle = particles_[pitr->second];
+          particle->initialise_particle(particles[i]);
+          const auto mitr = materials.find(particles[i].material_id);
+          if (mitr != materials.end()) particle->assign_material(mitr->second);
+        }
+      });
+  if (!status)
+    throw std::runtime_error("Particle in checkpoint is not found in mesh");
+
+  // Assign cells serially, as a cell's list of particles isn't thread safe
+  for (mpm::Index i = 0; i < nparticles; ++i) {
+    if (particles[i].cell_id == CheckpointUndefinedCell) continue;
+    const auto citr = cells.find(particles[i].cell_id);
+    if (citr == cells.end())
+      throw std::runtime_error("Cell of particle in checkpoint is not found");
+
+    VectorDim xi;
+    for (unsigned j = 0; j < Tdim; ++j) xi(j) = particles[i].xi[j];
+    particles_[particle_index.at(particles[i].id)]->assign_cell_xi(
+        citr->second, xi);
+  }
+  return true;
+}
+
+//! Create particles from the state in a checkpoint
+template <unsigned Tdim>
+bool mpm::Mesh<Tdim>::create_particles_checkpoint(
+    const std::string& particle_type, const CheckpointParticle* particles,
+    mpm::Index nparticles,
+    const std::map<unsigned, std::shared_ptr<mpm::Material<Tdim>>>&
+        materials) {
+  if (this->nparticles() != 0)
+    throw std::runtime_error("Particles of checkpoint are added to a mesh "
+                             "with particles");
+
+  // Cells are checked before particles are added to the mesh
+  std::unordered_set<mpm::Index> cells;
+  cells.reserve(cells_.size());
+  for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr)
+    cells.emplace((*citr)->id());
+  for (mpm::Index i = 0; i < nparticles; ++i)
+    if (particles[i].cell_id != CheckpointUndefinedCell &&
+        cells.find(particles[i].cell_id) == cells.end())
+      throw std::runtime_error("Cell of particle in checkpoint is not found");
+
+  // Particles are created at their stored coordinates in parallel, and are
+  // assigned to cells when their state is restored
+  std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> created(nparticles);
+  tbb::parallel_for(
+      tbb::blocked_range<mpm::Index>(0, nparticles),
+      [&](const tbb::blocked_range<mpm::Index>& range) {
+        for (mpm::Index i = range.begin(); i != range.end(); ++i) {
+          VectorDim coordinates;
+          for (unsigned j = 0; j < Tdim; ++j)
+            coordinates(j) = particles[i].coordinates[j];
+          created[i] =
+              Factory<mpm::ParticleBase<Tdim>, mpm::Index,
+                      const Eigen::Matrix<double, Tdim, 1>&>::instance()
+                  ->create(particle_type, arena_,
+                           static_cast<mpm::Index>(particles[i].id),
+                           coordinates);
+        }
+      });
+
+  // Ids of a checkpoint are unique, so duplicates aren't searched for
+  for (const auto& particle : created) particles_.add(particle, false);
+  return this->restore_particles_checkpoint(particles, nparticles, materials);
+}
+
+//! Return the memory footprint of the particles, nodes and cells
+template <unsigned Tdim>
+mpm::MeshFootprint mpm::Mesh<Tdim>::footprint() const {
+  mpm::MeshFootprint footprint;
+  footprint.nparticles = particles_.size();
+  for (auto itr = particles_.cbegin(); itr != particles_.cend(); ++itr)
+    footprint.particles += (*itr)->footprint();
+
+  footprint.nnodes = nodes_.size();
+  for (auto itr = nodes_.cbegin(); itr != nodes_.cend(); ++itr)
+    footprint.nodes += (*itr)->footprint();
+
+  footprint.ncells = cells_.size();
+  for (auto itr = cells_.cbegin(); itr != cells_.cend(); ++itr)
+    footprint.cells += (*itr)->footprint();
+
+  footprint.arena_allocated = arena_->allocated();
+  footprint.arena_reserved = arena_->reserved();
+  return footprint;
+}
@@ -2,6 +2,8 @@
 #define MPM_MPM_H_
 
 #include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 #include <boost/lexical_cast.hpp>
@@ -13,6 +15,7 @@
 #include "mesh.h"
 #include "read_mesh.h"
 #include "read_mesh_ascii.h"
+#include "vtk_xml_writer.h"
 
 #ifdef USE_VTK
 #include "vtk_writer.h"
@@ -38,6 +41,9 @@ class MPM {
           boost::lexical_cast<std::string>(boost::uuids::random_generator()());
   }
 
+  //! Destructor
+  virtual ~MPM(){};
+
   // Initialise mesh and particles
   virtual bool initialise_mesh_particles() = 0;
 
@@ -53,10 +59,8 @@ class MPM {
   //! Write HDF5 files
   virtual void write_hdf5(mpm::Index step, mpm::Index max_steps) = 0;
 
-#ifdef USE_VTK
   //! Write VTK files
   virtual void write_vtk(mpm::Index step, mpm::Index max_steps) = 0;
-#endif
 
  protected:
   //! A unique id for the analysis
@@ -65,6 +69,8 @@ class MPM {
   double dt_{std::numeric_limits<double>::max()};
   //! Current step
   mpm::Index step_{0};
+  //! Simulation time of the particle state
+  double time_{0.};
   //! Number of steps
   mpm::Index nsteps_{std::numeric_limits<mpm::Index>::max()};
   //! Output steps
@@ -78,6 +84,30 @@ class MPM {
   //! Logger
   std::shared_ptr<spdlog::logger> console_;
 };
+
+//! Return the key of an analysis in the factory of MPM solvers
+//! \details The key of a solver over the concrete types of particles, nodes,
+//! cells and material of the input is returned if one is registered and
+//! static dispatch isn't disabled in the analysis, otherwise the analysis
+//! type, whose solver dispatches through the virtual interfaces
+//! \param[in] io IO object of the analysis
+//! \retval key Factory key of the solver
+std::string analysis_key(const IO& io);
+
+//! Create an analysis from an input JSON object, e.g. to embed a solver in
+//! another program, over the concrete entity types of the input if a solver
+//! is registered for them
+//! \param[in] analysis Analysis type, e.g. MPMExplicitUSF2D
+//! \param[in] json Input JSON object
+//! \param[in] working_dir Working directory of the input files
+//! \retval mpm Analysis
+std::shared_ptr<MPM> create_analysis(const std::string& analysis,
+                                     const Json& json,
+                                     const std::string& working_dir);
+
+//! Return the mutex which serialises the HDF5 and VTK outputs of all
+//! analyses in the process, as the libraries are not thread safe
+std::mutex& output_mutex();
 }  // namespace mpm
 
 #endif  // MPM_MPM_H_
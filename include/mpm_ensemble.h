@@ -0,0 +1,96 @@
+#ifndef MPM_MPM_ENSEMBLE_H_
+#define MPM_MPM_ENSEMBLE_H_
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <tbb/parallel_for.h>
+
+#include "mpm.h"
+#include "mpm_explicit.h"
+
+namespace mpm {
+
+//! MPMEnsemble class
+//! \brief Ensemble of analyses of variants of the material parameters, which
+//! share the mesh input and run concurrently in one process
+//! \details The mesh, velocity constraints and particles files are read once
+//! into a mesh input. The first variant locates the particles of the input
+//! in its mesh, and the cells of the particles are shared with the other
+//! variants, which assign them instead of searching the mesh for each
+//! particle. Each variant builds its own nodes and cells from the input, as
+//! a node holds its coordinates with the fields of a step and a cell holds
+//! its nodes, so the geometry isn't split from the fields. Variants of the
+//! analysis of the ensemble are scheduled as tasks of the TBB pool, in
+//! which the stages of each variant run in parallel as well.
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+class MPMEnsemble : public MPM {
+ public:
+  //! Constructor
+  MPMEnsemble(std::unique_ptr<IO>&& io);
+
+  //! Read the mesh input once, initialise the first variant, which locates
+  //! the particles of the input, and assign the input with the cells of its
+  //! particles to the other variants, which build their meshes from it
+  bool initialise_mesh_particles() override;
+
+  //! Check that the materials of the variants are in the input
+  bool initialise_materials() override;
+
+  //! Solve all variants
+  bool solve() override;
+
+  //! Checkpoint resume, which each variant does in its own solve
+  bool checkpoint_resume() override;
+
+  //! Write HDF5 files of all variants
+  void write_hdf5(mpm::Index step, mpm::Index max_steps) override;
+
+  //! Write VTK files of all variants
+  void write_vtk(mpm::Index step, mpm::Index max_steps) override;
+
+  //! Return the number of variants
+  unsigned nvariants() const { return variants_.size(); }
+
+  //! Return the analysis of a variant
+  //! \param[in] index Index of the variant
+  const mpm::MPMExplicit<Tdim>& variant(unsigned index) const {
+    return *variants_.at(index);
+  }
+
+  //! Return the status of the solve of a variant
+  //! \param[in] index Index of the variant
+  bool variant_status(unsigned index) const { return statuses_.at(index); }
+
+ private:
+  //! Return the input of a variant, in which the material parameters of the
+  //! variant replace those of the input of the ensemble
+  //! \param[in] index Index of the variant
+  //! \param[in] variant JSON object of the variant
+  Json variant_input(unsigned index, const Json& variant) const;
+
+  //! A unique id for the analysis
+  using mpm::MPM::uuid_;
+  //! A unique ptr to IO object
+  using mpm::MPM::io_;
+  //! JSON analysis object
+  using mpm::MPM::analysis_;
+  //! Logger
+  using mpm::MPM::console_;
+
+  //! Analysis type of the variants
+  std::string analysis_type_;
+  //! Analyses of the variants
+  std::vector<std::shared_ptr<mpm::MPMExplicit<Tdim>>> variants_;
+  //! Status of the solve of each variant, as bytes which variants running
+  //! concurrently write independently
+  std::vector<char> statuses_;
+};  // MPMEnsemble class
+}  // namespace mpm
+
+#include "mpm_ensemble.tcc"
+
+#endif  // MPM_MPM_ENSEMBLE_H_
@@ -0,0 +1,157 @@
+//! Constructor
+template <unsigned Tdim>
+mpm::MPMEnsemble<Tdim>::MPMEnsemble(std::unique_ptr<IO>&& io)
+    : mpm::MPM(std::move(io)) {
+  //! Logger
+  console_ = spdlog::get("MPMEnsemble");
+
+  try {
+    if (analysis_.find("ensemble") == analysis_.end())
+      throw std::domain_error("Ensemble is not specified in the analysis");
+    const auto ensemble = analysis_.at("ensemble");
+    analysis_type_ = ensemble.at("analysis").template get<std::string>();
+    const auto variants = ensemble.at("variants");
+    if (!variants.is_array() || variants.empty())
+      throw std::domain_error("Ensemble has no variants");
+
+    // Analysis of each variant, over the concrete entity types of its input
+    // if a solver is registered for them
+    for (unsigned i = 0; i < variants.size(); ++i) {
+      auto variant = std::dynamic_pointer_cast<mpm::MPMExplicit<Tdim>>(
+          mpm::create_analysis(analysis_type_,
+                               this->variant_input(i, variants.at(i)),
+                               io_->working_dir()));
+      if (variant == nullptr)
+        throw std::domain_error("Analysis of an ensemble should be an " +
+                                std::to_string(Tdim) +
+                                "D explicit analysis: " + analysis_type_);
+      variants_.emplace_back(variant);
+    }
+    statuses_.assign(variants_.size(), false);
+  } catch (std::exception& exception) {
+    console_->error(" {} {} Get ensemble: {}", __FILE__, __LINE__,
+                    exception.what());
+    abort();
+  }
+}
+
+//! Return the input of a variant
+template <unsigned Tdim>
+Json mpm::MPMEnsemble<Tdim>::variant_input(unsigned index,
+                                           const Json& variant) const {
+  Json input = io_->json();
+  input["analysis"].erase("ensemble");
+
+  // Outputs and checkpoints of each variant are in their own folder
+  const std::string suffix = "-" + std::to_string(index);
+  input["analysis"]["uuid"] = uuid_ + suffix;
+  if (input["analysis"].find("resume") != input["analysis"].end() &&
+      input["analysis"]["resume"].find("uuid") !=
+          input["analysis"]["resume"].end())
+    input["analysis"]["resume"]["uuid"] =
+        input["analysis"]["resume"]["uuid"].template get<std::string>() +
+        suffix;
+
+  // Parameters of the variant replace those of the material with its id
+  if (variant.find("materials") == variant.end()) return input;
+  for (const auto& material : variant.at("materials")) {
+    const auto id = material.at("id").template get<unsigned>();
+    bool found = false;
+    for (auto& material_props : input["materials"]) {
+      if (material_props.at("id").template get<unsigned>() != id) continue;
+      for (const auto& item : material.items())
+        material_props[item.key()] = item.value();
+      found = true;
+    }
+    if (!found)
+      throw std::domain_error("Material " + std::to_string(id) +
+                              " of variant " + std::to_string(index) +
+                              " is not in the input");
+  }
+  return input;
+}
+
+//! Read the mesh input once, locate its particles in the mesh of the first
+//! variant and assign it to all variants
+template <unsigned Tdim>
+bool mpm::MPMEnsemble<Tdim>::initialise_mesh_particles() {
+  bool status = true;
+  try {
+    // Variants differ in materials only, so the input of the first variant
+    // is the mesh input of all of them
+    const auto input = variants_.at(0)->read_mesh_input();
+    variants_.at(0)->assign_mesh_input(input);
+    // The first variant searches for the cells of the particles, which the
+    // other variants assign to their particles. Nodes and cells are built
+    // by each variant, as they hold the fields of its steps.
+    statuses_[0] = variants_.at(0)->initialise();
+    const auto located = variants_.at(0)->located_mesh_input();
+    for (unsigned i = 1; i < variants_.size(); ++i)
+      variants_[i]->assign_mesh_input(located);
+  } catch (std::exception& exception) {
+    console_->error("#{}: Reading mesh input: {}", __LINE__, exception.what());
+    status = false;
+  }
+  return status;
+}
+
+//! Materials are initialised by each variant in its solve, after their
+//! parameters are checked when the variants are created
+template <unsigned Tdim>
+bool mpm::MPMEnsemble<Tdim>::initialise_materials() {
+  return true;
+}
+
+//! Checkpoint resume is done by each variant in its solve, from its own
+//! checkpoints
+template <unsigned Tdim>
+bool mpm::MPMEnsemble<Tdim>::checkpoint_resume() {
+  return true;
+}
+
+//! Solve all variants
+template <unsigned Tdim>
+bool mpm::MPMEnsemble<Tdim>::solve() {
+  // Mesh input is read once for all variants
+  if (!this->initialise_mesh_particles()) return false;
+
+  console_->info("Ensemble of {} variants of {}", variants_.size(),
+                 analysis_type_);
+  // Variants are tasks of the TBB pool, whose stages run in parallel as well
+  tbb::parallel_for(std::size_t(0), variants_.size(), [this](std::size_t i) {
+    try {
+      // The first variant is initialised with the mesh input
+      if (i == 0) {
+        if (!statuses_[0]) return;
+        variants_[0]->advance(std::numeric_limits<mpm::Index>::max());
+        variants_[0]->finalise();
+        return;
+      }
+      statuses_[i] = variants_[i]->solve();
+    } catch (std::exception& exception) {
+      console_->error("Variant {}: {}", i, exception.what());
+      statuses_[i] = false;
+    }
+  });
+
+  bool status = true;
+  for (unsigned i = 0; i < statuses_.size(); ++i) {
+    if (statuses_[i]) continue;
+    console_->error("Variant {} of the ensemble failed", i);
+    status = false;
+  }
+  return status;
+}
+
+//! Write HDF5 files of all variants
+template <unsigned Tdim>
+void mpm::MPMEnsemble<Tdim>::write_hdf5(mpm::Index step,
+                                        mpm::Index max_steps) {
+  for (auto& variant : variants_) variant->write_hdf5(step, max_steps);
+}
+
+//! Write VTK files of all variants
+template <unsigned Tdim>
+void mpm::MPMEnsemble<Tdim>::write_vtk(mpm::Index step, mpm::Index max_steps) {
+  for (auto& variant : variants_) variant->write_vtk(step, max_steps);
+}
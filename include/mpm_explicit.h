@@ -1,17 +1,65 @@
 #ifndef MPM_MPM_EXPLICIT_H_
 #define MPM_MPM_EXPLICIT_H_
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <future>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 #include <boost/lexical_cast.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
 #include "container.h"
+#include "explicit_pipeline.h"
 #include "mpm.h"
 #include "particle.h"
 
 namespace mpm {
 
+//! Mesh input struct
+//! \brief Nodes, cells and velocity constraints of a mesh and coordinates of
+//! particles, which are read once and may be shared by analyses which build
+//! their own mesh from them
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+struct MeshInput {
+  //! Coordinates of the nodes
+  std::vector<Eigen::Matrix<double, Tdim, 1>> node_coordinates;
+  //! Node ids of the cells
+  std::vector<std::vector<mpm::Index>> cell_nodes;
+  //! Velocity constraints of node id, direction and velocity
+  std::vector<std::tuple<mpm::Index, unsigned, double>> velocity_constraints;
+  //! Coordinates of the particles, empty if particles are generated in cells
+  //! or created from a checkpoint
+  std::vector<Eigen::Matrix<double, Tdim, 1>> particle_coordinates;
+  //! Ids of the cells of the particles in the order of their coordinates,
+  //! empty unless the particles were located in a mesh built from the input
+  std::vector<mpm::Index> particle_cells;
+};
+
+//! Events of a step at which callbacks are called
+enum class StepEvent {
+  //! Start of a step, after its time step is set
+  Begin,
+  //! After the forces of the particles are mapped to the nodes, before the
+  //! nodes are updated, in the first sub-step of a step only, whose coupled
+  //! forces are held over the sub-steps
+  NodalForces,
+  //! End of a step, after the simulation time and diagnostics are updated
+  End
+};
+
 //! MPMExplicit class
 //! \brief A class that implements the fully explicit one phase mpm
 //! \details A single-phase explicit MPM
@@ -19,36 +67,274 @@ namespace mpm {
 template <unsigned Tdim>
 class MPMExplicit : public MPM {
  public:
+  //! Callback of a step, with the step and the simulation time
+  using StepCallback = std::function<void(mpm::Index, double)>;
+
   //! Default constructor
   MPMExplicit(std::unique_ptr<IO>&& io);
 
+  //! Destructor waits for pending output to be flushed
+  ~MPMExplicit() override;
+
   //! Initialise mesh and particles
   bool initialise_mesh_particles() override;
 
   //! Initialise materials
   bool initialise_materials() override;
 
-  //! Solve
-  virtual bool solve() = 0;
+  //! Read the mesh input of the analysis from its mesh, velocity
+  //! constraints and particles files, except the particles of an analysis
+  //! which resumes from a checkpoint
+  //! \retval input Mesh input
+  std::shared_ptr<const mpm::MeshInput<Tdim>> read_mesh_input();
+
+  //! Assign a mesh input, from which the mesh and particles are created
+  //! instead of reading the input files
+  //! \param[in] input Mesh input, which may be shared by other analyses
+  void assign_mesh_input(
+      const std::shared_ptr<const mpm::MeshInput<Tdim>>& input) {
+    mesh_input_ = input;
+  }
+
+  //! Return the mesh input with the cells in which the particles of the
+  //! input are located in the mesh, which analyses that share the input
+  //! assign to their particles instead of searching for them
+  //! \retval input Mesh input, unchanged unless the particles of the mesh
+  //! are created from the coordinates of the input
+  std::shared_ptr<const mpm::MeshInput<Tdim>> located_mesh_input() const;
+
+  //! Solve all steps of the analysis
+  bool solve() override;
+
+  //! Initialise the materials, mesh and particles and the stages of the
+  //! scheme, after which steps are advanced
+  //! \retval status Status of the initialisation
+  virtual bool initialise() = 0;
+
+  //! Advance steps of the analysis, which end early at the end of the
+  //! analysis
+  //! \param[in] nsteps Number of steps
+  //! \retval nadvanced Number of steps advanced
+  mpm::Index advance(mpm::Index nsteps);
+
+  //! Write the pending outputs and wait for all outputs after the last step
+  void finalise();
+
+  //! Return if the analysis has reached its last step, end time or steady
+  //! state
+  bool finished() const { return step_ >= nsteps_ || !this->running(); }
+
+  //! Add a callback at an event of each step, e.g. to exchange fields with a
+  //! coupled solver. Callbacks at the nodal forces run in a coupling stage,
+  //! which is added to the scheme if they are added before the analysis is
+  //! initialised, so adding the first of them afterwards throws.
+  //! \param[in] event Event of a step
+  //! \param[in] callback Callback with the step and the simulation time
+  void add_step_callback(mpm::StepEvent event, const StepCallback& callback);
+
+  //! Return a view of a field of the particles, which reads and writes the
+  //! particles in place: coordinates, mass, velocity, stress or strain. Mass
+  //! is recomputed at each step and is read-only. The other fields are
+  //! written between steps, at the begin or end of a step, and coordinates
+  //! only within the cell of a particle, as particles are located at the end
+  //! of a step
+  //! \param[in] field Name of the field
+  //! \param[in] phase Index corresponding to the phase
+  mpm::FieldView particles_field(const std::string& field,
+                                 unsigned phase = 0) {
+    return meshes_.at(0)->particles_field(field, phase);
+  }
+
+  //! Return a view of a field of the nodes, which reads and writes the nodes
+  //! in place: coordinates, mass, velocity, momentum, acceleration,
+  //! external_force or internal_force. Coordinates, which cells cache,
+  //! momentum and acceleration are read-only. The nodes are reset at each
+  //! step, so the other fields are only written at the nodal forces of a
+  //! step, before the nodes are updated
+  //! \param[in] field Name of the field
+  //! \param[in] phase Index corresponding to the phase
+  mpm::FieldView nodes_field(const std::string& field, unsigned phase = 0) {
+    return meshes_.at(0)->nodes_field(field, phase);
+  }
 
   //! Checkpoint resume
   bool checkpoint_resume() override;
 
-#ifdef USE_VTK
   //! Write VTK files
   void write_vtk(mpm::Index step, mpm::Index max_steps) override;
-#endif
 
   //! Write HDF5 files
   void write_hdf5(mpm::Index step, mpm::Index max_steps) override;
 
+  //! Write a binary checkpoint of the complete particle state
+  //! \param[in] step Current step
+  //! \param[in] max_steps Total number of steps to be solved
+  void write_checkpoint(mpm::Index step, mpm::Index max_steps);
+
+  //! Wait until all pending outputs are written
+  void wait_output();
+
+  //! Return the number of particles
+  mpm::Index nparticles() const { return meshes_.at(0)->nparticles(); }
+
+  //! Return the current step
+  mpm::Index step() const { return step_; }
+
+  //! Return the time step size
+  double dt() const { return dt_; }
+
+  //! Return the simulation time of the particle state
+  double time() const { return time_; }
+
+  //! Return the mass added by mass scaling as a ratio of the particle mass
+  double added_mass_ratio() const { return added_mass_ratio_; }
+
+  //! Return the global diagnostics of the particles after the last step
+  const mpm::MeshDiagnostics<Tdim>& diagnostics() const {
+    return diagnostics_;
+  }
+
+  //! Return if the diagnostics have settled below the thresholds of a steady
+  //! state for the required number of consecutive steps
+  bool steady_state() const {
+    return !steady_state_.empty() && nsteady_steps_ >= steady_state_steps_;
+  }
+
+  //! Return the accumulated wall time of each stage of the analysis
+  //! \retval stage_times Wall time in seconds by stage name
+  const std::map<std::string, double>& stage_times() const {
+    return stage_times_;
+  }
+
  protected:
+  //! Initialise the analysis and the steps of an explicit scheme, as a
+  //! pipeline of stages in the order of the scheme, which the analysis may
+  //! reorder, skip and fuse
+  //! \param[in] order Names of the stages of the scheme in order
+  //! \param[in] stages Stages of the scheme in addition to the explicit
+  //! stages, by name
+  //! \tparam Tkernels Kernels of a step
+  //! \retval status Status of the initialisation
+  template <typename Tkernels>
+  bool initialise_stages(
+      const std::vector<std::string>& order,
+      const std::map<std::string, mpm::ExplicitStage<Tdim>>& stages = {});
+
+  //! Return the stages of an explicit step which are available by name:
+  //! output, initialise_nodes, initialise_particles, map_nodes, stress,
+  //! body_force, internal_force, update_nodes, update_particles and locate,
+  //! each of which declares its access to particles, nodes and cells
+  //! \param[in] phase Index corresponding to the phase
+  //! \tparam Tkernels Kernels of a step
+  template <typename Tkernels>
+  std::map<std::string, mpm::ExplicitStage<Tdim>> explicit_stages(
+      unsigned phase);
+
+  //! Return the number of sub-steps of the current step, each of which runs
+  //! the stages of a step, which is known after the first sub-step
+  virtual unsigned nsubsteps() const { return 1; }
+
+  //! Iterate a kernel over the particles of the current sub-step, which are
+  //! all particles of the mesh unless a scheme sub-cycles particles
+  //! \param[in] kernel Kernel of a particle
+  virtual void iterate_step_particles(
+      const typename mpm::ExplicitStage<Tdim>::ParticleKernel& kernel);
+
+  //! Add the wall time since the start of a stage to the stage and restart
+  //! the timer for the next stage
+  //! \param[in] stage Name of the stage
+  //! \param[in,out] start Start time of the stage
+  void stage_time(const std::string& stage,
+                  std::chrono::steady_clock::time_point& start);
+
+  //! Log a summary of the kernel failures recorded during the current step
+  //! and reset the counters
+  void summarise_step_errors();
+
+  //! Log the memory footprint of the particles, nodes and cells of the mesh
+  void report_footprint();
+
+  //! Take a snapshot of the particles for an HDF5 output, which is pending
+  //! until it is written
+  //! \param[in] step Current step
+  //! \param[in] max_steps Total number of steps to be solved
+  void snapshot_hdf5(mpm::Index step, mpm::Index max_steps);
+
+  //! Take a snapshot of the particles for a VTK output, which is pending
+  //! until it is written
+  //! \param[in] step Current step
+  //! \param[in] max_steps Total number of steps to be solved
+  void snapshot_vtk(mpm::Index step, mpm::Index max_steps);
+
+  //! Take a snapshot of the particle state for a binary checkpoint, which is
+  //! pending until it is written
+  //! \param[in] step Current step
+  //! \param[in] max_steps Total number of steps to be solved
+  void snapshot_checkpoint(mpm::Index step, mpm::Index max_steps);
+
+  //! Queue the writes of the pending snapshots, which the output stage of a
+  //! step overlaps with the step
+  void write_pending_output();
+
+  //! Scale the mass of particles whose critical time step is below the
+  //! target time step of mass scaling divided by the Courant number. Update
+  //! an adaptive time step to the Courant number times the critical time
+  //! step of the mesh, within its bounds, and shorten it to reach the next
+  //! output time and the end time of the analysis
+  void update_time_step();
+
+  //! Return if the current step is an output step, which is at output
+  //! intervals of simulation time if specified, otherwise at output steps
+  bool output_step();
+
+  //! Set the next output time after the simulation time of a resumed
+  //! analysis
+  void resume_output_time();
+
+  //! Compute the global diagnostics of the particles and count the
+  //! consecutive steps in which they are below the thresholds of a steady
+  //! state
+  void update_diagnostics();
+
+  //! Return if the simulation time hasn't reached the end of the analysis
+  //! and the analysis isn't in a steady state, which a scheme may end
+  //! earlier
+  virtual bool running() const;
+
+  //! Create the mesh reader of the analysis
+  //! \retval mesh_reader Mesh reader
+  std::shared_ptr<mpm::ReadMesh<Tdim>> create_mesh_reader();
+
+  //! Create the particles of the mesh input, or generate them in cells
+  //! \retval status Status of creating particles
+  bool create_input_particles();
+
+  //! Return the checkpoint file from which the analysis resumes, empty
+  //! unless it resumes from an existing binary checkpoint, whether or not
+  //! the analysis writes checkpoints itself
+  std::string resume_checkpoint_file();
+
+  //! Delete the outputs after the resumed step from an HDF5 time series and
+  //! rewrite its index, to which later outputs are appended
+  void resume_time_series();
+
+  //! Queue an output task to run after the previously queued output
+  //! \param[in] task Output task, which should only access its own buffer
+  //! \retval output Future which becomes ready when the task is written
+  std::shared_future<void> queue_output(const std::function<void()>& task);
+
+  //! Wait for an output and report errors
+  //! \param[in] output Future of the output, reset once it is written
+  void wait_output(std::shared_future<void>& output);
+
   // Generate a unique id for the analysis
   using mpm::MPM::uuid_;
   //! Time step size
   using mpm::MPM::dt_;
   //! Current step
   using mpm::MPM::step_;
+  //! Simulation time
+  using mpm::MPM::time_;
   //! Number of steps
   using mpm::MPM::nsteps_;
   //! Output steps
@@ -64,10 +350,91 @@ class MPMExplicit : public MPM {
 
   //! Gravity
   Eigen::Matrix<double, Tdim, 1> gravity_;
+  //! Adapt the time step to the critical time step of the mesh
+  bool adaptive_dt_{false};
+  //! Courant number, the fraction of the critical time step
+  double cfl_{0.5};
+  //! Lower bound of an adaptive time step
+  double dt_min_{0.};
+  //! Upper bound of an adaptive time step
+  double dt_max_{std::numeric_limits<double>::max()};
+  //! Scale the mass of particles below a target time step
+  bool mass_scaling_{false};
+  //! Target time step of mass scaling
+  double mass_scaling_dt_{0.};
+  //! Maximum scale of the mass of a particle
+  double max_mass_scale_{100.};
+  //! Mass added by mass scaling as a ratio of the particle mass
+  double added_mass_ratio_{0.};
+  //! Simulation time at the end of the analysis
+  double end_time_{std::numeric_limits<double>::max()};
+  //! Interval of simulation time between outputs, zero for output steps
+  double output_time_{0.};
+  //! Simulation time of the next output
+  double next_output_time_{0.};
   //! Mesh object
   std::vector<std::unique_ptr<mpm::Mesh<Tdim>>> meshes_;
+  //! Mesh input, which is read by the analysis unless assigned
+  std::shared_ptr<const mpm::MeshInput<Tdim>> mesh_input_;
   //! Materials
   std::map<unsigned, std::shared_ptr<mpm::Material<Tdim>>> materials_;
+  //! Write outputs in a background thread
+  bool async_output_{true};
+  //! Last queued output
+  std::shared_future<void> output_;
+  //! HDF5 output layout and compression
+  HDF5Options hdf5_options_;
+  //! Double buffer of particle data for HDF5 table output
+  std::array<std::vector<HDF5Particle>, 2> hdf5_buffers_;
+  //! Double buffer of particle data for HDF5 columnar output
+  std::array<HDF5ParticleColumns, 2> hdf5_columns_;
+  //! Pending HDF5 output of each buffer
+  std::array<std::shared_future<void>, 2> hdf5_outputs_;
+  //! Index of the next HDF5 buffer to be filled
+  unsigned hdf5_buffer_{0};
+  //! HDF5 time series and its index are started, to which outputs are
+  //! appended
+  bool hdf5_series_{false};
+  //! Particle volumes are assigned from quadrature weights when particles are
+  //! generated in cells, and aren't recomputed from cell volumes
+  bool particle_volumes_{false};
+  //! Write binary checkpoints at output steps
+  bool checkpoint_{false};
+  //! Double buffer of particle state for checkpoints
+  std::array<std::vector<CheckpointParticle>, 2> checkpoint_buffers_;
+  //! Pending checkpoint of each buffer
+  std::array<std::shared_future<void>, 2> checkpoint_outputs_;
+  //! Index of the next checkpoint buffer to be filled
+  unsigned checkpoint_buffer_{0};
+  //! VTK output format (vtp or vtu), none disables VTK output
+  std::string vtk_format_{"vtp"};
+  //! Double buffer of particle data for VTK output
+  std::array<HDF5ParticleColumns, 2> vtk_columns_;
+  //! Pending VTK output of each buffer
+  std::array<std::shared_future<void>, 2> vtk_outputs_;
+  //! Index of the next VTK buffer to be filled
+  unsigned vtk_buffer_{0};
+  //! Accumulated wall time of stages in seconds
+  std::map<std::string, double> stage_times_;
+  //! Writes of the snapshots of an output step, which are pending until the
+  //! output stage of the next step, and the futures of their buffers
+  std::vector<std::pair<std::shared_future<void>*, std::function<void()>>>
+      pending_outputs_;
+  //! Global diagnostics of the particles after the last step
+  mpm::MeshDiagnostics<Tdim> diagnostics_;
+  //! Stages of a step, once the analysis is initialised
+  std::unique_ptr<mpm::ExplicitPipeline<Tdim>> pipeline_;
+  //! Index of the sub-step whose stages are running in the current step
+  unsigned substep_{0};
+  //! Callbacks of each event of a step
+  std::map<mpm::StepEvent, std::vector<StepCallback>> step_callbacks_;
+  //! Thresholds of kinetic_energy, momentum and max_velocity in a steady
+  //! state, empty to solve all steps
+  std::map<std::string, double> steady_state_;
+  //! Consecutive steps in a steady state which end the analysis
+  mpm::Index steady_state_steps_{1};
+  //! Consecutive steps in a steady state so far
+  mpm::Index nsteady_steps_{0};
 
 };  // MPMExplicit class
 }  // namespace mpm
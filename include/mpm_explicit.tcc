@@ -22,6 +22,61 @@ mpm::MPMExplicit<Tdim>::MPMExplicit(std::unique_ptr<IO>&& io)
     dt_ = analysis_["dt"].template get<double>();
     // Number of time steps
     nsteps_ = analysis_["nsteps"].template get<mpm::Index>();
+    // Entities share a logger per type
+    bool slim_entities = false;
+    if (analysis_.find("slim_entities") != analysis_.end())
+      slim_entities = analysis_["slim_entities"].template get<bool>();
+    mpm::Logger::slim_entities(slim_entities);
+    // Simulation time at the end of the analysis
+    if (analysis_.find("time") != analysis_.end())
+      end_time_ = analysis_["time"].template get<double>();
+    // Adaptive time step from the critical time step of the mesh
+    if (analysis_.find("adaptive_dt") != analysis_.end()) {
+      const auto adaptive_dt = analysis_.at("adaptive_dt");
+      adaptive_dt_ = true;
+      if (adaptive_dt.find("cfl") != adaptive_dt.end())
+        cfl_ = adaptive_dt.at("cfl").template get<double>();
+      if (adaptive_dt.find("dt_min") != adaptive_dt.end())
+        dt_min_ = adaptive_dt.at("dt_min").template get<double>();
+      if (adaptive_dt.find("dt_max") != adaptive_dt.end())
+        dt_max_ = adaptive_dt.at("dt_max").template get<double>();
+      if (cfl_ <= 0. || cfl_ > 1.)
+        throw std::domain_error("Courant number should be in (0, 1]");
+      if (dt_min_ > dt_max_)
+        throw std::domain_error("Minimum time step exceeds the maximum");
+    }
+    // Selective mass scaling to a target time step
+    if (analysis_.find("mass_scaling") != analysis_.end()) {
+      const auto mass_scaling = analysis_.at("mass_scaling");
+      mass_scaling_ = true;
+      mass_scaling_dt_ = dt_;
+      if (mass_scaling.find("dt") != mass_scaling.end())
+        mass_scaling_dt_ = mass_scaling.at("dt").template get<double>();
+      if (mass_scaling.find("max_scale") != mass_scaling.end())
+        max_mass_scale_ = mass_scaling.at("max_scale").template get<double>();
+      if (mass_scaling_dt_ <= 0.)
+        throw std::domain_error("Target time step of mass scaling should be "
+                                "positive");
+      if (max_mass_scale_ < 1.)
+        throw std::domain_error("Maximum mass scale should be at least one");
+    }
+    // Steady state which ends the analysis
+    if (analysis_.find("steady_state") != analysis_.end()) {
+      for (const auto& item : analysis_.at("steady_state").items()) {
+        if (item.key() == "steps")
+          steady_state_steps_ = item.value().template get<mpm::Index>();
+        else if (item.key() == "kinetic_energy" || item.key() == "momentum" ||
+                 item.key() == "max_velocity")
+          steady_state_[item.key()] = item.value().template get<double>();
+        else
+          throw std::domain_error("Unknown diagnostic of a steady state: " +
+                                  item.key());
+      }
+      if (steady_state_.empty())
+        throw std::domain_error("Steady state has no thresholds");
+      if (steady_state_steps_ == 0)
+        throw std::domain_error("Steps of a steady state should be positive");
+    }
 
     if (analysis_.at("gravity").is_array() &&
         analysis_.at("gravity").size() == gravity_.size()) {
@@ -33,8 +88,44 @@ mpm::MPMExplicit<Tdim>::MPMExplicit(std::unique_ptr<IO>&& io)
     }
 
     post_process_ = io_->post_processing();
-    // Output steps
-    output_steps_ = post_process_["output_steps"].template get<mpm::Index>();
+    // Interval of simulation time between outputs
+    if (post_process_.find("output_time") != post_process_.end())
+      output_time_ = post_process_["output_time"].template get<double>();
+    next_output_time_ = output_time_;
+    // Output steps, which are optional for an interval of time
+    if (output_time_ <= 0. ||
+        post_process_.find("output_steps") != post_process_.end())
+      output_steps_ = post_process_["output_steps"].template get<mpm::Index>();
+    // Write outputs in a background thread
+    if (post_process_.find("async_output") != post_process_.end())
+      async_output_ = post_process_["async_output"].template get<bool>();
+    // HDF5 layout, chunking and compression
+    if (post_process_.find("hdf5") != post_process_.end()) {
+      const auto hdf5 = post_process_.at("hdf5");
+      if (hdf5.find("layout") != hdf5.end())
+        hdf5_options_.columnar =
+            (hdf5.at("layout").template get<std::string>() == "columnar");
+      if (hdf5.find("chunk_size") != hdf5.end())
+        hdf5_options_.chunk_size =
+            hdf5.at("chunk_size").template get<hsize_t>();
+      if (hdf5.find("compression") != hdf5.end())
+        hdf5_options_.compression =
+            hdf5.at("compression").template get<unsigned>();
+      if (hdf5.find("shuffle") != hdf5.end())
+        hdf5_options_.shuffle = hdf5.at("shuffle").template get<bool>();
+      // Steps of a time series are stored as columns
+      if (hdf5.find("time_series") != hdf5.end())
+        hdf5_options_.time_series = hdf5.at("time_series").template get<bool>();
+      if (hdf5_options_.time_series) hdf5_options_.columnar = true;
+    }
+    // Binary checkpoints
+    if (post_process_.find("checkpoint") != post_process_.end())
+      checkpoint_ = post_process_["checkpoint"].template get<bool>();
+    // VTK output format
+    if (post_process_.find("vtk") != post_process_.end())
+      vtk_format_ = post_process_["vtk"].template get<std::string>();
+    if (vtk_format_ != "vtp" && vtk_format_ != "vtu" && vtk_format_ != "none")
+      throw std::domain_error("Invalid VTK output format: " + vtk_format_);
 
   } catch (std::domain_error& domain_error) {
     console_->error(" {} {} Get analysis object: {}", __FILE__, __LINE__,
@@ -43,6 +134,70 @@ mpm::MPMExplicit<Tdim>::MPMExplicit(std::unique_ptr<IO>&& io)
   }
 }
 
+//! Destructor
+template <unsigned Tdim>
+mpm::MPMExplicit<Tdim>::~MPMExplicit() {
+  // Flush pending outputs before buffers are released
+  this->wait_output();
+}
+
+//! Read the mesh input of the analysis
+template <unsigned Tdim>
+std::shared_ptr<const mpm::MeshInput<Tdim>>
+    mpm::MPMExplicit<Tdim>::read_mesh_input() {
+  auto input = std::make_shared<mpm::MeshInput<Tdim>>();
+  // Get mesh properties
+  auto mesh_props = io_->json_object("mesh");
+  // Create a mesh reader
+  auto mesh_reader = this->create_mesh_reader();
+
+  // Read nodes and cells of the mesh in one pass
+  mesh_reader->read_mesh(io_->file_name("mesh"), input->node_coordinates,
+                         input->cell_nodes);
+
+  // Read velocity constraints
+  input->velocity_constraints = mesh_reader->read_velocity_constraints(
+      io_->file_name("velocity_constraints"));
+
+  // Read particles, unless they are generated in cells or created from a
+  // checkpoint
+  if (mesh_props.find("generate_particles") == mesh_props.end() &&
+      this->resume_checkpoint_file().empty())
+    input->particle_coordinates =
+        mesh_reader->read_particles(io_->file_name("particles"));
+  return input;
+}
+
+//! Return the mesh input with the cells of its particles
+template <unsigned Tdim>
+std::shared_ptr<const mpm::MeshInput<Tdim>>
+    mpm::MPMExplicit<Tdim>::located_mesh_input() const {
+  if (mesh_input_ == nullptr || mesh_input_->particle_coordinates.empty() ||
+      meshes_.at(0)->nparticles() != mesh_input_->particle_coordinates.size())
+    return mesh_input_;
+
+  auto input = std::make_shared<mpm::MeshInput<Tdim>>(*mesh_input_);
+  input->particle_cells = meshes_.at(0)->particles_cells();
+  return input;
+}
+
+//! Create the mesh reader of the analysis
+template <unsigned Tdim>
+std::shared_ptr<mpm::ReadMesh<Tdim>>
+    mpm::MPMExplicit<Tdim>::create_mesh_reader() {
+  // Get mesh properties
+  auto mesh_props = io_->json_object("mesh");
+  // Get Mesh reader from JSON object
+  const std::string reader =
+      mesh_props["mesh_reader"].template get<std::string>();
+  // Create a mesh reader
+  auto mesh_reader = Factory<mpm::ReadMesh<Tdim>>::instance()->create(reader);
+  // Parameters of a generated mesh
+  if (mesh_props.find("structured_mesh") != mesh_props.end())
+    mesh_reader->properties(mesh_props["structured_mesh"]);
+  return mesh_reader;
+}
+
 // Initialise mesh and particles
 template <unsigned Tdim>
 bool mpm::MPMExplicit<Tdim>::initialise_mesh_particles() {
@@ -50,11 +205,8 @@ bool mpm::MPMExplicit<Tdim>::initialise_mesh_particles() {
   try {
     // Get mesh properties
     auto mesh_props = io_->json_object("mesh");
-    // Get Mesh reader from JSON object
-    const std::string reader =
-        mesh_props["mesh_reader"].template get<std::string>();
-    // Create a mesh reader
-    auto mesh_reader = Factory<mpm::ReadMesh<Tdim>>::instance()->create(reader);
+    // Read the mesh input, unless it is assigned
+    if (mesh_input_ == nullptr) mesh_input_ = this->read_mesh_input();
 
     // Global Index
     mpm::Index gid = 0;
@@ -62,17 +214,16 @@ bool mpm::MPMExplicit<Tdim>::initialise_mesh_particles() {
     const auto node_type = mesh_props["node_type"].template get<std::string>();
     // Create nodes from file
     bool node_status = meshes_.at(0)->create_nodes(
-        gid,                                                    // global id
-        node_type,                                              // node type
-        mesh_reader->read_mesh_nodes(io_->file_name("mesh")));  // coordinates
+        gid,                             // global id
+        node_type,                       // node type
+        mesh_input_->node_coordinates);  // coordinates
 
     if (!node_status)
       throw std::runtime_error("Addition of nodes to mesh failed");
 
-    // Read and assign velocity constraints
+    // Assign velocity constraints
     bool velocity_constraints = meshes_.at(0)->assign_velocity_constraints(
-        mesh_reader->read_velocity_constraints(
-            io_->file_name("velocity_constraints")));
+        mesh_input_->velocity_constraints);
     if (!velocity_constraints)
       throw std::runtime_error(
           "Velocity constraints are not properly assigned");
@@ -84,35 +235,98 @@ bool mpm::MPMExplicit<Tdim>::initialise_mesh_particles() {
         Factory<mpm::Element<Tdim>>::instance()->create(cell_type);
 
     // Create cells from file
-    bool cell_status = meshes_.at(0)->create_cells(
-        gid,                                                    // global id
-        element,                                                // element tyep
-        mesh_reader->read_mesh_cells(io_->file_name("mesh")));  // Node ids
+    bool cell_status =
+        meshes_.at(0)->create_cells(gid,                       // global id
+                                    element,                   // element tyep
+                                    mesh_input_->cell_nodes);  // Node ids
 
     if (!cell_status)
       throw std::runtime_error("Addition of cells to mesh failed");
 
+    // Particles of an analysis which resumes from a checkpoint are created
+    // from its state
+    if (this->resume_checkpoint_file().empty() &&
+        !this->create_input_particles())
+      throw std::runtime_error("Creation of particles failed");
+
+  } catch (std::exception& exception) {
+    console_->error("#{}: Reading mesh and particles: {}", __LINE__,
+                    exception.what());
+    status = false;
+  }
+  return status;
+}
+
+//! Create the particles of the mesh input, or generate them in cells
+template <unsigned Tdim>
+bool mpm::MPMExplicit<Tdim>::create_input_particles() {
+  bool status = true;
+  try {
+    // Get mesh properties
+    auto mesh_props = io_->json_object("mesh");
+    // Global Index
+    mpm::Index gid = 0;
     // Particle type
     const auto particle_type =
         mesh_props["particle_type"].template get<std::string>();
-    // Create particles from file
-    bool particle_status = meshes_.at(0)->create_particles(
-        gid,            // global id
-        particle_type,  // particle type
-        mesh_reader->read_particles(
-            io_->file_name("particles")));  // coordinates
+    if (mesh_props.find("generate_particles") != mesh_props.end()) {
+      // Generate particles at quadrature points of cells in a box
+      auto generate = mesh_props["generate_particles"];
+      const auto nquadratures =
+          generate["nquadratures"].template get<unsigned>();
+      Eigen::Matrix<double, Tdim, 1> box_min, box_max;
+      box_min.fill(std::numeric_limits<double>::lowest());
+      box_max.fill(std::numeric_limits<double>::max());
+      if (generate.find("box_min") != generate.end())
+        for (unsigned i = 0; i < Tdim; ++i)
+          box_min(i) = generate["box_min"].at(i).template get<double>();
+      if (generate.find("box_max") != generate.end())
+        for (unsigned i = 0; i < Tdim; ++i)
+          box_max(i) = generate["box_max"].at(i).template get<double>();
+
+      bool particle_status = meshes_.at(0)->generate_particles(
+          gid, particle_type, nquadratures, box_min, box_max);
+      if (!particle_status)
+        throw std::runtime_error("Generation of particles in mesh failed");
+      particle_volumes_ = true;
+    } else {
+      // Read particles, which aren't in the mesh input of an analysis that
+      // was to resume from a checkpoint
+      if (mesh_input_->particle_coordinates.empty()) {
+        auto input = std::make_shared<mpm::MeshInput<Tdim>>(*mesh_input_);
+        auto mesh_reader = this->create_mesh_reader();
+        input->particle_coordinates =
+            mesh_reader->read_particles(io_->file_name("particles"));
+        mesh_input_ = input;
+      }
 
-    if (!particle_status)
-      throw std::runtime_error("Addition of particles to mesh failed");
+      // Create particles from file
+      bool particle_status = meshes_.at(0)->create_particles(
+          gid,                                 // global id
+          particle_type,                       // particle type
+          mesh_input_->particle_coordinates);  // coordinates
 
-    // Locate particles in cell
-    auto unlocatable_particles = meshes_.at(0)->locate_particles_mesh();
+      if (!particle_status)
+        throw std::runtime_error("Addition of particles to mesh failed");
 
-    if (!unlocatable_particles.empty())
-      throw std::runtime_error("Particle outside the mesh domain");
+      // Assign the cells of particles located by an analysis which shares
+      // the input, otherwise locate particles in cells
+      if (!mesh_input_->particle_cells.empty() &&
+          mesh_input_->particle_cells.size() ==
+              mesh_input_->particle_coordinates.size()) {
+        if (!meshes_.at(0)->assign_particles_cells(
+                mesh_input_->particle_cells))
+          throw std::runtime_error("Particle outside the mesh domain");
+      } else {
+        auto unlocatable_particles = meshes_.at(0)->locate_particles_mesh();
+
+        if (!unlocatable_particles.empty())
+          throw std::runtime_error("Particle outside the mesh domain");
+      }
+    }
 
   } catch (std::exception& exception) {
-    console_->error("#{}: Reading mesh and particles: {}", __LINE__,
+    console_->error("#{}: Creating particles: {}", __LINE__,
                     exception.what());
     status = false;
   }
@@ -164,7 +378,7 @@ template <unsigned Tdim>
 bool mpm::MPMExplicit<Tdim>::checkpoint_resume() {
   bool checkpoint = true;
   try {
-    // TODO: Set phase
+    // Particles are resumed in the first phase
     const unsigned phase = 0;
 
     if (!analysis_["resume"]["resume"].template get<bool>())
@@ -179,19 +393,58 @@ bool mpm::MPMExplicit<Tdim>::checkpoint_resume() {
     std::string attribute = "particles";
     std::string extension = ".h5";
 
-    auto particles_file =
-        io_->output_file(attribute, extension, uuid_, step_, this->nsteps_)
-            .string();
-    // Load particle information from file
-    meshes_.at(0)->read_particles_hdf5(phase, particles_file);
+    // Restore the complete particle state from a binary checkpoint, whose
+    // particles are created in their stored cells
+    const auto checkpoint_file = this->resume_checkpoint_file();
+    if (!checkpoint_file.empty()) {
+      const mpm::MappedCheckpoint state(checkpoint_file);
+      if (state.header().dimension != Tdim || state.header().step != step_)
+        throw std::runtime_error("Checkpoint doesn't match the analysis");
+      if (meshes_.at(0)->nparticles() == 0) {
+        const auto particle_type = io_->json_object("mesh")["particle_type"]
+                                       .template get<std::string>();
+        meshes_.at(0)->create_particles_checkpoint(
+            particle_type, state.particles(), state.nparticles(), materials_);
+      } else
+        meshes_.at(0)->restore_particles_checkpoint(
+            state.particles(), state.nparticles(), materials_);
+      this->resume_time_series();
+
+      // Increament step
+      ++this->step_;
+      this->time_ = state.header().time;
+      this->resume_output_time();
+      console_->info("Checkpoint resume at step {} of {} from {}", this->step_,
+                     this->nsteps_, checkpoint_file);
+      return checkpoint;
+    }
+
+    // Load particle information from file, whose reads are serialised with
+    // the outputs of all analyses in the process, as HDF5 isn't thread safe
+    if (hdf5_options_.time_series) {
+      auto particles_file =
+          io_->output_file(attribute, extension, uuid_).string();
+      std::lock_guard<std::mutex> guard(mpm::output_mutex());
+      meshes_.at(0)->read_particles_hdf5(phase, particles_file,
+                                         mpm::hdf5_step_group(step_));
+    } else {
+      auto particles_file =
+          io_->output_file(attribute, extension, uuid_, step_, this->nsteps_)
+              .string();
+      std::lock_guard<std::mutex> guard(mpm::output_mutex());
+      meshes_.at(0)->read_particles_hdf5(phase, particles_file);
+    }
     // Locate particles
     auto unlocatable_particles = meshes_.at(0)->locate_particles_mesh();
 
     if (!unlocatable_particles.empty())
       throw std::runtime_error("Particle outside the mesh domain");
+    this->resume_time_series();
 
     // Increament step
     ++this->step_;
+    this->time_ = this->step_ * dt_;
+    this->resume_output_time();
 
     console_->info("Checkpoint resume at step {} of {}", this->step_,
                    this->nsteps_);
@@ -200,47 +453,742 @@ bool mpm::MPMExplicit<Tdim>::checkpoint_resume() {
     console_->info(" {} {} Resume failed, restarting analysis: {}", __FILE__,
                    __LINE__, exception.what());
     this->step_ = 0;
+    this->time_ = 0.;
     checkpoint = false;
+    // Particles of the input, which weren't created for the checkpoint
+    if (meshes_.at(0)->nparticles() == 0) this->create_input_particles();
   }
   return checkpoint;
 }
 
+//! Return the checkpoint file from which the analysis resumes
+template <unsigned Tdim>
+std::string mpm::MPMExplicit<Tdim>::resume_checkpoint_file() {
+  // Resuming depends only on the resume settings, not on writing checkpoints
+  if (analysis_.find("resume") == analysis_.end() ||
+      !analysis_["resume"]["resume"].template get<bool>())
+    return std::string();
+
+  const auto& resume = analysis_["resume"];
+  auto checkpoint_file =
+      io_->output_file("checkpoint", ".bin",
+                       resume["uuid"].template get<std::string>(),
+                       resume["step"].template get<mpm::Index>(),
+                       this->nsteps_)
+          .string();
+  // Checkpoint named by another analysis, e.g. a dynamic relaxation
+  if (resume.find("checkpoint") != resume.end())
+    checkpoint_file =
+        io_->output_file(resume["checkpoint"].template get<std::string>(), "",
+                         resume["uuid"].template get<std::string>())
+            .string();
+  if (!boost::filesystem::exists(checkpoint_file)) return std::string();
+  return checkpoint_file;
+}
+
+//! Delete the outputs after the resumed step from a time series
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::resume_time_series() {
+  if (!hdf5_options_.time_series) return;
+  const auto particles_file =
+      io_->output_file("particles", ".h5", uuid_).string();
+  if (!boost::filesystem::exists(particles_file)) return;
+  const auto xdmf_file = io_->output_file("particles", ".xdmf", uuid_).string();
+
+  // Steps of the run which is resumed are indexed once, after which outputs
+  // are appended
+  std::lock_guard<std::mutex> guard(mpm::output_mutex());
+  const auto steps = mpm::truncate_hdf5_time_series(particles_file, step_);
+  const auto hdf5_file =
+      boost::filesystem::path(particles_file).filename().string();
+  if (!mpm::write_xdmf(xdmf_file, hdf5_file, steps))
+    throw std::runtime_error("XDMF file cannot be written: " + xdmf_file);
+  hdf5_series_ = true;
+}
+
+//! Queue an output task after the previously queued output
+template <unsigned Tdim>
+std::shared_future<void> mpm::MPMExplicit<Tdim>::queue_output(
+    const std::function<void()>& task) {
+  if (async_output_) {
+    // Writes are serialised, as HDF5 and VTK are not thread safe, also with
+    // the writes of other analyses in the process
+    auto previous = output_;
+    output_ = std::async(std::launch::async, [previous, task]() {
+                if (previous.valid()) previous.wait();
+                std::lock_guard<std::mutex> guard(mpm::output_mutex());
+                task();
+              }).share();
+  } else {
+    // Write in the calling thread, errors are reported by wait_output
+    output_ = std::async(std::launch::deferred, [task]() {
+                std::lock_guard<std::mutex> guard(mpm::output_mutex());
+                task();
+              }).share();
+    output_.wait();
+  }
+  return output_;
+}
+
+//! Solve all steps of the analysis
+template <unsigned Tdim>
+bool mpm::MPMExplicit<Tdim>::solve() {
+  bool status = this->initialise();
+  // Steps aren't solved without the stages of the scheme
+  if (pipeline_ == nullptr) return false;
+
+  this->advance(std::numeric_limits<mpm::Index>::max());
+  this->finalise();
+  return status;
+}
+
+//! Initialise the analysis and the stages of an explicit scheme
+template <unsigned Tdim>
+template <typename Tkernels>
+bool mpm::MPMExplicit<Tdim>::initialise_stages(
+    const std::vector<std::string>& order,
+    const std::map<std::string, mpm::ExplicitStage<Tdim>>& stages) {
+  bool status = true;
+  // Timer of solver stages
+  auto timer = std::chrono::steady_clock::now();
+
+  // Phase
+  const unsigned phase = 0;
+  // Initialise material
+  bool mat_status = this->initialise_materials();
+  if (!mat_status) status = false;
+
+  // Initialise mesh and materials
+  bool mesh_status = this->initialise_mesh_particles();
+  if (!mesh_status) status = false;
+
+  // Test if checkpoint resume is needed
+  bool resume = false;
+  if (analysis_.find("resume") != analysis_.end())
+    resume = analysis_["resume"]["resume"].template get<bool>();
+  if (resume) this->checkpoint_resume();
+
+  // Assign material to particles
+  // Get mesh properties
+  auto mesh_props = io_->json_object("mesh");
+  // Material id
+  const auto material_id = mesh_props["material_id"].template get<unsigned>();
+
+  // Get material from list of materials
+  auto material = materials_.at(material_id);
+
+  // Iterate over each particle to assign material, unless it is restored
+  // from a checkpoint
+  meshes_.at(0)->iterate_over_particles(
+      [&material](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        if (particle->material() == nullptr)
+          particle->assign_material(material);
+      });
+
+  // Check that the entities match the types of the kernels of the step
+  if (!Tkernels::check_types(*meshes_.at(0), material)) {
+    console_->error("Entity types of the mesh don't match the solver");
+    return false;
+  }
+
+  // Stages of a step in the order of the scheme, unless configured
+  try {
+    auto available = this->template explicit_stages<Tkernels>(phase);
+    for (const auto& stage : stages) available[stage.first] = stage.second;
+
+    // Callbacks at the nodal forces run in a coupling stage after the
+    // internal forces, which may access any state of the mesh
+    available["coupling"] = {
+        "coupling",
+        [this]() {
+          // Coupled forces of the first sub-step are held over the step
+          if (substep_ > 0) return;
+          for (const auto& callback : step_callbacks_[StepEvent::NodalForces])
+            callback(step_, time_);
+        },
+        {},
+        {{"particles", mpm::StageAccess::Write},
+         {"nodes", mpm::StageAccess::Write},
+         {"cells", mpm::StageAccess::Write}}};
+    auto scheme = order;
+    const auto internal_force =
+        std::find(scheme.begin(), scheme.end(), "internal_force");
+    if (!step_callbacks_[StepEvent::NodalForces].empty() &&
+        internal_force != scheme.end())
+      scheme.insert(internal_force + 1, "coupling");
+
+    pipeline_ = std::make_unique<mpm::ExplicitPipeline<Tdim>>(
+        available, scheme,
+        [this](const typename mpm::ExplicitStage<Tdim>::ParticleKernel&
+                   kernel) { this->iterate_step_particles(kernel); });
+    if (analysis_.find("stages") != analysis_.end())
+      pipeline_->configure(analysis_.at("stages"));
+    // Snapshots of an output step are pending until the output stage, which
+    // starts the next step
+    if (std::find(scheme.begin(), scheme.end(), "output") != scheme.end() &&
+        (pipeline_->names().empty() || pipeline_->names().front() != "output"))
+      throw std::domain_error(
+          "Stage output writes the outputs of the last step, and can't be "
+          "skipped or reordered");
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: Stages of a step: {}", __FILE__, __LINE__,
+                    exception.what());
+    pipeline_.reset();
+    return false;
+  }
+  this->report_footprint();
+  this->stage_time("setup", timer);
+  return status;
+}
+
+//! Add a callback at an event of each step
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::add_step_callback(mpm::StepEvent event,
+                                               const StepCallback& callback) {
+  // The stages of an initialised analysis are only run with a coupling stage
+  // if callbacks at the nodal forces were added before
+  if (event == StepEvent::NodalForces && pipeline_ != nullptr) {
+    const auto names = pipeline_->names();
+    if (std::find(names.begin(), names.end(), "coupling") == names.end())
+      throw std::runtime_error(
+          "Callbacks at the nodal forces are added before the analysis is "
+          "initialised");
+  }
+  step_callbacks_[event].emplace_back(callback);
+}
+
+//! Advance steps of the analysis
+template <unsigned Tdim>
+mpm::Index mpm::MPMExplicit<Tdim>::advance(mpm::Index nsteps) {
+  if (pipeline_ == nullptr) {
+    console_->error("Steps are advanced before the analysis is initialised");
+    return 0;
+  }
+  auto timer = std::chrono::steady_clock::now();
+
+  mpm::Index nadvanced = 0;
+  for (; nadvanced < nsteps && step_ < nsteps_ && this->running();
+       ++step_, ++nadvanced) {
+    console_->info("Step: {} of {}.\n", step_, nsteps_);
+    // Time step from the critical time step of the mesh
+    this->update_time_step();
+    for (const auto& callback : step_callbacks_[StepEvent::Begin])
+      callback(step_, time_);
+
+    // Stages of each sub-step of the step, each of which is timed
+    for (substep_ = 0; substep_ < this->nsubsteps(); ++substep_)
+      pipeline_->run([this](const std::string& stage, double seconds) {
+        stage_times_[stage] += seconds;
+      });
+    substep_ = 0;
+    timer = std::chrono::steady_clock::now();
+
+    // Report the kernel failures of the step
+    this->summarise_step_errors();
+    this->time_ += this->dt_;
+    // Global diagnostics of the particles
+    this->update_diagnostics();
+    for (const auto& callback : step_callbacks_[StepEvent::End])
+      callback(step_, time_);
+
+    const bool steady_state = this->steady_state();
+    if (this->output_step() || steady_state) {
+      // Memory footprint of the mesh
+      this->report_footprint();
+      if (mass_scaling_)
+        console_->info("Step {}: added mass ratio {}", step_,
+                       added_mass_ratio_);
+      console_->info("Step {}: kinetic energy {}, momentum {}, max velocity {}",
+                     step_, diagnostics_.kinetic_energy,
+                     diagnostics_.momentum.norm(), diagnostics_.max_velocity);
+      if (steady_state)
+        console_->info("Steady state at step {} of {}", step_, nsteps_);
+      // Snapshots of the state at the end of the step are written by the
+      // output stage of the next step
+      this->snapshot_hdf5(step_, nsteps_);
+      this->snapshot_vtk(step_, nsteps_);
+      // Final output of a steady state includes a checkpoint
+      if (checkpoint_ || steady_state)
+        this->snapshot_checkpoint(step_, nsteps_);
+      // Schemes without an output stage write them right away
+      const auto names = pipeline_->names();
+      if (names.empty() || names.front() != "output")
+        this->write_pending_output();
+    }
+    this->stage_time("output", timer);
+  }
+  return nadvanced;
+}
+
+//! Write the pending outputs and wait for all outputs
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::finalise() {
+  auto timer = std::chrono::steady_clock::now();
+  // Flush pending outputs
+  this->write_pending_output();
+  this->wait_output();
+  this->stage_time("output", timer);
+}
+
+//! Return the stages of an explicit step which are available by name
+template <unsigned Tdim>
+template <typename Tkernels>
+std::map<std::string, mpm::ExplicitStage<Tdim>>
+    mpm::MPMExplicit<Tdim>::explicit_stages(unsigned phase) {
+  using ParticlePtr = std::shared_ptr<mpm::ParticleBase<Tdim>>;
+  using NodePtr = std::shared_ptr<mpm::NodeBase<Tdim>>;
+  auto* mesh = meshes_.at(0).get();
+  std::map<std::string, mpm::ExplicitStage<Tdim>> stages;
+
+  // Access to particles, nodes and cells
+  const auto read = mpm::StageAccess::Read;
+  const auto accumulate = mpm::StageAccess::Accumulate;
+  const auto write = mpm::StageAccess::Write;
+
+  // Write the snapshots of the last output step, which only access the
+  // output buffers
+  const auto output = [this]() { this->write_pending_output(); };
+  stages["output"] = {"output", output, {}, {{"outputs", write}}};
+
+  // Initialise nodes and activate the nodes of cells with particles
+  const auto initialise_nodes = [mesh]() {
+    mesh->iterate_over_nodes(
+        [](const NodePtr& node) { Tkernels::initialise(node); });
+
+    mesh->iterate_over_cells(
+        std::bind(&mpm::Cell<Tdim>::activate_nodes, std::placeholders::_1));
+  };
+  stages["initialise_nodes"] = {"initialise_nodes",
+                                initialise_nodes,
+                                {},
+                                {{"nodes", write}, {"cells", read}}};
+
+  // Initialise shape functions, volume and mass of particles
+  const auto initialise_particles = [this, mesh, phase]() {
+    // Iterate over each particle to compute shapefn
+    mesh->iterate_over_particles([](const ParticlePtr& particle) {
+      Tkernels::compute_shapefn(particle);
+    });
+
+    // Compute volume, unless assigned when particles were generated
+    if (!this->particle_volumes_)
+      mesh->iterate_over_particles([](const ParticlePtr& particle) {
+        Tkernels::compute_volume(particle);
+      });
+
+    // Compute mass
+    mesh->iterate_over_particles([phase](const ParticlePtr& particle) {
+      Tkernels::compute_mass(particle, phase);
+    });
+  };
+  stages["initialise_particles"] = {"initialise_particles",
+                                    initialise_particles,
+                                    {},
+                                    {{"particles", write}, {"cells", read}}};
+
+  // Assign mass and momentum to nodes and compute nodal velocity
+  const auto map_nodes = [mesh, phase]() {
+    mesh->iterate_over_particles([phase](const ParticlePtr& particle) {
+      Tkernels::map_mass_momentum_to_nodes(particle, phase);
+    });
+
+    mesh->iterate_over_nodes_predicate(
+        [](const NodePtr& node) { Tkernels::compute_velocity(node); },
+        [](const NodePtr& node) { return Tkernels::status(node); });
+  };
+  stages["map_nodes"] = {
+      "map_nodes", map_nodes, {}, {{"particles", read}, {"nodes", write}}};
+
+  // Compute strain and stress of particles
+  const auto strain = [this, phase](const ParticlePtr& particle) {
+    Tkernels::compute_strain(particle, phase, this->dt_);
+  };
+  const auto stress = [phase](const ParticlePtr& particle) {
+    Tkernels::compute_stress(particle, phase);
+  };
+  const auto strain_stress = [this, strain, stress]() {
+    this->iterate_step_particles(strain);
+    this->iterate_step_particles(stress);
+  };
+  stages["stress"] = {"stress",
+                      strain_stress,
+                      {strain, stress},
+                      {{"particles", write}, {"nodes", read}, {"cells", read}}};
+
+  // Map body force and internal force of particles to nodes, which both
+  // accumulate into nodes under their lock and run concurrently
+  const auto body_force = [this, phase](const ParticlePtr& particle) {
+    Tkernels::map_body_force(particle, phase, this->gravity_);
+  };
+  stages["body_force"] = {
+      "body_force",
+      [this, body_force]() { this->iterate_step_particles(body_force); },
+      {body_force},
+      {{"particles", read}, {"nodes", accumulate}}};
+
+  const auto internal_force = [phase](const ParticlePtr& particle) {
+    Tkernels::map_internal_force(particle, phase);
+  };
+  stages["internal_force"] = {
+      "internal_force",
+      [this, internal_force]() {
+        this->iterate_step_particles(internal_force);
+      },
+      {internal_force},
+      {{"particles", read}, {"nodes", accumulate}}};
+
+  // Compute acceleration and velocity of active nodes
+  const auto update_nodes = [this, mesh, phase]() {
+    mesh->iterate_over_nodes_predicate(
+        [this, phase](const NodePtr& node) {
+          Tkernels::compute_acceleration_velocity(node, phase, this->dt_);
+        },
+        [](const NodePtr& node) { return Tkernels::status(node); });
+  };
+  stages["update_nodes"] = {
+      "update_nodes", update_nodes, {}, {{"nodes", write}}};
+
+  // Compute updated position of particles
+  const auto position = [this, phase](const ParticlePtr& particle) {
+    Tkernels::compute_updated_position(particle, phase, this->dt_);
+  };
+  const auto update_particles = [this, position]() {
+    this->iterate_step_particles(position);
+  };
+  stages["update_particles"] = {"update_particles",
+                                update_particles,
+                                {position},
+                                {{"particles", write}, {"nodes", read}}};
+
+  // Locate particles in cells
+  const auto locate = [mesh]() {
+    auto unlocatable_particles = mesh->locate_particles_mesh();
+    if (!unlocatable_particles.empty())
+      throw std::runtime_error("Particle outside the mesh domain");
+  };
+  stages["locate"] = {
+      "locate", locate, {}, {{"particles", write}, {"cells", write}}};
+
+  return stages;
+}
+
+//! Iterate a kernel over the particles of the current sub-step
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::iterate_step_particles(
+    const typename mpm::ExplicitStage<Tdim>::ParticleKernel& kernel) {
+  meshes_.at(0)->iterate_over_particles(kernel);
+}
+
+//! Accumulate the wall time of a stage
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::stage_time(
+    const std::string& stage, std::chrono::steady_clock::time_point& start) {
+  const auto end = std::chrono::steady_clock::now();
+  stage_times_[stage] += std::chrono::duration<double>(end - start).count();
+  start = end;
+}
+
+//! Log a summary of the kernel failures of a step
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::summarise_step_errors() {
+  const auto counters = meshes_.at(0)->step_errors().collect();
+  for (unsigned i = 0; i < counters.size(); ++i)
+    if (counters[i] > 0)
+      console_->warn("Step {}: {} kernel failures, {}", step_, counters[i],
+                     mpm::StepErrors::description(
+                         static_cast<mpm::StepError>(i)));
+}
+
+//! Queue the writes of the pending snapshots
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::write_pending_output() {
+  for (auto& output : pending_outputs_)
+    *output.first = this->queue_output(output.second);
+  pending_outputs_.clear();
+}
+
+//! Log the memory footprint of the particles, nodes and cells of the mesh
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::report_footprint() {
+  const auto footprint = meshes_.at(0)->footprint();
+  // Average bytes of an entity
+  const auto average = [](std::size_t bytes, mpm::Index n) {
+    return n > 0 ? bytes / n : 0;
+  };
+  console_->info(
+      "Step {}: memory of {} particles x {} B, {} nodes x {} B, {} cells x {} "
+      "B, {:.2f} MiB in total",
+      step_, footprint.nparticles,
+      average(footprint.particles, footprint.nparticles), footprint.nnodes,
+      average(footprint.nodes, footprint.nnodes), footprint.ncells,
+      average(footprint.cells, footprint.ncells),
+      footprint.total() / (1024. * 1024.));
+}
+
+//! Scale the mass of particles and update an adaptive time step
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::update_time_step() {
+  const unsigned phase = 0;
+  // Critical time steps of scaled particles are at least the target time
+  // step of a step at the Courant number
+  if (mass_scaling_)
+    added_mass_ratio_ = meshes_.at(0)->scale_mass(
+        phase, mass_scaling_dt_ / cfl_, max_mass_scale_);
+
+  if (!adaptive_dt_) return;
+  double dt = cfl_ * meshes_.at(0)->critical_time_step(phase);
+  dt = std::min(std::max(dt, dt_min_), dt_max_);
+
+  // Steps end at output times and at the end of the analysis
+  if (output_time_ > 0. && next_output_time_ > time_)
+    dt = std::min(dt, next_output_time_ - time_);
+  if (end_time_ > time_) dt = std::min(dt, end_time_ - time_);
+  dt_ = dt;
+}
+
+//! Return if the current step is an output step
+template <unsigned Tdim>
+bool mpm::MPMExplicit<Tdim>::output_step() {
+  if (output_time_ <= 0.) return step_ % output_steps_ == 0;
+
+  // Round-off of the accumulated time is within the tolerance
+  const double tolerance = 1.E-9 * output_time_;
+  if (time_ < next_output_time_ - tolerance) return false;
+  // Output times passed in a single step are written once
+  while (next_output_time_ <= time_ + tolerance)
+    next_output_time_ += output_time_;
+  return true;
+}
+
+//! Set the next output time after the simulation time of a resumed analysis
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::resume_output_time() {
+  if (output_time_ <= 0.) return;
+  next_output_time_ =
+      (std::floor(time_ / output_time_ + 1.E-9) + 1.) * output_time_;
+}
+
+//! Compute the global diagnostics of the particles
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::update_diagnostics() {
+  const unsigned phase = 0;
+  diagnostics_ = meshes_.at(0)->diagnostics(phase);
+  if (steady_state_.empty()) return;
+
+  // Diagnostics which aren't thresholds are unbounded
+  const auto below = [this](const std::string& name, double value) {
+    const auto itr = steady_state_.find(name);
+    return itr == steady_state_.end() || value <= itr->second;
+  };
+  if (below("kinetic_energy", diagnostics_.kinetic_energy) &&
+      below("momentum", diagnostics_.momentum.norm()) &&
+      below("max_velocity", diagnostics_.max_velocity))
+    ++nsteady_steps_;
+  else
+    nsteady_steps_ = 0;
+}
+
+//! Return if the analysis hasn't reached its end time or a steady state
+template <unsigned Tdim>
+bool mpm::MPMExplicit<Tdim>::running() const {
+  if (this->steady_state()) return false;
+  if (end_time_ == std::numeric_limits<double>::max()) return true;
+  return time_ < end_time_ - 1.E-9 * end_time_;
+}
+
+//! Wait for an output and report errors
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::wait_output(std::shared_future<void>& output) {
+  if (!output.valid()) return;
+  try {
+    output.get();
+  } catch (std::exception& exception) {
+    console_->error("#{}: Writing output: {}", __LINE__, exception.what());
+  }
+  // Reset to report an error only once
+  output = std::shared_future<void>();
+}
+
+//! Wait until all pending outputs are written
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::wait_output() {
+  for (auto& output : hdf5_outputs_) this->wait_output(output);
+  for (auto& output : vtk_outputs_) this->wait_output(output);
+  for (auto& output : checkpoint_outputs_) this->wait_output(output);
+  this->wait_output(output_);
+}
+
 //! Write HDF5 files
 template <unsigned Tdim>
 void mpm::MPMExplicit<Tdim>::write_hdf5(mpm::Index step, mpm::Index max_steps) {
+  this->snapshot_hdf5(step, max_steps);
+  this->write_pending_output();
+}
+
+//! Take a snapshot of the particles for an HDF5 output
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::snapshot_hdf5(mpm::Index step,
+                                           mpm::Index max_steps) {
   // Write input geometry to vtk file
   std::string attribute = "particles";
   std::string extension = ".h5";
 
+  // A time series appends all steps to one file indexed by XDMF
   auto particles_file =
-      io_->output_file(attribute, extension, uuid_, step, max_steps).string();
+      (hdf5_options_.time_series
+           ? io_->output_file(attribute, extension, uuid_)
+           : io_->output_file(attribute, extension, uuid_, step, max_steps))
+          .string();
+  auto xdmf_file = io_->output_file(attribute, ".xdmf", uuid_).string();
+
+  // Swap buffers, waits only if the buffer of the output before the
+  // previous one is still being written
+  const unsigned buffer = hdf5_buffer_;
+  hdf5_buffer_ = (hdf5_buffer_ + 1) % hdf5_buffers_.size();
+  this->wait_output(hdf5_outputs_.at(buffer));
 
   const unsigned phase = 0;
-  meshes_.at(0)->write_particles_hdf5(phase, particles_file);
+  const auto options = hdf5_options_;
+  // Snapshot particle data to the buffer
+  if (options.time_series) {
+    auto& columns = hdf5_columns_.at(buffer);
+    meshes_.at(0)->particles_hdf5(phase, columns);
+    const double time = time_;
+
+    // A run starts a new time series, unless it resumes one
+    const bool append = hdf5_series_;
+    hdf5_series_ = true;
+
+    // Append the snapshot and its step to the index while the solver
+    // continues
+    pending_outputs_.emplace_back(
+        &hdf5_outputs_.at(buffer), [particles_file, xdmf_file, &columns,
+                                    options, step, time, append]() {
+          if (!append) boost::filesystem::remove(particles_file);
+          if (!mpm::write_hdf5_time_series(particles_file, step, time,
+                                           columns, options))
+            throw std::runtime_error("HDF5 particle file cannot be written: " +
+                                     particles_file);
+          // XDMF refers to the HDF5 file relative to its own folder
+          const auto hdf5_file =
+              boost::filesystem::path(particles_file).filename().string();
+          const mpm::HDF5Step output{mpm::hdf5_step_group(step), step, time,
+                                     columns.size()};
+          if (append ? !mpm::append_xdmf(xdmf_file, hdf5_file, output)
+                     : !mpm::write_xdmf(xdmf_file, hdf5_file, {output}))
+            throw std::runtime_error("XDMF file cannot be written: " +
+                                     xdmf_file);
+        });
+  } else if (options.columnar) {
+    auto& columns = hdf5_columns_.at(buffer);
+    meshes_.at(0)->particles_hdf5(phase, columns);
+
+    // Write the snapshot while the solver continues
+    pending_outputs_.emplace_back(
+        &hdf5_outputs_.at(buffer), [particles_file, &columns, options]() {
+          if (!mpm::Mesh<Tdim>::write_particles_hdf5(particles_file, columns,
+                                                     options))
+            throw std::runtime_error("HDF5 particle file cannot be written: " +
+                                     particles_file);
+        });
+  } else {
+    auto& particle_data = hdf5_buffers_.at(buffer);
+    meshes_.at(0)->particles_hdf5(phase, particle_data);
+
+    // Write the snapshot while the solver continues
+    pending_outputs_.emplace_back(
+        &hdf5_outputs_.at(buffer), [particles_file, &particle_data, options]() {
+          if (!mpm::Mesh<Tdim>::write_particles_hdf5(particles_file,
+                                                     particle_data, options))
+            throw std::runtime_error("HDF5 particle file cannot be written: " +
+                                     particles_file);
+        });
+  }
+}
+
+//! Write a binary checkpoint of the complete particle state
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::write_checkpoint(mpm::Index step,
+                                              mpm::Index max_steps) {
+  this->snapshot_checkpoint(step, max_steps);
+  this->write_pending_output();
+}
+
+//! Take a snapshot of the particle state for a binary checkpoint
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::snapshot_checkpoint(mpm::Index step,
+                                                 mpm::Index max_steps) {
+  auto checkpoint_file =
+      io_->output_file("checkpoint", ".bin", uuid_, step, max_steps).string();
+
+  // Swap buffers, waits only if the buffer of the output before the
+  // previous one is still being written
+  const unsigned buffer = checkpoint_buffer_;
+  checkpoint_buffer_ = (checkpoint_buffer_ + 1) % checkpoint_buffers_.size();
+  this->wait_output(checkpoint_outputs_.at(buffer));
+
+  // Snapshot particle state to the buffer
+  auto& particles = checkpoint_buffers_.at(buffer);
+  meshes_.at(0)->particles_checkpoint(particles);
+  const auto header =
+      mpm::checkpoint_header(Tdim, particles.size(), step, time_);
+
+  // Write the snapshot while the solver continues
+  pending_outputs_.emplace_back(
+      &checkpoint_outputs_.at(buffer), [checkpoint_file, header, &particles]() {
+        if (!mpm::write_checkpoint(checkpoint_file, header, particles))
+          throw std::runtime_error("Checkpoint file cannot be written: " +
+                                   checkpoint_file);
+      });
 }
 
-#ifdef USE_VTK
 //! Write VTK files
 template <unsigned Tdim>
 void mpm::MPMExplicit<Tdim>::write_vtk(mpm::Index step, mpm::Index max_steps) {
-  const auto coordinates = meshes_.at(0)->particle_coordinates();
-  // VTK PolyData writer
-  auto vtk_writer = std::make_unique<VtkWriter>(coordinates);
+  this->snapshot_vtk(step, max_steps);
+  this->write_pending_output();
+}
 
-  // Write input geometry to vtk file
-  std::string attribute = "geometry";
-  std::string extension = ".vtp";
+//! Take a snapshot of the particles for a VTK output
+template <unsigned Tdim>
+void mpm::MPMExplicit<Tdim>::snapshot_vtk(mpm::Index step,
+                                          mpm::Index max_steps) {
+  if (vtk_format_ == "none") return;
 
-  auto meshfile =
-      io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-  vtk_writer->write_geometry(meshfile);
+  // Write particles and their fields to a single vtk file
+  std::string attribute = "particles";
+  std::string extension = "." + vtk_format_;
 
-  unsigned phase = 0;
-  // Write stress vector
-  attribute = "stresses";
-  auto stress_file =
+  auto particles_file =
       io_->output_file(attribute, extension, uuid_, step, max_steps).string();
-  vtk_writer->write_vector_point_data(
-      stress_file, meshes_.at(0)->particle_stresses(phase), attribute);
+
+  // Swap buffers, waits only if the buffer of the output before the
+  // previous one is still being written
+  const unsigned buffer = vtk_buffer_;
+  vtk_buffer_ = (vtk_buffer_ + 1) % vtk_columns_.size();
+  this->wait_output(vtk_outputs_.at(buffer));
+
+  // Snapshot particle data to the buffer
+  const unsigned phase = 0;
+  auto& columns = vtk_columns_.at(buffer);
+  meshes_.at(0)->particles_hdf5(phase, columns);
+
+  // Write the snapshot while the solver continues
+  const auto write = [particles_file, &columns]() {
+    const unsigned nvector = HDF5ParticleColumns::Nvector;
+    const unsigned ntensor = HDF5ParticleColumns::Ntensor;
+    mpm::VtkXmlWriter vtk_writer(columns.size(), columns.coordinates.data());
+    vtk_writer.add_point_data("id", 1, columns.id.data());
+    vtk_writer.add_point_data("mass", 1, columns.mass.data());
+    vtk_writer.add_point_data("velocities", nvector, columns.velocities.data());
+    vtk_writer.add_point_data("stresses", ntensor, columns.stresses.data());
+    vtk_writer.add_point_data("strains", ntensor, columns.strains.data());
+    vtk_writer.add_point_data("volumetric_strains", 1,
+                              columns.volumetric_strains.data());
+    vtk_writer.add_point_data("status", 1, columns.status.data());
+    if (!vtk_writer.write(particles_file))
+      throw std::runtime_error("VTK particle file cannot be written: " +
+                               particles_file);
+  };
+  pending_outputs_.emplace_back(&vtk_outputs_.at(buffer), write);
 }
-#endif
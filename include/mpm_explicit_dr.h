@@ -0,0 +1,88 @@
+#ifndef MPM_MPM_EXPLICIT_DR_H_
+#define MPM_MPM_EXPLICIT_DR_H_
+
+#include <limits>
+#include <map>
+#include <string>
+
+#include "container.h"
+#include "mpm.h"
+#include "mpm_explicit.h"
+#include "particle.h"
+#include "step_kernels.h"
+
+namespace mpm {
+
+//! MPMExplicitDR class
+//! \brief Explicit one phase mpm with dynamic relaxation
+//! \details A single-phase explicit MPM with USF, which damps the dynamics
+//! until the out-of-balance force ratio falls below a tolerance, and writes
+//! the quasi-static equilibrium as a checkpoint to resume an analysis from
+//! \tparam Tdim Dimension
+//! \tparam Tkernels Kernels of a step, through the virtual interfaces of the
+//! entities or over their concrete types
+template <unsigned Tdim, typename Tkernels = VirtualKernels<Tdim>>
+class MPMExplicitDR : public MPMExplicit<Tdim> {
+ public:
+  //! Constructor
+  MPMExplicitDR(std::unique_ptr<IO>&& io);
+
+  //! Solve, and write a checkpoint of the equilibrium at rest
+  bool solve() override;
+
+  //! Initialise the analysis and the stages of dynamic relaxation
+  bool initialise() override;
+
+  //! Return the out-of-balance force ratio of the last step
+  double unbalanced_force_ratio() const { return unbalanced_force_ratio_; }
+
+  //! Return if the out-of-balance force ratio is below the tolerance
+  bool equilibrium() const { return unbalanced_force_ratio_ < tolerance_; }
+
+ protected:
+  //! Return if the analysis is running and not in equilibrium
+  bool running() const override;
+
+  //! Return the stages of dynamic relaxation: damping, which computes the
+  //! out-of-balance force ratio and adds viscous damping forces to the nodal
+  //! forces before the nodes are updated, and kinetic_damping, which stops
+  //! the particles at peaks of their kinetic energy
+  //! \param[in] phase Index corresponding to the phase
+  std::map<std::string, mpm::ExplicitStage<Tdim>> damping_stages(
+      unsigned phase);
+
+  // Generate a unique id for the analysis
+  using mpm::MPMExplicit<Tdim>::uuid_;
+  //! Time step size
+  using mpm::MPMExplicit<Tdim>::dt_;
+  //! Current step
+  using mpm::MPMExplicit<Tdim>::step_;
+  //! Number of steps
+  using mpm::MPMExplicit<Tdim>::nsteps_;
+  //! A unique ptr to IO object
+  using mpm::MPMExplicit<Tdim>::io_;
+  //! JSON analysis object
+  using mpm::MPMExplicit<Tdim>::analysis_;
+  //! Logger
+  using mpm::MPMExplicit<Tdim>::console_;
+
+  //! Mesh object
+  using mpm::MPMExplicit<Tdim>::meshes_;
+
+ private:
+  //! Damping of the dynamics, kinetic or viscous
+  std::string damping_{"kinetic"};
+  //! Coefficient of viscous damping, per unit of time
+  double damping_coefficient_{0.};
+  //! Tolerance of the out-of-balance force ratio
+  double tolerance_{1.E-3};
+  //! Out-of-balance force ratio of the last step
+  double unbalanced_force_ratio_{std::numeric_limits<double>::max()};
+  //! Kinetic energy of the particles in the last step
+  double kinetic_energy_{0.};
+};  // MPMExplicitDR class
+}  // namespace mpm
+
+#include "mpm_explicit_dr.tcc"
+
+#endif  // MPM_MPM_EXPLICIT_DR_H_
@@ -0,0 +1,148 @@
+//! Constructor
+template <unsigned Tdim, typename Tkernels>
+mpm::MPMExplicitDR<Tdim, Tkernels>::MPMExplicitDR(std::unique_ptr<IO>&& io)
+    : mpm::MPMExplicit<Tdim>(std::move(io)) {
+  //! Logger
+  console_ = spdlog::get("MPMExplicitDR");
+
+  try {
+    // Damping and tolerance of the dynamic relaxation
+    if (analysis_.find("dynamic_relaxation") != analysis_.end()) {
+      const auto relaxation = analysis_.at("dynamic_relaxation");
+      if (relaxation.find("damping") != relaxation.end())
+        damping_ = relaxation.at("damping").template get<std::string>();
+      if (relaxation.find("damping_coefficient") != relaxation.end())
+        damping_coefficient_ =
+            relaxation.at("damping_coefficient").template get<double>();
+      if (relaxation.find("tolerance") != relaxation.end())
+        tolerance_ = relaxation.at("tolerance").template get<double>();
+    }
+    if (damping_ != "kinetic" && damping_ != "viscous")
+      throw std::domain_error("Damping should be kinetic or viscous: " +
+                              damping_);
+    if (damping_coefficient_ < 0.)
+      throw std::domain_error("Damping coefficient should be positive");
+    if (tolerance_ <= 0.)
+      throw std::domain_error("Tolerance of the out-of-balance force ratio "
+                              "should be positive");
+  } catch (std::domain_error& domain_error) {
+    console_->error(" {} {} Get dynamic relaxation: {}", __FILE__, __LINE__,
+                    domain_error.what());
+    abort();
+  }
+}
+
+//! Initialise the MPM Explicit dynamic relaxation scheme
+template <unsigned Tdim, typename Tkernels>
+bool mpm::MPMExplicitDR<Tdim, Tkernels>::initialise() {
+  const unsigned phase = 0;
+
+  // Steps of USF, in which the nodal forces are damped before they update
+  // the nodes
+  std::vector<std::string> order{"output",
+                                 "initialise_nodes",
+                                 "initialise_particles",
+                                 "map_nodes",
+                                 "stress",
+                                 "body_force",
+                                 "internal_force",
+                                 "damping",
+                                 "update_nodes",
+                                 "update_particles",
+                                 "locate"};
+  if (damping_ == "kinetic") order.insert(order.end() - 1, "kinetic_damping");
+
+  return this->template initialise_stages<Tkernels>(
+      order, this->damping_stages(phase));
+}
+
+//! MPM Explicit dynamic relaxation solver
+template <unsigned Tdim, typename Tkernels>
+bool mpm::MPMExplicitDR<Tdim, Tkernels>::solve() {
+  const unsigned phase = 0;
+
+  bool status = mpm::MPMExplicit<Tdim>::solve();
+  if (step_ == 0) return false;
+
+  // Equilibrium at rest, which is the initial state of a resumed analysis
+  meshes_.at(0)->iterate_over_particles(
+      [phase](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        particle->assign_velocity(phase,
+                                  Eigen::Matrix<double, Tdim, 1>::Zero());
+      });
+  this->time_ = 0.;
+
+  // Checkpoint of the last step
+  const mpm::Index step = step_ - 1;
+  this->write_checkpoint(step, nsteps_);
+  this->wait_output();
+  const auto checkpoint_file =
+      io_->output_file("checkpoint", ".bin", uuid_, step, nsteps_)
+          .filename()
+          .string();
+
+  if (!this->equilibrium()) {
+    console_->error(
+        "No equilibrium after step {}, out-of-balance force ratio {}", step,
+        unbalanced_force_ratio_);
+    return false;
+  }
+  console_->info(
+      "Equilibrium at step {}, out-of-balance force ratio {}, resume from "
+      "checkpoint {} of analysis {}",
+      step, unbalanced_force_ratio_, checkpoint_file, uuid_);
+  return status;
+}
+
+//! Return if the analysis is running and not in equilibrium
+template <unsigned Tdim, typename Tkernels>
+bool mpm::MPMExplicitDR<Tdim, Tkernels>::running() const {
+  return !this->equilibrium() && mpm::MPMExplicit<Tdim>::running();
+}
+
+//! Return the stages of dynamic relaxation
+template <unsigned Tdim, typename Tkernels>
+std::map<std::string, mpm::ExplicitStage<Tdim>>
+    mpm::MPMExplicitDR<Tdim, Tkernels>::damping_stages(unsigned phase) {
+  using ParticlePtr = std::shared_ptr<mpm::ParticleBase<Tdim>>;
+  using NodePtr = std::shared_ptr<mpm::NodeBase<Tdim>>;
+  auto* mesh = meshes_.at(0).get();
+  std::map<std::string, mpm::ExplicitStage<Tdim>> stages;
+
+  // Out-of-balance force ratio of the nodal forces, and viscous damping
+  // forces, which the nodes integrate with the other forces
+  const auto damping = [this, mesh, phase]() {
+    unbalanced_force_ratio_ = mesh->unbalanced_force_ratio(phase);
+    if (damping_ != "viscous") return;
+
+    const double coefficient = damping_coefficient_;
+    mesh->iterate_over_nodes_predicate(
+        [phase, coefficient](const NodePtr& node) {
+          const Eigen::Matrix<double, Tdim, 1> damping =
+              -coefficient * node->mass(phase) * node->velocity(phase);
+          node->update_external_force(true, phase, damping);
+        },
+        [](const NodePtr& node) { return node->status(); });
+  };
+  stages["damping"] = {
+      "damping", damping, {}, {{"nodes", mpm::StageAccess::Write}}};
+
+  // Stop the particles at a peak of their kinetic energy
+  const auto kinetic_damping = [this, mesh, phase]() {
+    const double energy = mesh->diagnostics(phase).kinetic_energy;
+    if (energy >= kinetic_energy_) {
+      kinetic_energy_ = energy;
+      return;
+    }
+    mesh->iterate_over_particles([phase](const ParticlePtr& particle) {
+      particle->assign_velocity(phase, Eigen::Matrix<double, Tdim, 1>::Zero());
+    });
+    kinetic_energy_ = 0.;
+  };
+  stages["kinetic_damping"] = {"kinetic_damping",
+                               kinetic_damping,
+                               {},
+                               {{"particles", mpm::StageAccess::Write}}};
+
+  return stages;
+}
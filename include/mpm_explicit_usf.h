@@ -1,15 +1,28 @@
 #ifndef MPM_MPM_EXPLICIT_USF_H_
 #define MPM_MPM_EXPLICIT_USF_H_
 
+#include <atomic>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <boost/lexical_cast.hpp>
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
 
+#include <tbb/concurrent_vector.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_for_each.h>
+
 #include "container.h"
 #include "mpm.h"
 #include "mpm_explicit.h"
 #include "particle.h"
+#include "step_kernels.h"
 
 namespace mpm {
 
@@ -17,16 +30,77 @@ namespace mpm {
 //! \brief Explicit one phase mpm with USF
 //! \details A single-phase explicit MPM with Update Stress Last
 //! \tparam Tdim Dimension
-template <unsigned Tdim>
+//! \tparam Tkernels Kernels of a step, through the virtual interfaces of the
+//! entities or over their concrete types
+template <unsigned Tdim, typename Tkernels = VirtualKernels<Tdim>>
 class MPMExplicitUSF : public MPMExplicit<Tdim> {
  public:
   //! Constructor
   MPMExplicitUSF(std::unique_ptr<IO>&& io);
 
-  //! Solve
-  bool solve() override;
+  //! Initialise the analysis and the stages of the USF scheme
+  bool initialise() override;
+
+  //! Return the number of sub-steps of the last step, which is one without
+  //! sub-cycling
+  unsigned nsubcycles() const { return nsubcycles_; }
+
+  //! Return the number of particles in each rate class of the last step
+  std::vector<mpm::Index> rate_classes() const;
+
+  //! Return the number of nodes of the last step which are integrated over
+  //! each sub-step, which are the nodes of the cells of the fast particles
+  std::size_t nsubcycled_nodes() const { return held_nodes_.size(); }
 
  protected:
+  //! Return the stages of sub-cycling, whose sub-steps after the first only
+  //! iterate over the fast particles, i.e. the particles of the classes
+  //! above the first, and the nodes of their cells. The slow particles are
+  //! moved at the last sub-step, over the step. Stages which differ from
+  //! the stages of a step are rate_classes, which groups the particles by
+  //! their critical time step, hold_nodes, which holds the mass, momentum
+  //! and forces of the slow particles at the nodes of the fast particles
+  //! over the sub-steps, and the stages which only update the fast
+  //! particles and their nodes after the first sub-step.
+  //! \param[in] phase Index corresponding to the phase
+  std::map<std::string, mpm::ExplicitStage<Tdim>> subcycling_stages(
+      unsigned phase);
+
+  //! Return the number of sub-steps of the current step
+  unsigned nsubsteps() const override { return nsubcycles_; }
+
+  //! Iterate a kernel over all particles in the first sub-step of a step,
+  //! and over the fast particles in the other sub-steps
+  //! \param[in] kernel Kernel of a particle
+  void iterate_step_particles(
+      const typename mpm::ExplicitStage<Tdim>::ParticleKernel& kernel)
+      override;
+
+  //! Iterate an operation over the particles of a rate class in parallel
+  //! \param[in] level Rate class
+  //! \param[in] oper Operation on a particle
+  //! \tparam Toper Callable on a particle
+  template <typename Toper>
+  void iterate_over_class(unsigned level, Toper oper);
+
+  //! Iterate an operation over the particles of the classes above the first
+  //! \param[in] oper Operation on a particle
+  //! \tparam Toper Callable on a particle
+  template <typename Toper>
+  void iterate_over_fast_particles(Toper oper);
+
+  //! Update the strain and stress of the classes whose steps start at a
+  //! sub-step, over the steps of the classes
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] substep Index of the sub-step in the step
+  void update_stress(unsigned phase, unsigned substep);
+
+  //! Add the nodes of the cells of the fast particles which aren't held yet
+  //! to the held nodes, with the mass, momentum and forces of the nodes,
+  //! and the velocity change of the nodes over the sub-steps so far
+  //! \param[in] phase Index corresponding to the phase
+  void add_held_nodes(unsigned phase);
+
   // Generate a unique id for the analysis
   using mpm::MPMExplicit<Tdim>::uuid_;
   //! Time step size
@@ -52,7 +126,38 @@ class MPMExplicitUSF : public MPMExplicit<Tdim> {
   using mpm::MPMExplicit<Tdim>::meshes_;
   //! Materials
   using mpm::MPMExplicit<Tdim>::materials_;
+  //! Particle volumes are assigned at generation
+  using mpm::MPMExplicit<Tdim>::particle_volumes_;
+  //! Courant number
+  using mpm::MPMExplicit<Tdim>::cfl_;
 
+ private:
+  //! Sub-cycle fast particles within a step
+  bool subcycling_{false};
+  //! Maximum rate class, whose particles update their stress 2^max_level
+  //! times a step
+  unsigned max_level_{4};
+  //! Number of sub-steps of the last step
+  unsigned nsubcycles_{1};
+  //! Particles of each rate class, whose particles update their stress
+  //! 2^class times a step
+  std::vector<tbb::concurrent_vector<std::shared_ptr<ParticleBase<Tdim>>>>
+      classes_;
+  //! Nodes of the cells of the fast particles in the step, which are
+  //! integrated over each sub-step
+  std::vector<std::shared_ptr<NodeBase<Tdim>>> held_nodes_;
+  //! Index of the held nodes by node id
+  std::unordered_map<mpm::Index, std::size_t> held_index_;
+  //! Mass of the slow particles at the held nodes
+  Eigen::VectorXd held_mass_;
+  //! Momentum of the slow particles at the held nodes
+  Eigen::Matrix<double, Tdim, Eigen::Dynamic> held_momentum_;
+  //! External force of the slow particles at the held nodes
+  Eigen::Matrix<double, Tdim, Eigen::Dynamic> held_external_force_;
+  //! Internal force of the slow particles at the held nodes
+  Eigen::Matrix<double, Tdim, Eigen::Dynamic> held_internal_force_;
+  //! Velocity change of the held nodes over the sub-steps of the step
+  Eigen::Matrix<double, Tdim, Eigen::Dynamic> velocity_change_;
 };  // MPMExplicitUSF class
 }  // namespace mpm
 
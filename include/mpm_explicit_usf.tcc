@@ -1,123 +1,383 @@
 //! Constructor
-template <unsigned Tdim>
-mpm::MPMExplicitUSF<Tdim>::MPMExplicitUSF(std::unique_ptr<IO>&& io)
+template <unsigned Tdim, typename Tkernels>
+mpm::MPMExplicitUSF<Tdim, Tkernels>::MPMExplicitUSF(std::unique_ptr<IO>&& io)
     : mpm::MPMExplicit<Tdim>(std::move(io)) {
   //! Logger
   console_ = spdlog::get("MPMExplicitUSF");
+
+  try {
+    // Sub-cycling of particles in rate classes, up to a number of sub-steps
+    if (analysis_.find("subcycling") != analysis_.end()) {
+      subcycling_ = true;
+      const auto subcycling = analysis_.at("subcycling");
+      unsigned max_subcycles = 1u << max_level_;
+      if (subcycling.find("max_subcycles") != subcycling.end())
+        max_subcycles =
+            subcycling.at("max_subcycles").template get<unsigned>();
+      if (max_subcycles == 0)
+        throw std::domain_error("Maximum number of sub-cycles should be "
+                                "positive");
+      // Classes take a power of two sub-steps
+      max_level_ = 0;
+      while ((2u << max_level_) <= max_subcycles) ++max_level_;
+    }
+  } catch (std::domain_error& domain_error) {
+    console_->error(" {} {} Get sub-cycling: {}", __FILE__, __LINE__,
+                    domain_error.what());
+    abort();
+  }
 }
 
-//! MPM Explicit USF solver
-template <unsigned Tdim>
-bool mpm::MPMExplicitUSF<Tdim>::solve() {
-  bool status = true;
+//! Initialise the MPM Explicit USF scheme
+template <unsigned Tdim, typename Tkernels>
+bool mpm::MPMExplicitUSF<Tdim, Tkernels>::initialise() {
+  // Stress is updated from the nodal velocity of the mapped momentum, before
+  // the forces are computed
+  if (!subcycling_)
+    return this->template initialise_stages<Tkernels>(
+        {"output", "initialise_nodes", "initialise_particles", "map_nodes",
+         "stress", "body_force", "internal_force", "update_nodes",
+         "update_particles", "locate"});
 
-  // Phase
   const unsigned phase = 0;
-  // Initialise material
-  bool mat_status = this->initialise_materials();
-  if (!mat_status) status = false;
-
-  // Initialise mesh and materials
-  bool mesh_status = this->initialise_mesh_particles();
-  if (!mesh_status) status = false;
-
-  // Assign material to particles
-  // Get mesh properties
-  auto mesh_props = io_->json_object("mesh");
-  // Material id
-  const auto material_id = mesh_props["material_id"].template get<unsigned>();
-
-  // Get material from list of materials
-  auto material = materials_.at(material_id);
-
-  // Iterate over each particle to assign material
-  meshes_.at(0)->iterate_over_particles(
-      std::bind(&mpm::ParticleBase<Tdim>::assign_material,
-                std::placeholders::_1, material));
-
-  // Test if checkpoint resume is needed
-  bool resume = false;
-  if (analysis_.find("resume") != analysis_.end())
-    resume = analysis_["resume"]["resume"].template get<bool>();
-  if (resume) this->checkpoint_resume();
-
-  // Main loop
-  for (; step_ < nsteps_; ++step_) {
-    console_->info("Step: {} of {}.\n", step_, nsteps_);
-    // Initialise nodes
-    meshes_.at(0)->iterate_over_nodes(
-        std::bind(&mpm::NodeBase<Tdim>::initialise, std::placeholders::_1));
-
-    meshes_.at(0)->iterate_over_cells(
-        std::bind(&mpm::Cell<Tdim>::activate_nodes, std::placeholders::_1));
-
-    // Iterate over each particle to compute shapefn
-    meshes_.at(0)->iterate_over_particles(std::bind(
-        &mpm::ParticleBase<Tdim>::compute_shapefn, std::placeholders::_1));
-
-    // Compute volume
-    meshes_.at(0)->iterate_over_particles(std::bind(
-        &mpm::ParticleBase<Tdim>::compute_volume, std::placeholders::_1));
-
-    // Compute mass
-    meshes_.at(0)->iterate_over_particles(std::bind(
-        &mpm::ParticleBase<Tdim>::compute_mass, std::placeholders::_1, phase));
-    // Assign mass and momentum to nodes
-    meshes_.at(0)->iterate_over_particles(
-        std::bind(&mpm::ParticleBase<Tdim>::map_mass_momentum_to_nodes,
-                  std::placeholders::_1, phase));
-
-    // Compute nodal velocity
-    meshes_.at(0)->iterate_over_nodes_predicate(
-        std::bind(&mpm::NodeBase<Tdim>::compute_velocity,
-                  std::placeholders::_1),
-        std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
-
-    // Iterate over each particle to calculate strain
-    meshes_.at(0)->iterate_over_particles(
-        std::bind(&mpm::ParticleBase<Tdim>::compute_strain,
-                  std::placeholders::_1, phase, dt_));
-
-    // Iterate over each particle to compute stress
-    meshes_.at(0)->iterate_over_particles(
-        std::bind(&mpm::ParticleBase<Tdim>::compute_stress,
-                  std::placeholders::_1, phase));
-
-    // Iterate over each particle to compute nodal body force
-    meshes_.at(0)->iterate_over_particles(
-        std::bind(&mpm::ParticleBase<Tdim>::map_body_force,
-                  std::placeholders::_1, phase, this->gravity_));
-
-    // Iterate over each particle to compute nodal internal force
-    meshes_.at(0)->iterate_over_particles(
-        std::bind(&mpm::ParticleBase<Tdim>::map_internal_force,
-                  std::placeholders::_1, phase));
-
-    // Iterate over active nodes to compute acceleratation and velocity
-    meshes_.at(0)->iterate_over_nodes_predicate(
-        std::bind(&mpm::NodeBase<Tdim>::compute_acceleration_velocity,
-                  std::placeholders::_1, phase, this->dt_),
-        std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
-
-    // Iterate over each particle to compute updated position
-    meshes_.at(0)->iterate_over_particles(
-        std::bind(&mpm::ParticleBase<Tdim>::compute_updated_position,
-                  std::placeholders::_1, phase, this->dt_));
-
-    // Locate particles
-    auto unlocatable_particles = meshes_.at(0)->locate_particles_mesh();
-
-    if (!unlocatable_particles.empty())
+  // Each sub-step of a step runs the stages of a step, which only update
+  // the fast particles and the nodes of their cells after the first
+  // sub-step, while the slow particles are held until the last sub-step
+  return this->template initialise_stages<Tkernels>(
+      {"output", "initialise_nodes", "initialise_particles", "rate_classes",
+       "map_nodes", "stress", "body_force", "internal_force", "hold_nodes",
+       "update_nodes", "update_particles", "locate"},
+      this->subcycling_stages(phase));
+}
+
+//! Return the number of particles in each rate class of the last step
+template <unsigned Tdim, typename Tkernels>
+std::vector<mpm::Index> mpm::MPMExplicitUSF<Tdim, Tkernels>::rate_classes()
+    const {
+  std::vector<mpm::Index> nparticles;
+  for (const auto& particles : classes_)
+    nparticles.emplace_back(particles.size());
+  return nparticles;
+}
+
+//! Return the stages of sub-cycling
+template <unsigned Tdim, typename Tkernels>
+std::map<std::string, mpm::ExplicitStage<Tdim>>
+    mpm::MPMExplicitUSF<Tdim, Tkernels>::subcycling_stages(unsigned phase) {
+  using ParticlePtr = std::shared_ptr<mpm::ParticleBase<Tdim>>;
+  using NodePtr = std::shared_ptr<mpm::NodeBase<Tdim>>;
+  auto* mesh = meshes_.at(0).get();
+  // Stages of a step, which run in the first sub-step of a step
+  const auto step = this->template explicit_stages<Tkernels>(phase);
+  std::map<std::string, mpm::ExplicitStage<Tdim>> stages;
+
+  // Access to particles, nodes and cells
+  const auto read = mpm::StageAccess::Read;
+  const auto write = mpm::StageAccess::Write;
+
+  // Particles of class k update their stress 2^k times a step, so that the
+  // step of their stress is within their critical time step at the Courant
+  // number, and a step takes as many sub-steps as its fastest class
+  const auto rate_classes = [this, mesh, phase]() {
+    if (this->substep_ > 0) return;
+    const double dt = this->dt_;
+    classes_.clear();
+    classes_.resize(max_level_ + 1);
+    mesh->iterate_over_particles(
+        [this, phase, dt](const ParticlePtr& particle) {
+          const double critical = cfl_ * particle->critical_time_step(phase);
+          unsigned level = 0;
+          while (level < max_level_ && critical * (1u << level) < dt) ++level;
+          classes_[level].push_back(particle);
+        });
+
+    unsigned level = 0;
+    for (unsigned i = 0; i < classes_.size(); ++i)
+      if (!classes_[i].empty()) level = i;
+    nsubcycles_ = 1u << level;
+
+    // Nodes of the fast particles are held by the hold_nodes stage
+    held_nodes_.clear();
+    held_index_.clear();
+  };
+  stages["rate_classes"] = {
+      "rate_classes",
+      rate_classes,
+      {},
+      {{"particles", write}, {"nodes", write}, {"cells", read}}};
+
+  // Nodes of the cells with particles in the first sub-step, and the held
+  // nodes with the mass, momentum and forces of the slow particles in the
+  // other sub-steps, including the nodes of the cells which fast particles
+  // moved into
+  const auto initialise_all_nodes = step.at("initialise_nodes").run;
+  const auto initialise_nodes = [this, phase, initialise_all_nodes]() {
+    if (this->substep_ == 0) return initialise_all_nodes();
+
+    this->add_held_nodes(phase);
+    tbb::parallel_for(
+        std::size_t(0), held_nodes_.size(), [this, phase](std::size_t i) {
+          const auto& node = held_nodes_[i];
+          Tkernels::initialise(node);
+          node->update_mass(false, phase, held_mass_(i));
+          node->update_momentum(false, phase, held_momentum_.col(i));
+          node->update_external_force(false, phase,
+                                      held_external_force_.col(i));
+          node->update_internal_force(false, phase,
+                                      held_internal_force_.col(i));
+          node->assign_status(true);
+        });
+  };
+  stages["initialise_nodes"] = {
+      "initialise_nodes",
+      initialise_nodes,
+      {},
+      {{"particles", read}, {"nodes", write}, {"cells", read}}};
+
+  // Shape functions of the fast particles at their locations of a sub-step,
+  // whose volume and mass are unchanged over the step
+  const auto initialise_all_particles = step.at("initialise_particles").run;
+  const auto initialise_particles = [this, initialise_all_particles]() {
+    if (this->substep_ == 0) return initialise_all_particles();
+
+    this->iterate_over_fast_particles([](const ParticlePtr& particle) {
+      Tkernels::compute_shapefn(particle);
+    });
+  };
+  stages["initialise_particles"] = {"initialise_particles",
+                                    initialise_particles,
+                                    {},
+                                    {{"particles", write}, {"cells", read}}};
+
+  // Mass and momentum of the fast particles at the held nodes
+  const auto map_all_nodes = step.at("map_nodes").run;
+  const auto map_nodes = [this, phase, map_all_nodes]() {
+    if (this->substep_ == 0) return map_all_nodes();
+
+    this->iterate_over_fast_particles([phase](const ParticlePtr& particle) {
+      Tkernels::map_mass_momentum_to_nodes(particle, phase);
+    });
+    tbb::parallel_for(
+        std::size_t(0), held_nodes_.size(),
+        [this](std::size_t i) { Tkernels::compute_velocity(held_nodes_[i]); });
+  };
+  stages["map_nodes"] = {
+      "map_nodes", map_nodes, {}, {{"particles", read}, {"nodes", write}}};
+
+  // Strain and stress of the classes whose steps start at the sub-step,
+  // while the stress of the other classes is held over their steps
+  const auto stress = [this, phase]() {
+    this->update_stress(phase, this->substep_);
+  };
+  stages["stress"] = {"stress",
+                      stress,
+                      {},
+                      {{"particles", write}, {"nodes", read}, {"cells", read}}};
+
+  // Mass, momentum and forces of the slow particles at the nodes of the
+  // fast particles are the totals of the first sub-step less those of the
+  // fast particles, which include the coupled forces of the step
+  const auto hold_nodes = [this, phase]() {
+    if (this->substep_ > 0 || nsubcycles_ == 1) return;
+
+    this->add_held_nodes(phase);
+    tbb::parallel_for(
+        std::size_t(0), held_nodes_.size(),
+        [this](std::size_t i) { Tkernels::initialise(held_nodes_[i]); });
+    this->iterate_over_fast_particles(
+        [this, phase](const ParticlePtr& particle) {
+          Tkernels::map_mass_momentum_to_nodes(particle, phase);
+          Tkernels::map_body_force(particle, phase, this->gravity_);
+          Tkernels::map_internal_force(particle, phase);
+        });
+
+    // Totals of the first sub-step are restored at the held nodes
+    tbb::parallel_for(
+        std::size_t(0), held_nodes_.size(), [this, phase](std::size_t i) {
+          const auto& node = held_nodes_[i];
+          held_mass_(i) -= node->mass(phase);
+          held_momentum_.col(i) -= node->momentum(phase);
+          held_external_force_.col(i) -= node->external_force(phase);
+          held_internal_force_.col(i) -= node->internal_force(phase);
+
+          node->update_mass(true, phase, held_mass_(i));
+          node->update_momentum(true, phase, held_momentum_.col(i));
+          node->update_external_force(true, phase,
+                                      held_external_force_.col(i));
+          node->update_internal_force(true, phase,
+                                      held_internal_force_.col(i));
+          node->assign_status(true);
+          Tkernels::compute_velocity(node);
+        });
+  };
+  stages["hold_nodes"] = {
+      "hold_nodes", hold_nodes, {}, {{"particles", read}, {"nodes", write}}};
+
+  // Held nodes are integrated over the sub-step, and the other nodes over
+  // the step in the first sub-step
+  const auto update_nodes = [this, mesh, phase]() {
+    const double dt = this->dt_ / nsubcycles_;
+    if (this->substep_ == 0)
+      mesh->iterate_over_nodes_predicate(
+          [this, phase](const NodePtr& node) {
+            Tkernels::compute_acceleration_velocity(node, phase, this->dt_);
+          },
+          [this](const NodePtr& node) {
+            return Tkernels::status(node) &&
+                   held_index_.find(node->id()) == held_index_.end();
+          });
+
+    tbb::parallel_for(
+        std::size_t(0), held_nodes_.size(), [this, phase, dt](std::size_t i) {
+          const auto& node = held_nodes_[i];
+          Tkernels::compute_acceleration_velocity(node, phase, dt);
+          velocity_change_.col(i) += node->acceleration(phase) * dt;
+        });
+  };
+  stages["update_nodes"] = {
+      "update_nodes", update_nodes, {}, {{"nodes", write}}};
+
+  // Fast particles are moved over the sub-step, and the slow particles over
+  // the step at the last sub-step, with the mean acceleration of the held
+  // nodes over the step
+  const auto update_particles = [this, phase]() {
+    const double dt = this->dt_ / nsubcycles_;
+    this->iterate_over_fast_particles(
+        [phase, dt](const ParticlePtr& particle) {
+          Tkernels::compute_updated_position(particle, phase, dt);
+        });
+    if (this->substep_ + 1 < nsubcycles_) return;
+
+    tbb::parallel_for(
+        std::size_t(0), held_nodes_.size(), [this, phase](std::size_t i) {
+          held_nodes_[i]->update_acceleration(
+              false, phase, velocity_change_.col(i) / this->dt_);
+        });
+    const auto position = [this, phase](const ParticlePtr& particle) {
+      Tkernels::compute_updated_position(particle, phase, this->dt_);
+    };
+    // Without sub-steps all particles are in the first class
+    if (nsubcycles_ == 1)
+      this->iterate_step_particles(position);
+    else
+      this->iterate_over_class(0, position);
+  };
+  stages["update_particles"] = {"update_particles",
+                                update_particles,
+                                {},
+                                {{"particles", write}, {"nodes", write}}};
+
+  // Fast particles are located after each sub-step, and all particles after
+  // the last sub-step
+  const auto locate_all = step.at("locate").run;
+  const auto locate = [this, mesh, locate_all]() {
+    if (this->substep_ + 1 == nsubcycles_) return locate_all();
+
+    std::atomic<bool> located{true};
+    this->iterate_over_fast_particles(
+        [mesh, &located](const ParticlePtr& particle) {
+          if (!mesh->locate_particle_cells(particle)) located = false;
+        });
+    if (!located)
       throw std::runtime_error("Particle outside the mesh domain");
+  };
+  stages["locate"] = {
+      "locate", locate, {}, {{"particles", write}, {"cells", write}}};
+  return stages;
+}
+
+//! Iterate a kernel over the particles of the current sub-step
+template <unsigned Tdim, typename Tkernels>
+void mpm::MPMExplicitUSF<Tdim, Tkernels>::iterate_step_particles(
+    const typename mpm::ExplicitStage<Tdim>::ParticleKernel& kernel) {
+  if (this->substep_ == 0)
+    mpm::MPMExplicit<Tdim>::iterate_step_particles(kernel);
+  else
+    this->iterate_over_fast_particles(kernel);
+}
+
+//! Iterate an operation over the particles of a rate class
+template <unsigned Tdim, typename Tkernels>
+template <typename Toper>
+void mpm::MPMExplicitUSF<Tdim, Tkernels>::iterate_over_class(unsigned level,
+                                                             Toper oper) {
+  using ParticlePtr = std::shared_ptr<mpm::ParticleBase<Tdim>>;
+  auto* errors = &meshes_.at(0)->step_errors();
+  tbb::parallel_for_each(classes_[level].begin(), classes_[level].end(),
+                         [errors, &oper](const ParticlePtr& particle) {
+                           mpm::StepErrors::Scope scope(errors);
+                           oper(particle);
+                         });
+}
+
+//! Iterate an operation over the particles of the classes above the first
+template <unsigned Tdim, typename Tkernels>
+template <typename Toper>
+void mpm::MPMExplicitUSF<Tdim, Tkernels>::iterate_over_fast_particles(
+    Toper oper) {
+  for (unsigned level = 1; level < classes_.size(); ++level)
+    this->iterate_over_class(level, oper);
+}
 
-    if (step_ % output_steps_ == 0) {
-      // HDF5 outputs
-      this->write_hdf5(this->step_, this->nsteps_);
-#ifdef USE_VTK
-      // VTK outputs
-      this->write_vtk(this->step_, this->nsteps_);
-#endif
+//! Update the strain and stress of the classes whose steps start at a
+//! sub-step
+template <unsigned Tdim, typename Tkernels>
+void mpm::MPMExplicitUSF<Tdim, Tkernels>::update_stress(unsigned phase,
+                                                        unsigned substep) {
+  using ParticlePtr = std::shared_ptr<mpm::ParticleBase<Tdim>>;
+  for (unsigned level = 0; level < classes_.size(); ++level) {
+    // Sub-steps of a step of the class
+    const unsigned nsubsteps = nsubcycles_ >> level;
+    if (classes_[level].empty() || substep % nsubsteps != 0) continue;
+    const double dt = nsubsteps * (this->dt_ / nsubcycles_);
+    this->iterate_over_class(level, [phase, dt](const ParticlePtr& particle) {
+      Tkernels::compute_strain(particle, phase, dt);
+      Tkernels::compute_stress(particle, phase);
+    });
+  }
+}
+
+//! Add the nodes of the cells of the fast particles to the held nodes
+template <unsigned Tdim, typename Tkernels>
+void mpm::MPMExplicitUSF<Tdim, Tkernels>::add_held_nodes(unsigned phase) {
+  std::vector<std::shared_ptr<mpm::NodeBase<Tdim>>> nodes;
+  for (unsigned level = 1; level < classes_.size(); ++level)
+    for (const auto& particle : classes_[level]) {
+      const auto cell = particle->cell();
+      if (cell == nullptr) continue;
+      for (unsigned i = 0; i < cell->nnodes(); ++i) {
+        const auto node = cell->node(i);
+        if (held_index_.emplace(node->id(), held_nodes_.size() + nodes.size())
+                .second)
+          nodes.emplace_back(node);
+      }
     }
+  if (held_nodes_.empty()) {
+    held_mass_.resize(0);
+    held_momentum_.resize(Tdim, 0);
+    held_external_force_.resize(Tdim, 0);
+    held_internal_force_.resize(Tdim, 0);
+    velocity_change_.resize(Tdim, 0);
+  }
+  if (nodes.empty()) return;
+
+  // Nodes which aren't held yet hold all of their mass, momentum and forces,
+  // and changed their velocity with their acceleration over the step so far
+  const std::size_t first = held_nodes_.size();
+  const std::size_t nheld = first + nodes.size();
+  held_mass_.conservativeResize(nheld);
+  held_momentum_.conservativeResize(Tdim, nheld);
+  held_external_force_.conservativeResize(Tdim, nheld);
+  held_internal_force_.conservativeResize(Tdim, nheld);
+  velocity_change_.conservativeResize(Tdim, nheld);
+  const double elapsed = this->substep_ * (this->dt_ / nsubcycles_);
+  for (std::size_t i = first; i < nheld; ++i) {
+    const auto& node = nodes[i - first];
+    held_mass_(i) = node->mass(phase);
+    held_momentum_.col(i) = node->momentum(phase);
+    held_external_force_.col(i) = node->external_force(phase);
+    held_internal_force_.col(i) = node->internal_force(phase);
+    velocity_change_.col(i) = node->acceleration(phase) * elapsed;
+    held_nodes_.emplace_back(node);
   }
-  return status;
 }
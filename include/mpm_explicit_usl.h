@@ -10,6 +10,7 @@
 #include "mpm.h"
 #include "mpm_explicit.h"
 #include "particle.h"
+#include "step_kernels.h"
 
 namespace mpm {
 
@@ -17,14 +18,16 @@ namespace mpm {
 //! \brief Explicit one phase mpm with USL
 //! \details A single-phase explicit MPM with Update Stress Last
 //! \tparam Tdim Dimension
-template <unsigned Tdim>
+//! \tparam Tkernels Kernels of a step, through the virtual interfaces of the
+//! entities or over their concrete types
+template <unsigned Tdim, typename Tkernels = VirtualKernels<Tdim>>
 class MPMExplicitUSL : public MPMExplicit<Tdim> {
  public:
   //! Constructor
   MPMExplicitUSL(std::unique_ptr<IO>&& io);
 
-  //! Solve
-  bool solve() override;
+  //! Initialise the analysis and the stages of the USL scheme
+  bool initialise() override;
 
  protected:
   // Generate a unique id for the analysis
@@ -52,6 +55,8 @@ class MPMExplicitUSL : public MPMExplicit<Tdim> {
   using mpm::MPMExplicit<Tdim>::meshes_;
   //! Materials
   using mpm::MPMExplicit<Tdim>::materials_;
+  //! Particle volumes are assigned at generation
+  using mpm::MPMExplicit<Tdim>::particle_volumes_;
 
 };  // MPMExplicitUSl class
 }  // namespace mpm
@@ -0,0 +1,82 @@
+#ifndef MPM_MPM_IMPLICIT_H_
+#define MPM_MPM_IMPLICIT_H_
+
+#include <limits>
+#include <map>
+#include <string>
+
+#include "container.h"
+#include "implicit_operator.h"
+#include "mpm.h"
+#include "mpm_explicit.h"
+#include "particle.h"
+#include "step_kernels.h"
+
+namespace mpm {
+
+//! MPMImplicit class
+//! \brief Implicit one phase mpm with Newmark time integration
+//! \details A single-phase MPM, in which the nodal displacements of a step
+//! solve the Newmark equations linearised about the stress at the start of
+//! the step, with the matrix-free operator of the nodal mass and the
+//! stiffness of the particles. Steps aren't limited by the critical time
+//! step of the mesh.
+//! \tparam Tdim Dimension
+//! \tparam Tkernels Kernels of a step, through the virtual interfaces of the
+//! entities or over their concrete types
+template <unsigned Tdim, typename Tkernels = VirtualKernels<Tdim>>
+class MPMImplicit : public MPMExplicit<Tdim> {
+ public:
+  //! Constructor
+  MPMImplicit(std::unique_ptr<IO>&& io);
+
+  //! Solve, which fails if the linear solver doesn't converge in a step
+  bool solve() override;
+
+  //! Initialise the analysis and the stages of the implicit scheme
+  bool initialise() override;
+
+  //! Return the total number of iterations of the linear solver
+  mpm::Index linear_iterations() const { return linear_iterations_; }
+
+ protected:
+  //! Return the implicit stage, which solves the nodal displacements of a
+  //! Newmark step and updates the nodal acceleration and velocity
+  //! \param[in] phase Index corresponding to the phase
+  std::map<std::string, mpm::ExplicitStage<Tdim>> implicit_stages(
+      unsigned phase);
+
+  //! Time step size
+  using mpm::MPMExplicit<Tdim>::dt_;
+  //! Current step
+  using mpm::MPMExplicit<Tdim>::step_;
+  //! JSON analysis object
+  using mpm::MPMExplicit<Tdim>::analysis_;
+  //! Logger
+  using mpm::MPMExplicit<Tdim>::console_;
+
+  //! Mesh object
+  using mpm::MPMExplicit<Tdim>::meshes_;
+
+ private:
+  //! Newmark beta
+  double beta_{0.25};
+  //! Newmark gamma
+  double gamma_{0.5};
+  //! Tolerance of the residual of the linear solver, relative to the
+  //! right-hand side
+  double tolerance_{1.E-8};
+  //! Maximum number of iterations of the linear solver in a step
+  unsigned max_iterations_{1000};
+  //! Linear solver converged in all steps
+  bool converged_{true};
+  //! Total number of iterations of the linear solver
+  mpm::Index linear_iterations_{0};
+  //! Matrix-free operator of a step
+  mpm::ImplicitOperator<Tdim> operator_;
+};  // MPMImplicit class
+}  // namespace mpm
+
+#include "mpm_implicit.tcc"
+
+#endif  // MPM_MPM_IMPLICIT_H_
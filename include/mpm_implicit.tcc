@@ -0,0 +1,130 @@
+//! Constructor
+template <unsigned Tdim, typename Tkernels>
+mpm::MPMImplicit<Tdim, Tkernels>::MPMImplicit(std::unique_ptr<IO>&& io)
+    : mpm::MPMExplicit<Tdim>(std::move(io)) {
+  //! Logger
+  console_ = spdlog::get("MPMImplicit");
+
+  try {
+    // Newmark parameters
+    if (analysis_.find("newmark") != analysis_.end()) {
+      const auto newmark = analysis_.at("newmark");
+      if (newmark.find("beta") != newmark.end())
+        beta_ = newmark.at("beta").template get<double>();
+      if (newmark.find("gamma") != newmark.end())
+        gamma_ = newmark.at("gamma").template get<double>();
+    }
+    if (beta_ <= 0.) throw std::domain_error("Newmark beta should be positive");
+    if (gamma_ < 0.5)
+      throw std::domain_error("Newmark gamma should be at least 0.5");
+
+    // Tolerance and iterations of the linear solver
+    if (analysis_.find("linear_solver") != analysis_.end()) {
+      const auto solver = analysis_.at("linear_solver");
+      if (solver.find("tolerance") != solver.end())
+        tolerance_ = solver.at("tolerance").template get<double>();
+      if (solver.find("max_iterations") != solver.end())
+        max_iterations_ = solver.at("max_iterations").template get<unsigned>();
+    }
+    if (tolerance_ <= 0.)
+      throw std::domain_error("Tolerance of the linear solver should be "
+                              "positive");
+  } catch (std::domain_error& domain_error) {
+    console_->error(" {} {} Get implicit parameters: {}", __FILE__, __LINE__,
+                    domain_error.what());
+    abort();
+  }
+}
+
+//! Initialise the MPM Implicit scheme
+template <unsigned Tdim, typename Tkernels>
+bool mpm::MPMImplicit<Tdim, Tkernels>::initialise() {
+  const unsigned phase = 0;
+
+  // Forces of the stress at the start of the step are mapped to the nodes,
+  // and the stress is updated from the solved nodal displacements
+  return this->template initialise_stages<Tkernels>(
+      {"output", "initialise_nodes", "initialise_particles", "map_nodes",
+       "body_force", "internal_force", "implicit", "update_particles",
+       "stress", "locate"},
+      this->implicit_stages(phase));
+}
+
+//! MPM Implicit solver
+template <unsigned Tdim, typename Tkernels>
+bool mpm::MPMImplicit<Tdim, Tkernels>::solve() {
+  bool status = mpm::MPMExplicit<Tdim>::solve();
+  console_->info("Linear solver iterations: {}", linear_iterations_);
+  return status && converged_;
+}
+
+//! Return the implicit stage
+template <unsigned Tdim, typename Tkernels>
+std::map<std::string, mpm::ExplicitStage<Tdim>>
+    mpm::MPMImplicit<Tdim, Tkernels>::implicit_stages(unsigned phase) {
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+  auto* mesh = meshes_.at(0).get();
+  std::map<std::string, mpm::ExplicitStage<Tdim>> stages;
+
+  // Solve the nodal displacements of a Newmark step, in which the nodal
+  // acceleration at the start of the step is in equilibrium with the forces
+  // M / (beta dt^2) du + K du = f / (2 beta) + M v / (beta dt)
+  const auto implicit = [this, mesh, phase]() {
+    const double dt = this->dt_;
+    const double beta = beta_;
+    const double gamma = gamma_;
+    operator_.assemble(*mesh, phase, 1. / (beta * dt * dt));
+    const auto& nodes = operator_.nodes();
+
+    // Right-hand side, and displacements at the nodal velocity, which
+    // prescribe the constrained degrees of freedom
+    Eigen::VectorXd rhs(operator_.ndofs());
+    Eigen::VectorXd displacement(operator_.ndofs());
+    tbb::parallel_for(std::size_t(0), nodes.size(), [&](std::size_t i) {
+      const VectorDim force =
+          nodes[i]->external_force(phase) + nodes[i]->internal_force(phase);
+      const VectorDim velocity = nodes[i]->velocity(phase);
+      rhs.segment(i * Tdim, Tdim) =
+          force / (2. * beta) + nodes[i]->mass(phase) * velocity / (beta * dt);
+      displacement.segment(i * Tdim, Tdim) = velocity * dt;
+    });
+
+    if (!operator_.solve(rhs, displacement, tolerance_, max_iterations_)) {
+      converged_ = false;
+      console_->warn(
+          "Step {}: linear solver didn't converge in {} iterations, residual "
+          "{}",
+          step_, operator_.iterations(), operator_.residual());
+    }
+    linear_iterations_ += operator_.iterations();
+
+    // Nodal acceleration is the change of velocity of the step, and the
+    // nodal velocity is the displacement of the step over the time step, so
+    // that the strain of the stress is B du
+    tbb::parallel_for(std::size_t(0), nodes.size(), [&](std::size_t i) {
+      const double mass = nodes[i]->mass(phase);
+      if (!(mass > std::numeric_limits<double>::min())) return;
+      const VectorDim velocity = nodes[i]->velocity(phase);
+      const VectorDim acceleration =
+          (nodes[i]->external_force(phase) + nodes[i]->internal_force(phase)) /
+          mass;
+      const VectorDim du = displacement.segment(i * Tdim, Tdim);
+      const VectorDim next_acceleration =
+          (du - dt * velocity) / (beta * dt * dt) -
+          (1. / (2. * beta) - 1.) * acceleration;
+      const VectorDim change =
+          (1. - gamma) * acceleration + gamma * next_acceleration;
+      nodes[i]->update_acceleration(false, phase, change);
+      // Velocity constraints also remove the acceleration
+      nodes[i]->update_momentum(false, phase, mass * du / dt);
+      nodes[i]->compute_velocity();
+    });
+  };
+  stages["implicit"] = {"implicit",
+                        implicit,
+                        {},
+                        {{"particles", mpm::StageAccess::Read},
+                         {"nodes", mpm::StageAccess::Write},
+                         {"cells", mpm::StageAccess::Read}}};
+  return stages;
+}
@@ -8,6 +8,7 @@
 
 #include "logger.h"
 #include "node_base.h"
+#include "step_errors.h"
 
 namespace mpm {
 
@@ -21,7 +22,7 @@ using Index = unsigned long long;
 //! \tparam Tdof Degrees of Freedom
 //! \tparam Tnphases Number of phases
 template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
-class Node : public NodeBase<Tdim> {
+class Node final : public NodeBase<Tdim> {
  public:
   //! Define a vector of size dimension
   using VectorDim = Eigen::Matrix<double, Tdim, 1>;
@@ -90,12 +91,13 @@ class Node : public NodeBase<Tdim> {
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] force External force from the particles in a cell
   //! \retval status Update status
-  bool update_external_force(bool update, unsigned phase,
-                             const Eigen::VectorXd& force) override;
+  bool update_external_force(
+      bool update, unsigned phase,
+      const Eigen::Ref<const Eigen::VectorXd>& force) override;
 
   //! Return external force at a given node for a given phase
   //! \param[in] phase Index corresponding to the phase
-  Eigen::VectorXd external_force(unsigned phase) const override {
+  VectorDim external_force(unsigned phase) const override {
     return external_force_.col(phase);
   }
 
@@ -104,12 +106,13 @@ class Node : public NodeBase<Tdim> {
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] force Internal force from the particles in a cell
   //! \retval status Update status
-  bool update_internal_force(bool update, unsigned phase,
-                             const Eigen::VectorXd& force) override;
+  bool update_internal_force(
+      bool update, unsigned phase,
+      const Eigen::Ref<const Eigen::VectorXd>& force) override;
 
   //! Return internal force at a given node for a given phase
   //! \param[in] phase Index corresponding to the phase
-  Eigen::VectorXd internal_force(unsigned phase) const override {
+  VectorDim internal_force(unsigned phase) const override {
     return internal_force_.col(phase);
   }
 
@@ -118,12 +121,13 @@ class Node : public NodeBase<Tdim> {
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] momentum Momentum from the particles in a cell
   //! \retval status Update status
-  bool update_momentum(bool update, unsigned phase,
-                       const Eigen::VectorXd& momentum) override;
+  bool update_momentum(
+      bool update, unsigned phase,
+      const Eigen::Ref<const Eigen::VectorXd>& momentum) override;
 
   //! Return momentum at a given node for a given phase
   //! \param[in] phase Index corresponding to the phase
-  Eigen::VectorXd momentum(unsigned phase) const override {
+  VectorDim momentum(unsigned phase) const override {
     return momentum_.col(phase);
   }
 
@@ -132,7 +136,7 @@ class Node : public NodeBase<Tdim> {
 
   //! Return velocity at a given node for a given phase
   //! \param[in] phase Index corresponding to the phase
-  Eigen::VectorXd velocity(unsigned phase) const override {
+  VectorDim velocity(unsigned phase) const override {
     return velocity_.col(phase);
   }
 
@@ -141,12 +145,13 @@ class Node : public NodeBase<Tdim> {
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] acceleration Acceleration from the particles in a cell
   //! \retval status Update status
-  bool update_acceleration(bool update, unsigned phase,
-                           const Eigen::VectorXd& acceleration) override;
+  bool update_acceleration(
+      bool update, unsigned phase,
+      const Eigen::Ref<const Eigen::VectorXd>& acceleration) override;
 
   //! Return acceleration at a given node for a given phase
   //! \param[in] phase Index corresponding to the phase
-  Eigen::VectorXd acceleration(unsigned phase) const override {
+  VectorDim acceleration(unsigned phase) const override {
     return acceleration_.col(phase);
   }
 
@@ -164,6 +169,19 @@ class Node : public NodeBase<Tdim> {
   //! Apply velocity constraints
   void apply_velocity_constraints() override;
 
+  //! Return velocity constraints by direction, between 0 and Dim * Nphases
+  std::map<unsigned, double> velocity_constraints() const override {
+    return velocity_constraints_;
+  }
+
+  //! Return the memory footprint of the node in bytes
+  std::size_t footprint() const override;
+
+  //! Return the span of a field in the storage of the node
+  //! \param[in] field Name of the field
+  //! \param[in] phase Index corresponding to the phase
+  FieldSpan field(const std::string& field, unsigned phase) override;
+
  private:
   //! Mutex
   std::mutex node_mutex_;
@@ -192,7 +210,7 @@ class Node : public NodeBase<Tdim> {
   //! Velocity constraints
   std::map<unsigned, double> velocity_constraints_;
   //! Logger
-  std::unique_ptr<spdlog::logger> console_;
+  std::shared_ptr<spdlog::logger> console_;
 };  // Node class
 }  // namespace mpm
 
@@ -10,9 +10,8 @@ mpm::Node<Tdim, Tdof, Tnphases>::Node(
   dof_ = Tdof;
 
   //! Logger
-  std::string logger =
-      "node" + std::to_string(Tdim) + "d::" + std::to_string(id);
-  console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
+  console_ =
+      mpm::Logger::entity_logger("node" + std::to_string(Tdim) + "d", id);
 
   // Clear any velocity constraints
   velocity_constraints_.clear();
@@ -61,155 +60,131 @@ void mpm::Node<Tdim, Tdof, Tnphases>::update_volume(bool update, unsigned phase,
 //! Update external force (body force / traction force)
 template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
 bool mpm::Node<Tdim, Tdof, Tnphases>::update_external_force(
-    bool update, unsigned phase, const Eigen::VectorXd& force) {
-  bool status = false;
-  try {
-    if (force.size() != external_force_.size())
-      throw std::runtime_error("Nodal force degrees of freedom don't match");
+    bool update, unsigned phase,
+    const Eigen::Ref<const Eigen::VectorXd>& force) {
+  // Check if the degrees of freedom match
+  if (force.size() != external_force_.size()) {
+    mpm::StepErrors::current().record(mpm::StepError::DegreesOfFreedom);
+    return false;
+  }
 
-    // Decide to update or assign
-    double factor = 1.0;
-    if (!update) factor = 0.;
+  // Decide to update or assign
+  const double factor = update ? 1. : 0.;
 
-    // Update/assign external force
-    std::lock_guard<std::mutex> guard(node_mutex_);
-    external_force_.col(phase) = external_force_.col(phase) * factor + force;
-    status = true;
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
-  }
-  return status;
+  // Update/assign external force
+  std::lock_guard<std::mutex> guard(node_mutex_);
+  external_force_.col(phase) = external_force_.col(phase) * factor + force;
+  return true;
 }
 
 //! Update internal force (body force / traction force)
 template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
 bool mpm::Node<Tdim, Tdof, Tnphases>::update_internal_force(
-    bool update, unsigned phase, const Eigen::VectorXd& force) {
-  bool status = false;
-  try {
-    if (force.size() != internal_force_.size())
-      throw std::runtime_error("Nodal force degrees of freedom don't match");
+    bool update, unsigned phase,
+    const Eigen::Ref<const Eigen::VectorXd>& force) {
+  // Check if the degrees of freedom match
+  if (force.size() != internal_force_.size()) {
+    mpm::StepErrors::current().record(mpm::StepError::DegreesOfFreedom);
+    return false;
+  }
 
-    // Decide to update or assign
-    double factor = 1.0;
-    if (!update) factor = 0.;
+  // Decide to update or assign
+  const double factor = update ? 1. : 0.;
 
-    // Update/assign internal force
-    std::lock_guard<std::mutex> guard(node_mutex_);
-    internal_force_.col(phase) = internal_force_.col(phase) * factor + force;
-    status = true;
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
-  }
-  return status;
+  // Update/assign internal force
+  std::lock_guard<std::mutex> guard(node_mutex_);
+  internal_force_.col(phase) = internal_force_.col(phase) * factor + force;
+  return true;
 }
 
 //! Assign nodal momentum
 template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
 bool mpm::Node<Tdim, Tdof, Tnphases>::update_momentum(
-    bool update, unsigned phase, const Eigen::VectorXd& momentum) {
-  bool status = false;
-  try {
-    if (momentum.size() != momentum_.size()) {
-      throw std::runtime_error("Nodal momentum degrees of freedom don't match");
-    }
+    bool update, unsigned phase,
+    const Eigen::Ref<const Eigen::VectorXd>& momentum) {
+  // Check if the degrees of freedom match
+  if (momentum.size() != momentum_.size()) {
+    mpm::StepErrors::current().record(mpm::StepError::DegreesOfFreedom);
+    return false;
+  }
 
-    // Decide to update or assign
-    double factor = 1.0;
-    if (!update) factor = 0.;
+  // Decide to update or assign
+  const double factor = update ? 1. : 0.;
 
-    // Update/assign momentum
-    std::lock_guard<std::mutex> guard(node_mutex_);
-    momentum_.col(phase) = momentum_.col(phase) * factor + momentum;
-    status = true;
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
-  }
-  return status;
+  // Update/assign momentum
+  std::lock_guard<std::mutex> guard(node_mutex_);
+  momentum_.col(phase) = momentum_.col(phase) * factor + momentum;
+  return true;
 }
 
 //! Compute velocity from momentum
 //! velocity = momentum / mass
 template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
 void mpm::Node<Tdim, Tdof, Tnphases>::compute_velocity() {
-  try {
-    const double tolerance = 1.E-16;  // std::numeric_limits<double>::lowest();
-
-    for (unsigned phase = 0; phase < Tnphases; ++phase) {
-      if (mass_(phase) > tolerance) {
-        velocity_.col(phase) = momentum_.col(phase) / mass_(phase);
-
-        // Check to see if value is below threshold
-        for (unsigned i = 0; i < velocity_.rows(); ++i)
-          if (std::fabs(velocity_.col(phase)(i)) < 1.E-15)
-            velocity_.col(phase)(i) = 0.;
-      } else
-        throw std::runtime_error("Nodal mass is zero or below threshold");
-    }
+  const double tolerance = 1.E-16;  // std::numeric_limits<double>::lowest();
 
-    // Apply velocity constraints, which also sets acceleration to 0,
-    // when velocity is set.
-    this->apply_velocity_constraints();
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+  for (unsigned phase = 0; phase < Tnphases; ++phase) {
+    if (mass_(phase) > tolerance) {
+      velocity_.col(phase) = momentum_.col(phase) / mass_(phase);
+
+      // Check to see if value is below threshold
+      for (unsigned i = 0; i < velocity_.rows(); ++i)
+        if (std::fabs(velocity_.col(phase)(i)) < 1.E-15)
+          velocity_.col(phase)(i) = 0.;
+    } else {
+      // Nodal mass is zero or below threshold
+      mpm::StepErrors::current().record(mpm::StepError::NodalMass);
+      return;
+    }
   }
+
+  // Apply velocity constraints, which also sets acceleration to 0,
+  // when velocity is set.
+  this->apply_velocity_constraints();
 }
 
 //! Update nodal acceleration
 template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
 bool mpm::Node<Tdim, Tdof, Tnphases>::update_acceleration(
-    bool update, unsigned phase, const Eigen::VectorXd& acceleration) {
-  bool status = false;
-  try {
-    if (acceleration.size() != acceleration_.size()) {
-      throw std::runtime_error(
-          "Nodal acceleration degrees of freedom don't match");
-    }
+    bool update, unsigned phase,
+    const Eigen::Ref<const Eigen::VectorXd>& acceleration) {
+  // Check if the degrees of freedom match
+  if (acceleration.size() != acceleration_.size()) {
+    mpm::StepErrors::current().record(mpm::StepError::DegreesOfFreedom);
+    return false;
+  }
 
-    // Decide to update or assign
-    double factor = 1.0;
-    if (!update) factor = 0.;
+  // Decide to update or assign
+  const double factor = update ? 1. : 0.;
 
-    //! Update/assign acceleration
-    std::lock_guard<std::mutex> guard(node_mutex_);
-    acceleration_.col(phase) = acceleration_.col(phase) * factor + acceleration;
-    status = true;
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
-  }
-  return status;
+  //! Update/assign acceleration
+  std::lock_guard<std::mutex> guard(node_mutex_);
+  acceleration_.col(phase) = acceleration_.col(phase) * factor + acceleration;
+  return true;
 }
 
 //! Compute acceleration and velocity
 template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
 bool mpm::Node<Tdim, Tdof, Tnphases>::compute_acceleration_velocity(
     unsigned phase, double dt) {
-  bool status = true;
   const double tolerance = 1.E-8;
-  try {
-    if (mass_(phase) > tolerance) {
-      // acceleration (unbalaced force / mass)
-      this->acceleration_.col(phase) = (this->external_force_.col(phase) +
-                                        this->internal_force_.col(phase)) /
-                                       this->mass_(phase);
-
-      // Velocity += acceleration * dt
-      this->velocity_.col(phase) += this->acceleration_.col(phase) * dt;
-      // Apply velocity constraints, which also sets acceleration to 0,
-      // when velocity is set.
-      this->apply_velocity_constraints();
-    } else
-      throw std::runtime_error("Nodal mass is zero or below threshold");
-
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
+  if (!(mass_(phase) > tolerance)) {
+    // Nodal mass is zero or below threshold
+    mpm::StepErrors::current().record(mpm::StepError::NodalMass);
+    return false;
   }
-  return status;
+
+  // acceleration (unbalaced force / mass)
+  this->acceleration_.col(phase) =
+      (this->external_force_.col(phase) + this->internal_force_.col(phase)) /
+      this->mass_(phase);
+
+  // Velocity += acceleration * dt
+  this->velocity_.col(phase) += this->acceleration_.col(phase) * dt;
+  // Apply velocity constraints, which also sets acceleration to 0,
+  // when velocity is set.
+  this->apply_velocity_constraints();
+  return true;
 }
 
 //! Assign velocity constraint
@@ -248,3 +223,34 @@ void mpm::Node<Tdim, Tdof, Tnphases>::apply_velocity_constraints() {
     this->acceleration_(direction, phase) = 0.;
   }
 }
+
+//! Return the memory footprint of the node in bytes
+template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
+std::size_t mpm::Node<Tdim, Tdof, Tnphases>::footprint() const {
+  // A tree node of a constraint holds its colour and three links
+  const std::size_t constraints =
+      velocity_constraints_.size() *
+      (sizeof(std::pair<const unsigned, double>) + 4 * sizeof(void*));
+  return sizeof(*this) + constraints + mpm::Logger::footprint(console_);
+}
+
+//! Return the span of a field in the storage of the node
+template <unsigned Tdim, unsigned Tdof, unsigned Tnphases>
+mpm::FieldSpan mpm::Node<Tdim, Tdof, Tnphases>::field(const std::string& field,
+                                                      unsigned phase) {
+  if (phase >= Tnphases) return {};
+  // Fields of a phase are columns of column-major matrices. Coordinates are
+  // cached by the cells, momentum is only read to compute the velocity and
+  // acceleration is recomputed from the forces, so these are read-only.
+  if (field == "coordinates") return {coordinates_.data(), Tdim, true};
+  if (field == "mass") return {mass_.col(phase).data(), 1};
+  if (field == "velocity") return {velocity_.col(phase).data(), Tdim};
+  if (field == "momentum") return {momentum_.col(phase).data(), Tdim, true};
+  if (field == "acceleration")
+    return {acceleration_.col(phase).data(), Tdim, true};
+  if (field == "external_force")
+    return {external_force_.col(phase).data(), Tdim};
+  if (field == "internal_force")
+    return {internal_force_.col(phase).data(), Tdim};
+  return {};
+}
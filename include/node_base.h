@@ -4,10 +4,13 @@
 #include <array>
 #include <limits>
 #include <map>
+#include <string>
 #include <vector>
 
 #include <Eigen/Dense>
 
+#include "field_view.h"
+
 namespace mpm {
 
 //! Global index type for the node_base
@@ -82,55 +85,59 @@ class NodeBase {
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] force External force from the particles in a cell
   //! \retval status Update status
-  virtual bool update_external_force(bool update, unsigned phase,
-                                     const Eigen::VectorXd& force) = 0;
+  virtual bool update_external_force(
+      bool update, unsigned phase,
+      const Eigen::Ref<const Eigen::VectorXd>& force) = 0;
 
   //! Return external force
   //! \param[in] phase Index corresponding to the phase
-  virtual Eigen::VectorXd external_force(unsigned phase) const = 0;
+  virtual VectorDim external_force(unsigned phase) const = 0;
 
   //! Update internal force (body force / traction force)
   //! \param[in] update A boolean to update (true) or assign (false)
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] force Internal force from the particles in a cell
   //! \retval status Update status
-  virtual bool update_internal_force(bool update, unsigned phase,
-                                     const Eigen::VectorXd& force) = 0;
+  virtual bool update_internal_force(
+      bool update, unsigned phase,
+      const Eigen::Ref<const Eigen::VectorXd>& force) = 0;
 
   //! Return internal force
   //! \param[in] phase Index corresponding to the phase
-  virtual Eigen::VectorXd internal_force(unsigned phase) const = 0;
+  virtual VectorDim internal_force(unsigned phase) const = 0;
 
   //! Update nodal momentum
   //! \param[in] update A boolean to update (true) or assign (false)
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] momentum Momentum from the particles in a cell
   //! \retval status Update status
-  virtual bool update_momentum(bool update, unsigned phase,
-                               const Eigen::VectorXd& momentum) = 0;
+  virtual bool update_momentum(
+      bool update, unsigned phase,
+      const Eigen::Ref<const Eigen::VectorXd>& momentum) = 0;
 
   //! Return momentum
   //! \param[in] phase Index corresponding to the phase
-  virtual Eigen::VectorXd momentum(unsigned phase) const = 0;
+  virtual VectorDim momentum(unsigned phase) const = 0;
 
   //! Compute velocity from the momentum
   virtual void compute_velocity() = 0;
 
   //! Return velocity
   //! \param[in] phase Index corresponding to the phase
-  virtual Eigen::VectorXd velocity(unsigned phase) const = 0;
+  virtual VectorDim velocity(unsigned phase) const = 0;
 
   //! Update nodal acceleration
   //! \param[in] update A boolean to update (true) or assign (false)
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] acceleration Acceleration from the particles in a cell
   //! \retval status Update status
-  virtual bool update_acceleration(bool update, unsigned phase,
-                                   const Eigen::VectorXd& acceleration) = 0;
+  virtual bool update_acceleration(
+      bool update, unsigned phase,
+      const Eigen::Ref<const Eigen::VectorXd>& acceleration) = 0;
 
   //! Return acceleration
   //! \param[in] phase Index corresponding to the phase
-  virtual Eigen::VectorXd acceleration(unsigned phase) const = 0;
+  virtual VectorDim acceleration(unsigned phase) const = 0;
 
   //! Compute acceleration
   virtual bool compute_acceleration_velocity(unsigned phase, double dt) = 0;
@@ -144,6 +151,20 @@ class NodeBase {
   //! Apply velocity constraints
   virtual void apply_velocity_constraints() = 0;
 
+  //! Return velocity constraints by direction, between 0 and Dim * Nphases
+  virtual std::map<unsigned, double> velocity_constraints() const = 0;
+
+  //! Return the memory footprint of the node in bytes, including the memory
+  //! it owns on the heap
+  virtual std::size_t footprint() const = 0;
+
+  //! Return the span of a field in the storage of the node, which is read
+  //! and written in place: coordinates, momentum and acceleration, which
+  //! are read-only, mass, velocity, external_force or internal_force
+  //! \param[in] field Name of the field
+  //! \param[in] phase Index corresponding to the phase
+  //! \retval span Span of the field, empty if the field is unknown
+  virtual FieldSpan field(const std::string& field, unsigned phase) = 0;
 };  // NodeBase class
 }  // namespace mpm
 
@@ -1,6 +1,7 @@
 #ifndef MPM_PARTICLE_H_
 #define MPM_PARTICLE_H_
 
+#include <algorithm>
 #include <array>
 #include <limits>
 #include <memory>
@@ -22,7 +23,7 @@ using Index = unsigned long long;
 //! \tparam Tdim Dimension
 //! \tparam Tnphases Number of phases
 template <unsigned Tdim, unsigned Tnphases>
-class Particle : public ParticleBase<Tdim> {
+class Particle final : public ParticleBase<Tdim> {
  public:
   //! Define a vector of size dimension
   using VectorDim = Eigen::Matrix<double, Tdim, 1>;
@@ -52,6 +53,15 @@ class Particle : public ParticleBase<Tdim> {
   //! \retval status Status of reading HDF5 particle
   bool initialise_particle(const HDF5Particle& particle) override;
 
+  //! Initialise particle from the state in a checkpoint
+  //! \param[in] particle Checkpoint state of particle
+  //! \retval status Status of restoring the particle
+  bool initialise_particle(const CheckpointParticle& particle) override;
+
+  //! Copy the complete state of the particle to a checkpoint
+  //! \param[out] particle Checkpoint state of particle
+  void checkpoint_particle(CheckpointParticle& particle) const override;
+
   //! Initialise properties
   void initialise() override;
 
@@ -68,6 +78,13 @@ class Particle : public ParticleBase<Tdim> {
   //! \param[in] cellptr Pointer to a cell
   bool assign_cell(const std::shared_ptr<Cell<Tdim>>& cellptr) override;
 
+  //! Assign a cell and the reference location of the particle in it,
+  //! e.g. from a checkpoint, without checking if the point is in the cell
+  //! \param[in] cellptr Pointer to a cell
+  //! \param[in] xi Reference location of the particle in the cell
+  bool assign_cell_xi(const std::shared_ptr<Cell<Tdim>>& cellptr,
+                      const VectorDim& xi) override;
+
   //! Return cell id
   Index cell_id() const override { return cell_id_; }
 
@@ -75,7 +92,19 @@ class Particle : public ParticleBase<Tdim> {
   void remove_cell() override;
 
   //! Compute shape functions of a particle, based on local coordinates
-  bool compute_shapefn() override;
+  bool compute_shapefn() override {
+    return this->template compute_shapefn<Element<Tdim>>();
+  }
+
+  //! Compute shape functions with the element as its concrete type
+  //! \tparam Telement Element type of the cell of the particle
+  template <typename Telement>
+  bool compute_shapefn();
+
+  //! Return the B-matrix of each node of the cell at the particle
+  const std::vector<Eigen::MatrixXd>& bmatrix() const override {
+    return bmatrix_;
+  }
 
   //! Assign volume
   void assign_volume(double volume) override { volume_ = volume; }
@@ -92,7 +121,15 @@ class Particle : public ParticleBase<Tdim> {
 
   //! Map particle mass and momentum to nodes
   //! \param[in] phase Index corresponding to the phase
-  bool map_mass_momentum_to_nodes(unsigned phase) override;
+  bool map_mass_momentum_to_nodes(unsigned phase) override {
+    return this->template map_mass_momentum_to_nodes<NodeBase<Tdim>>(phase);
+  }
+
+  //! Map particle mass and momentum to nodes of a concrete type
+  //! \param[in] phase Index corresponding to the phase
+  //! \tparam Tnode Node type of the cell of the particle
+  template <typename Tnode>
+  bool map_mass_momentum_to_nodes(unsigned phase);
 
   //! Assign nodal mass to particles
   //! \param[in] phase Index corresponding to the phase
@@ -114,7 +151,16 @@ class Particle : public ParticleBase<Tdim> {
   //! Compute strain
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] dt Analysis time step
-  void compute_strain(unsigned phase, double dt) override;
+  void compute_strain(unsigned phase, double dt) override {
+    this->template compute_strain<NodeBase<Tdim>>(phase, dt);
+  }
+
+  //! Compute strain from nodes of a concrete type
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] dt Analysis time step
+  //! \tparam Tnode Node type of the cell of the particle
+  template <typename Tnode>
+  void compute_strain(unsigned phase, double dt);
 
   //! Return strain of the particle
   //! \param[in] phase Index corresponding to the phase
@@ -136,7 +182,15 @@ class Particle : public ParticleBase<Tdim> {
   }
 
   //! Compute stress
-  bool compute_stress(unsigned phase) override;
+  bool compute_stress(unsigned phase) override {
+    return this->template compute_stress<Material<Tdim>>(phase);
+  }
+
+  //! Compute stress with the material as its concrete type
+  //! \param[in] phase Index corresponding to the phase
+  //! \tparam Tmaterial Material type of the particle
+  template <typename Tmaterial>
+  bool compute_stress(unsigned phase);
 
   //! Return stress of the particle
   //! \param[in] phase Index corresponding to the phase
@@ -147,11 +201,28 @@ class Particle : public ParticleBase<Tdim> {
   //! Map body force
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] pgravity Gravity of a particle
-  void map_body_force(unsigned phase, const VectorDim& pgravity) override;
+  void map_body_force(unsigned phase, const VectorDim& pgravity) override {
+    this->template map_body_force<NodeBase<Tdim>>(phase, pgravity);
+  }
+
+  //! Map body force to nodes of a concrete type
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] pgravity Gravity of a particle
+  //! \tparam Tnode Node type of the cell of the particle
+  template <typename Tnode>
+  void map_body_force(unsigned phase, const VectorDim& pgravity);
 
   //! Map internal force
   //! \param[in] phase Index corresponding to the phase
-  bool map_internal_force(unsigned phase) override;
+  bool map_internal_force(unsigned phase) override {
+    return this->template map_internal_force<NodeBase<Tdim>>(phase);
+  }
+
+  //! Map internal force to nodes of a concrete type
+  //! \param[in] phase Index corresponding to the phase
+  //! \tparam Tnode Node type of the cell of the particle
+  template <typename Tnode>
+  bool map_internal_force(unsigned phase);
 
   //! Assign velocity to the particle
   //! \param[in] phase Index corresponding to the phase
@@ -169,13 +240,48 @@ class Particle : public ParticleBase<Tdim> {
   //! Compute updated position of the particle
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] dt Analysis time step
-  bool compute_updated_position(unsigned phase, double dt) override;
+  bool compute_updated_position(unsigned phase, double dt) override {
+    return this->template compute_updated_position<NodeBase<Tdim>>(phase, dt);
+  }
+
+  //! Compute updated position of the particle from nodes of a concrete type
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] dt Analysis time step
+  //! \tparam Tnode Node type of the cell of the particle
+  template <typename Tnode>
+  bool compute_updated_position(unsigned phase, double dt);
 
   //! Compute updated position of the particle based on nodal velocity
   //! \param[in] phase Index corresponding to the phase
   //! \param[in] dt Analysis time step
   bool compute_updated_position_velocity(unsigned phase, double dt) override;
 
+  //! Return the critical time step of the particle, in which a wave
+  //! travelling at the wave speed of the material, convected by the particle
+  //! or the nodes of its cell, crosses the cell
+  //! \param[in] phase Index corresponding to the phase
+  double critical_time_step(unsigned phase) const override;
+
+  //! Scale the inertial mass of the particle, which it maps to nodes, so
+  //! that its critical time step isn't below a target time step, which
+  //! doesn't change its mass under gravity
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] dt Target critical time step
+  //! \param[in] max_scale Maximum scale of the mass
+  //! \retval scale Scale of the mass, which is one if unscaled
+  double scale_mass(unsigned phase, double dt, double max_scale) override;
+
+  //! Return the scale of the inertial mass of the particle
+  double mass_scale() const override { return mass_scale_; }
+
+  //! Return the memory footprint of the particle in bytes
+  std::size_t footprint() const override;
+
+  //! Return the span of a field in the storage of the particle
+  //! \param[in] field Name of the field
+  //! \param[in] phase Index corresponding to the phase
+  FieldSpan field(const std::string& field, unsigned phase) override;
+
  private:
   //! particle id
   using ParticleBase<Tdim>::id_;
@@ -195,6 +301,8 @@ class Particle : public ParticleBase<Tdim> {
   using ParticleBase<Tdim>::material_;
   //! Mass
   Eigen::Matrix<double, 1, Tnphases> mass_;
+  //! Scale of the inertial mass
+  double mass_scale_{1.};
   //! Stresses
   Eigen::Matrix<double, 6, Tnphases> stress_;
   //! Strains
@@ -212,7 +320,7 @@ class Particle : public ParticleBase<Tdim> {
   //! B-Matrix
   std::vector<Eigen::MatrixXd> bmatrix_;
   //! Logger
-  std::unique_ptr<spdlog::logger> console_;
+  std::shared_ptr<spdlog::logger> console_;
 };  // Particle class
 }  // namespace mpm
 
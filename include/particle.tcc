@@ -6,9 +6,8 @@ mpm::Particle<Tdim, Tnphases>::Particle(Index id, const VectorDim& coord)
   cell_ = nullptr;
   material_ = nullptr;
   //! Logger
-  std::string logger =
-      "particle" + std::to_string(Tdim) + "d::" + std::to_string(id);
-  console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
+  console_ =
+      mpm::Logger::entity_logger("particle" + std::to_string(Tdim) + "d", id);
 }
 
 //! Construct a particle with id, coordinates and status
@@ -20,9 +19,8 @@ mpm::Particle<Tdim, Tnphases>::Particle(Index id, const VectorDim& coord,
   cell_ = nullptr;
   material_ = nullptr;
   //! Logger
-  std::string logger =
-      "particle" + std::to_string(Tdim) + "d::" + std::to_string(id);
-  console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
+  console_ =
+      mpm::Logger::entity_logger("particle" + std::to_string(Tdim) + "d", id);
 }
 
 //! Initialise particle data from HDF5
@@ -68,6 +66,76 @@ bool mpm::Particle<Tdim, Tnphases>::initialise_particle(
   return true;
 }
 
+//! Initialise particle from the state in a checkpoint
+template <unsigned Tdim, unsigned Tnphases>
+bool mpm::Particle<Tdim, Tnphases>::initialise_particle(
+    const CheckpointParticle& particle) {
+  // Checkpoints store the state of the first phase
+  const unsigned phase = 0;
+
+  // Assign id
+  this->id_ = particle.id;
+  // Mass and volume
+  this->mass_(phase) = particle.mass;
+  this->volume_ = particle.volume;
+
+  // Coordinates, reference location and velocity
+  for (unsigned i = 0; i < Tdim; ++i) {
+    this->coordinates_(i) = particle.coordinates[i];
+    this->xi_(i) = particle.xi[i];
+    this->velocity_(i, phase) = particle.velocity[i];
+  }
+
+  // Stress, strain, strain rate and strain increment
+  for (unsigned i = 0; i < 6; ++i) {
+    this->stress_(i, phase) = particle.stress[i];
+    this->strain_(i, phase) = particle.strain[i];
+    this->strain_rate_(i, phase) = particle.strain_rate[i];
+    this->dstrain_(i, phase) = particle.dstrain[i];
+  }
+
+  // Volumetric strain
+  this->volumetric_strain_centroid_(phase) = particle.volumetric_strain;
+
+  // Status
+  this->status_ = (particle.status != 0);
+  return true;
+}
+
+//! Copy the complete state of the particle to a checkpoint
+template <unsigned Tdim, unsigned Tnphases>
+void mpm::Particle<Tdim, Tnphases>::checkpoint_particle(
+    CheckpointParticle& particle) const {
+  // Checkpoints store the state of the first phase
+  const unsigned phase = 0;
+
+  particle.id = this->id_;
+  particle.cell_id = (cell_ != nullptr) ? cell_id_ : CheckpointUndefinedCell;
+  particle.material_id = (material_ != nullptr) ? material_->id()
+                                                : CheckpointUndefinedMaterial;
+  particle.status = this->status_;
+  particle.mass = this->mass_(phase);
+  particle.volume = this->volume_;
+
+  // Coordinates, reference location and velocity padded to 3D
+  for (unsigned i = 0; i < 3; ++i) {
+    particle.coordinates[i] = (i < Tdim) ? this->coordinates_(i) : 0.;
+    particle.xi[i] = (i < Tdim) ? this->xi_(i) : 0.;
+    particle.velocity[i] = (i < Tdim) ? this->velocity_(i, phase) : 0.;
+  }
+
+  // Stress, strain, strain rate and strain increment
+  for (unsigned i = 0; i < 6; ++i) {
+    particle.stress[i] = this->stress_(i, phase);
+    particle.strain[i] = this->strain_(i, phase);
+    particle.strain_rate[i] = this->strain_rate_(i, phase);
+    particle.dstrain[i] = this->dstrain_(i, phase);
+  }
+
+  // Volumetric strain
+  particle.volumetric_strain = this->volumetric_strain_centroid_(phase);
+}
+
 // Initialise particle properties
 template <unsigned Tdim, unsigned Tnphases>
 void mpm::Particle<Tdim, Tnphases>::initialise() {
@@ -106,6 +174,27 @@ bool mpm::Particle<Tdim, Tnphases>::assign_cell(
   return status;
 }
 
+// Assign a cell and reference location to particle
+template <unsigned Tdim, unsigned Tnphases>
+bool mpm::Particle<Tdim, Tnphases>::assign_cell_xi(
+    const std::shared_ptr<Cell<Tdim>>& cellptr, const VectorDim& xi) {
+  bool status = true;
+  try {
+    if (cellptr == nullptr) throw std::runtime_error("Cell is undefined!");
+    // if a cell already exists remove particle from that cell
+    if (cell_ != nullptr) cell_->remove_particle_id(this->id_);
+
+    cell_ = cellptr;
+    cell_id_ = cellptr->id();
+    xi_ = xi;
+    status = cell_->add_particle_id(this->id());
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    status = false;
+  }
+  return status;
+}
+
 // Remove cell for the particle
 template <unsigned Tdim, unsigned Tnphases>
 void mpm::Particle<Tdim, Tnphases>::remove_cell() {
@@ -136,125 +225,102 @@ bool mpm::Particle<Tdim, Tnphases>::assign_material(
 // Compute reference location cell to particle
 template <unsigned Tdim, unsigned Tnphases>
 bool mpm::Particle<Tdim, Tnphases>::compute_reference_location() {
-  bool status = true;
-  try {
-    // Check if particle has a valid cell ptr
-    if (cell_ != nullptr) {
-      //#ifdef _MPM_ISOPARAMETRIC_
-      // Get reference location of a particle with isoparametric transformation
-      this->xi_ = cell_->transform_real_to_unit_cell(this->coordinates_);
-      //#else
-      // Get reference location of a particle on cartesian grid
-      // this->xi_ = cell_->local_coordinates_point(this->coordinates_);
-      //#endif
-    } else {
-      throw std::runtime_error(
-          "Cell is not initialised! "
-          "cannot compute local reference coordinates of the particle");
-    }
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
+  // Check if particle has a valid cell ptr
+  if (cell_ == nullptr) {
+    mpm::StepErrors::current().record(mpm::StepError::ParticleCell);
+    return false;
   }
-  return status;
+
+  //#ifdef _MPM_ISOPARAMETRIC_
+  // Get reference location of a particle with isoparametric transformation
+  this->xi_ = cell_->transform_real_to_unit_cell(this->coordinates_);
+  //#else
+  // Get reference location of a particle on cartesian grid
+  // this->xi_ = cell_->local_coordinates_point(this->coordinates_);
+  //#endif
+  return true;
 }
 
 // Compute shape functions and gradients
 template <unsigned Tdim, unsigned Tnphases>
+template <typename Telement>
 bool mpm::Particle<Tdim, Tnphases>::compute_shapefn() {
-  bool status = true;
-  try {
-    // Check if particle has a valid cell ptr
-    if (cell_ != nullptr) {
-      // Compute local coordinates
-      this->compute_reference_location();
+  // Check if particle has a valid cell ptr
+  if (cell_ == nullptr) {
+    mpm::StepErrors::current().record(mpm::StepError::ParticleCell);
+    return false;
+  }
 
-      // Get element ptr of a cell
-      const auto element = cell_->element_ptr();
+  // Compute local coordinates
+  this->compute_reference_location();
 
-      // Compute shape function of the particle
-      shapefn_ = element->shapefn(this->xi_);
-      // Compute bmatrix of the particle for reference cell
-      bmatrix_ = element->bmatrix(this->xi_, cell_->nodal_coordinates());
-    } else {
-      throw std::runtime_error(
-          "Cell is not initialised! "
-          "cannot compute shapefns for the particle");
-    }
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
-  }
-  return status;
+  // Get element of the cell as its concrete type
+  const auto element = static_cast<const Telement*>(cell_->element_ptr().get());
+
+  // Compute shape function of the particle, buffers are only allocated
+  // on the first call
+  shapefn_.resize(element->nfunctions());
+  element->evaluate_shapefn(this->xi_, shapefn_);
+  // Compute bmatrix of the particle for reference cell
+  element->evaluate_bmatrix(this->xi_, cell_->nodal_coordinates(), bmatrix_);
+  return true;
 }
 
 // Compute volume of particle
 template <unsigned Tdim, unsigned Tnphases>
 bool mpm::Particle<Tdim, Tnphases>::compute_volume() {
-  bool status = true;
-  try {
-    // Check if particle has a valid cell ptr
-    if (cell_ != nullptr) {
-      // Volume of the cell / # of particles
-      this->volume_ = cell_->volume() / cell_->nparticles();
-    } else {
-      throw std::runtime_error(
-          "Cell is not initialised! "
-          "cannot compute volume for the particle");
-    }
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
+  // Check if particle has a valid cell ptr
+  if (cell_ == nullptr) {
+    mpm::StepErrors::current().record(mpm::StepError::ParticleCell);
+    return false;
   }
-  return status;
+
+  // Volume of the cell / # of particles
+  this->volume_ = cell_->volume() / cell_->nparticles();
+  return true;
 }
 
 // Compute mass of particle
 template <unsigned Tdim, unsigned Tnphases>
 bool mpm::Particle<Tdim, Tnphases>::compute_mass(unsigned phase) {
-  bool status = true;
-  try {
-    // Check if particle volume is set and material ptr is valid
-    if (volume_ != std::numeric_limits<double>::max() && material_ != nullptr) {
-      // Mass = volume of particle * density
-      this->mass_(phase) = volume_ * material_->property("density");
-    } else {
-      throw std::runtime_error(
-          "Cell is not initialised! or material is invalid"
-          "cannot compute mass for the particle");
-    }
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
+  // Check if particle volume is set and material ptr is valid
+  if (volume_ == std::numeric_limits<double>::max()) {
+    mpm::StepErrors::current().record(mpm::StepError::ParticleMass);
+    return false;
   }
-  return status;
+  if (material_ == nullptr) {
+    mpm::StepErrors::current().record(mpm::StepError::ParticleMaterial);
+    return false;
+  }
+
+  // Mass = volume of particle * density
+  this->mass_(phase) = volume_ * material_->property("density");
+  return true;
 }
 
 //! Map particle mass and momentum to nodes
 template <unsigned Tdim, unsigned Tnphases>
+template <typename Tnode>
 bool mpm::Particle<Tdim, Tnphases>::map_mass_momentum_to_nodes(unsigned phase) {
-  bool status = true;
-  try {
-    // Check if particle mass is set
-    if (mass_(phase) != std::numeric_limits<double>::max()) {
-      // Map particle mass and momentum to nodes
-      this->cell_->map_mass_momentum_to_nodes(
-          this->shapefn_, phase, mass_(phase), velocity_.col(phase));
-    } else {
-      throw std::runtime_error("Particle mass has not be computed");
-    }
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
+  // Check if particle mass is set
+  if (mass_(phase) == std::numeric_limits<double>::max()) {
+    mpm::StepErrors::current().record(mpm::StepError::ParticleMass);
+    return false;
   }
-  return status;
+
+  // Map particle mass and momentum to nodes, with the scaled inertial mass
+  this->cell_->template map_mass_momentum_to_nodes<Tnode>(
+      this->shapefn_, phase, mass_scale_ * mass_(phase), velocity_.col(phase));
+  return true;
 }
 
 // Compute strain of the particle
 template <unsigned Tdim, unsigned Tnphases>
+template <typename Tnode>
 void mpm::Particle<Tdim, Tnphases>::compute_strain(unsigned phase, double dt) {
   // Strain rate
-  Eigen::VectorXd strain_rate = cell_->compute_strain_rate(bmatrix_, phase);
+  const auto strain_rate =
+      cell_->template compute_strain_rate<Tnode>(bmatrix_, phase);
   // particle_strain_rate
   Eigen::Matrix<double, 6, 1> particle_strain_rate;
   particle_strain_rate.setZero();
@@ -271,7 +337,8 @@ void mpm::Particle<Tdim, Tnphases>::compute_strain(unsigned phase, double dt) {
       break;
     }
     default: {
-      particle_strain_rate = strain_rate;
+      for (unsigned i = 0; i < strain_rate.size(); ++i)
+        particle_strain_rate(i) = strain_rate(i);
       break;
     }
   }
@@ -290,8 +357,8 @@ void mpm::Particle<Tdim, Tnphases>::compute_strain(unsigned phase, double dt) {
 
   // Compute at centroid
   // Strain rate for reduced integration
-  Eigen::VectorXd strain_rate_centroid =
-      cell_->compute_strain_rate_centroid(phase);
+  auto strain_rate_centroid =
+      cell_->template compute_strain_rate_centroid<Tnode>(phase);
 
   // Check to see if value is below threshold
   for (unsigned i = 0; i < strain_rate_centroid.size(); ++i)
@@ -305,64 +372,60 @@ void mpm::Particle<Tdim, Tnphases>::compute_strain(unsigned phase, double dt) {
 
 // Compute stress
 template <unsigned Tdim, unsigned Tnphases>
+template <typename Tmaterial>
 bool mpm::Particle<Tdim, Tnphases>::compute_stress(unsigned phase) {
-  bool status = true;
-  try {
-    // Check if material ptr is valid
-    if (material_ != nullptr) {
-      Eigen::Matrix<double, 6, 1> dstrain = this->dstrain_.col(phase);
-      // Check if material needs property handle
-      if (material_->property_handle())
-        // Calculate stress
-        this->stress_.col(phase) =
-            material_->compute_stress(this->stress_.col(phase), dstrain, this);
-      else
-        // Calculate stress without sending particle handle
-        this->stress_.col(phase) =
-            material_->compute_stress(this->stress_.col(phase), dstrain);
-    } else {
-      throw std::runtime_error("Material is invalid");
-    }
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
+  // Check if material ptr is valid
+  if (material_ == nullptr) {
+    mpm::StepErrors::current().record(mpm::StepError::ParticleMaterial);
+    return false;
   }
-  return status;
+
+  // Material as its concrete type
+  const auto material = static_cast<Tmaterial*>(material_.get());
+
+  Eigen::Matrix<double, 6, 1> dstrain = this->dstrain_.col(phase);
+  // Check if material needs property handle
+  if (material->property_handle())
+    // Calculate stress
+    this->stress_.col(phase) =
+        material->compute_stress(this->stress_.col(phase), dstrain, this);
+  else
+    // Calculate stress without sending particle handle
+    this->stress_.col(phase) =
+        material->compute_stress(this->stress_.col(phase), dstrain);
+  return true;
 }
 
 //! Map body force
 //! \param[in] phase Index corresponding to the phase
 //! \param[in] pgravity Gravity of a particle
 template <unsigned Tdim, unsigned Tnphases>
+template <typename Tnode>
 void mpm::Particle<Tdim, Tnphases>::map_body_force(unsigned phase,
                                                    const VectorDim& pgravity) {
   // Compute nodal body forces
-  cell_->compute_nodal_body_force(this->shapefn_, phase, this->mass_(phase),
-                                  pgravity);
+  cell_->template compute_nodal_body_force<Tnode>(
+      this->shapefn_, phase, this->mass_(phase), pgravity);
 }
 
 //! Map internal force
 //! \param[in] phase Index corresponding to the phase
 template <unsigned Tdim, unsigned Tnphases>
+template <typename Tnode>
 bool mpm::Particle<Tdim, Tnphases>::map_internal_force(unsigned phase) {
-  bool status = true;
-  try {
-    // Check if  material ptr is valid
-    if (material_ != nullptr) {
-      // Compute nodal internal forces
-      // -pstress * volume
-      cell_->compute_nodal_internal_force(
-          this->bmatrix_, phase,
-          (this->mass_(phase) / material_->property("density")),
-          -1. * this->stress_.col(phase));
-    } else {
-      throw std::runtime_error("Material is invalid");
-    }
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
+  // Check if  material ptr is valid
+  if (material_ == nullptr) {
+    mpm::StepErrors::current().record(mpm::StepError::ParticleMaterial);
+    return false;
   }
-  return status;
+
+  // Compute nodal internal forces
+  // -pstress * volume
+  cell_->template compute_nodal_internal_force<Tnode>(
+      this->bmatrix_, phase,
+      (this->mass_(phase) / material_->property("density")),
+      -1. * this->stress_.col(phase));
+  return true;
 }
 
 // Assign velocity to the particle
@@ -387,58 +450,108 @@ bool mpm::Particle<Tdim, Tnphases>::assign_velocity(
 
 // Compute updated position of the particle
 template <unsigned Tdim, unsigned Tnphases>
+template <typename Tnode>
 bool mpm::Particle<Tdim, Tnphases>::compute_updated_position(unsigned phase,
                                                              double dt) {
-  bool status = true;
-  try {
-    // Check if particle has a valid cell ptr
-    if (cell_ != nullptr) {
-      // Get interpolated nodal acceleration
-      Eigen::Matrix<double, Tdim, 1> acceleration =
-          cell_->interpolate_nodal_acceleration(this->shapefn_, phase);
+  // Check if particle has a valid cell ptr
+  if (cell_ == nullptr) {
+    mpm::StepErrors::current().record(mpm::StepError::ParticleCell);
+    return false;
+  }
 
-      // Update particle velocity from interpolated nodal acceleration
-      this->velocity_.col(phase) += acceleration * dt;
+  // Get interpolated nodal acceleration
+  const Eigen::Matrix<double, Tdim, 1> acceleration =
+      cell_->template interpolate_nodal_acceleration<Tnode>(this->shapefn_,
+                                                            phase);
 
-      // New position  current position + velocity * dt
-      this->coordinates_ += this->velocity_.col(phase) * dt;
-    } else {
-      throw std::runtime_error(
-          "Cell is not initialised! "
-          "cannot compute updated coordinates of the particle");
-    }
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
-  }
-  return status;
+  // Update particle velocity from interpolated nodal acceleration
+  this->velocity_.col(phase) += acceleration * dt;
+
+  // New position  current position + velocity * dt
+  this->coordinates_ += this->velocity_.col(phase) * dt;
+  return true;
 }
 
 // Compute updated position of the particle based on nodal velocity
 template <unsigned Tdim, unsigned Tnphases>
 bool mpm::Particle<Tdim, Tnphases>::compute_updated_position_velocity(
     unsigned phase, double dt) {
-  bool status = true;
-  try {
-    // Check if particle has a valid cell ptr
-    if (cell_ != nullptr) {
-      // Get interpolated nodal velocity
-      Eigen::Matrix<double, Tdim, 1> velocity =
-          cell_->interpolate_nodal_velocity(this->shapefn_, phase);
+  // Check if particle has a valid cell ptr
+  if (cell_ == nullptr) {
+    mpm::StepErrors::current().record(mpm::StepError::ParticleCell);
+    return false;
+  }
 
-      // Update particle velocity to interpolated nodal velocity
-      this->velocity_.col(phase) += velocity;
+  // Get interpolated nodal velocity
+  const Eigen::Matrix<double, Tdim, 1> velocity =
+      cell_->interpolate_nodal_velocity(this->shapefn_, phase);
 
-      // New position current position + velocity * dt
-      this->coordinates_ += this->velocity_.col(phase) * dt;
-    } else {
-      throw std::runtime_error(
-          "Cell is not initialised! "
-          "cannot compute updated coordinates of the particle");
-    }
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    status = false;
-  }
-  return status;
+  // Update particle velocity to interpolated nodal velocity
+  this->velocity_.col(phase) += velocity;
+
+  // New position current position + velocity * dt
+  this->coordinates_ += this->velocity_.col(phase) * dt;
+  return true;
+}
+
+//! Return the critical time step of the particle
+template <unsigned Tdim, unsigned Tnphases>
+double mpm::Particle<Tdim, Tnphases>::critical_time_step(unsigned phase) const {
+  // A particle outside the mesh or without a material doesn't limit the step
+  if (cell_ == nullptr || material_ == nullptr)
+    return std::numeric_limits<double>::max();
+
+  // Wave speed decreases with the square root of the scaled mass
+  const double speed =
+      material_->wave_speed() / std::sqrt(mass_scale_) +
+      std::max(velocity_.col(phase).norm(), cell_->max_nodal_speed(phase));
+  return cell_->mean_length() / speed;
+}
+
+//! Scale the inertial mass of the particle to a target critical time step
+template <unsigned Tdim, unsigned Tnphases>
+double mpm::Particle<Tdim, Tnphases>::scale_mass(unsigned phase, double dt,
+                                                 double max_scale) {
+  mass_scale_ = 1.;
+  if (cell_ == nullptr || material_ == nullptr) return mass_scale_;
+
+  // Wave speed at which the wave crosses the cell in the target time step
+  const double speed =
+      cell_->mean_length() / dt -
+      std::max(velocity_.col(phase).norm(), cell_->max_nodal_speed(phase));
+  const double wave_speed = material_->wave_speed();
+  if (wave_speed <= speed) return mass_scale_;
+
+  // Convection alone crosses the cell in the target time step
+  if (speed <= 0.)
+    mass_scale_ = max_scale;
+  else
+    mass_scale_ = std::min(std::pow(wave_speed / speed, 2), max_scale);
+  return mass_scale_;
+}
+
+//! Return the memory footprint of the particle in bytes
+template <unsigned Tdim, unsigned Tnphases>
+std::size_t mpm::Particle<Tdim, Tnphases>::footprint() const {
+  std::size_t bytes = sizeof(*this) + shapefn_.size() * sizeof(double) +
+                      bmatrix_.capacity() * sizeof(Eigen::MatrixXd);
+  for (const auto& bmatrix : bmatrix_)
+    bytes += bmatrix.size() * sizeof(double);
+  return bytes + mpm::Logger::footprint(console_);
+}
+
+//! Return the span of a field in the storage of the particle
+template <unsigned Tdim, unsigned Tnphases>
+mpm::FieldSpan mpm::Particle<Tdim, Tnphases>::field(const std::string& field,
+                                                    unsigned phase) {
+  if (phase >= Tnphases) return {};
+  // Fields of a phase are columns of column-major matrices. Mass is
+  // recomputed from the volume and the density at each step, and is
+  // read-only.
+  if (field == "coordinates") return {this->coordinates_.data(), Tdim};
+  if (field == "mass") return {mass_.col(phase).data(), 1, true};
+  if (field == "velocity") return {velocity_.col(phase).data(), Tdim};
+  if (field == "stress") return {stress_.col(phase).data(), 6};
+  if (field == "strain") return {strain_.col(phase).data(), 6};
+  return {};
 }
@@ -4,9 +4,12 @@
 #include <array>
 #include <limits>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "cell.h"
+#include "checkpoint.h"
+#include "field_view.h"
 #include "hdf5.h"
 #include "material/material.h"
 
@@ -54,6 +57,15 @@ class ParticleBase {
   //! \retval status Status of reading HDF5 particle
   virtual bool initialise_particle(const HDF5Particle& particle) = 0;
 
+  //! Initialise particle from the state in a checkpoint
+  //! \param[in] particle Checkpoint state of particle
+  //! \retval status Status of restoring the particle
+  virtual bool initialise_particle(const CheckpointParticle& particle) = 0;
+
+  //! Copy the complete state of the particle to a checkpoint
+  //! \param[out] particle Checkpoint state of particle
+  virtual void checkpoint_particle(CheckpointParticle& particle) const = 0;
+
   //! Return id of the particleBase
   Index id() const { return id_; }
 
@@ -74,15 +86,26 @@ class ParticleBase {
   //! Assign cell
   virtual bool assign_cell(const std::shared_ptr<Cell<Tdim>>& cellptr) = 0;
 
+  //! Assign cell and reference location without checking the location
+  virtual bool assign_cell_xi(const std::shared_ptr<Cell<Tdim>>& cellptr,
+                              const VectorDim& xi) = 0;
+
   //! Return cell id
   virtual Index cell_id() const = 0;
 
+  //! Return the cell of the particle
+  const std::shared_ptr<Cell<Tdim>>& cell() const { return cell_; }
+
   //! Remove cell
   virtual void remove_cell() = 0;
 
   //! Compute shape functions
   virtual bool compute_shapefn() = 0;
 
+  //! Return the B-matrix of each node of the cell at the particle, which is
+  //! evaluated with the shape functions
+  virtual const std::vector<Eigen::MatrixXd>& bmatrix() const = 0;
+
   //! Assign volume
   virtual void assign_volume(double volume) = 0;
 
@@ -102,6 +125,9 @@ class ParticleBase {
   virtual bool assign_material(
       const std::shared_ptr<Material<Tdim>>& material) = 0;
 
+  //! Return the material of the particle
+  const std::shared_ptr<Material<Tdim>>& material() const { return material_; }
+
   //! Assign status
   void assign_status(bool status) { status_ = status; }
 
@@ -154,6 +180,33 @@ class ParticleBase {
   //! Compute updated position based on nodal velocity
   virtual bool compute_updated_position_velocity(unsigned phase, double dt) = 0;
 
+  //! Return the critical time step of the particle
+  //! \param[in] phase Index corresponding to the phase
+  virtual double critical_time_step(unsigned phase) const = 0;
+
+  //! Scale the inertial mass of the particle, which it maps to nodes, so
+  //! that its critical time step isn't below a target time step
+  //! \param[in] phase Index corresponding to the phase
+  //! \param[in] dt Target critical time step
+  //! \param[in] max_scale Maximum scale of the mass
+  //! \retval scale Scale of the mass, which is one if unscaled
+  virtual double scale_mass(unsigned phase, double dt, double max_scale) = 0;
+
+  //! Return the scale of the inertial mass of the particle
+  virtual double mass_scale() const = 0;
+
+  //! Return the memory footprint of the particle in bytes, including the
+  //! memory it owns on the heap
+  virtual std::size_t footprint() const = 0;
+
+  //! Return the span of a field in the storage of the particle, which is
+  //! read and written in place: coordinates, mass, which is read-only,
+  //! velocity, stress or strain
+  //! \param[in] field Name of the field
+  //! \param[in] phase Index corresponding to the phase
+  //! \retval span Span of the field, empty if the field is unknown
+  virtual FieldSpan field(const std::string& field, unsigned phase) = 0;
+
  protected:
   //! particleBase id
   Index id_{std::numeric_limits<Index>::max()};
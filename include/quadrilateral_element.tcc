@@ -9,8 +9,9 @@
 //! Return shape functions of a 4-node Quadrilateral Element at a given local
 //! coordinate
 template <>
-inline Eigen::VectorXd mpm::QuadrilateralElement<2, 4>::shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi) const {
+inline Eigen::Matrix<double, 4, 1>
+    mpm::QuadrilateralElement<2, 4>::fixed_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 4, 1> shapefn;
   shapefn(0) = 0.25 * (1 - xi(0)) * (1 - xi(1));
   shapefn(1) = 0.25 * (1 + xi(0)) * (1 - xi(1));
@@ -22,8 +23,9 @@ inline Eigen::VectorXd mpm::QuadrilateralElement<2, 4>::shapefn(
 //! Return gradient of shape functions of a 4-node Quadrilateral Element at a
 //! given local coordinate
 template <>
-inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 4>::grad_shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi) const {
+inline Eigen::Matrix<double, 4, 2>
+    mpm::QuadrilateralElement<2, 4>::fixed_grad_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 4, 2> grad_shapefn;
   grad_shapefn(0, 0) = -0.25 * (1 - xi(1));
   grad_shapefn(1, 0) = 0.25 * (1 - xi(1));
@@ -67,8 +69,9 @@ inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 4>::unit_cell_coordinates()
 //! Return shape functions of a 8-node Quadrilateral Element at a given local
 //! coordinate
 template <>
-inline Eigen::VectorXd mpm::QuadrilateralElement<2, 8>::shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi) const {
+inline Eigen::Matrix<double, 8, 1>
+    mpm::QuadrilateralElement<2, 8>::fixed_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 8, 1> shapefn;
   shapefn(0) = -0.25 * (1. - xi(0)) * (1. - xi(1)) * (xi(0) + xi(1) + 1.);
   shapefn(1) = 0.25 * (1. + xi(0)) * (1. - xi(1)) * (xi(0) - xi(1) - 1.);
@@ -84,8 +87,9 @@ inline Eigen::VectorXd mpm::QuadrilateralElement<2, 8>::shapefn(
 //! Return gradient of shape functions of a 8-node Quadrilateral Element at a
 //! given local coordinate
 template <>
-inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 8>::grad_shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi) const {
+inline Eigen::Matrix<double, 8, 2>
+    mpm::QuadrilateralElement<2, 8>::fixed_grad_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 8, 2> grad_shapefn;
   grad_shapefn(0, 0) = 0.25 * (2. * xi(0) + xi(1)) * (1. - xi(1));
   grad_shapefn(1, 0) = 0.25 * (2. * xi(0) - xi(1)) * (1. - xi(1));
@@ -140,8 +144,9 @@ inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 8>::unit_cell_coordinates()
 //! Return shape functions of a 9-node Quadrilateral Element at a given local
 //! coordinate
 template <>
-inline Eigen::VectorXd mpm::QuadrilateralElement<2, 9>::shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi) const {
+inline Eigen::Matrix<double, 9, 1>
+    mpm::QuadrilateralElement<2, 9>::fixed_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 9, 1> shapefn;
 
   shapefn(0) = 0.25 * xi(0) * xi(1) * (xi(0) - 1.) * (xi(1) - 1.);
@@ -160,8 +165,9 @@ inline Eigen::VectorXd mpm::QuadrilateralElement<2, 9>::shapefn(
 //! Return gradient of shape functions of a 9-node Quadrilateral Element at a
 //! given local coordinate
 template <>
-inline Eigen::MatrixXd mpm::QuadrilateralElement<2, 9>::grad_shapefn(
-    const Eigen::Matrix<double, 2, 1>& xi) const {
+inline Eigen::Matrix<double, 9, 2>
+    mpm::QuadrilateralElement<2, 9>::fixed_grad_shapefn(
+        const Eigen::Matrix<double, 2, 1>& xi) const {
   Eigen::Matrix<double, 9, 2> grad_shapefn;
   // 9-noded
   grad_shapefn(0, 0) = 0.25 * xi(1) * (xi(1) - 1.) * (2 * xi(0) - 1.);
@@ -226,6 +232,23 @@ inline mpm::ElementDegree mpm::QuadrilateralElement<2, 9>::degree() const {
   return mpm::ElementDegree::Quadratic;
 }
 
+//! Return shape functions of a Quadrilateral Element at a given local
+//! coordinate
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::VectorXd mpm::QuadrilateralElement<Tdim, Tnfunctions>::shapefn(
+    const VectorDim& xi) const {
+  return this->fixed_shapefn(xi);
+}
+
+//! Return gradient of shape functions of a Quadrilateral Element at a given
+//! local coordinate
+template <unsigned Tdim, unsigned Tnfunctions>
+inline Eigen::MatrixXd
+    mpm::QuadrilateralElement<Tdim, Tnfunctions>::grad_shapefn(
+        const VectorDim& xi) const {
+  return this->fixed_grad_shapefn(xi);
+}
+
 //! Return shape functions of a Quadrilateral Element at a given local
 //! coordinate, with particle size and deformation gradient
 template <unsigned Tdim, unsigned Tnfunctions>
@@ -362,6 +385,57 @@ inline std::vector<Eigen::MatrixXd>
       xi, nodal_coordinates);
 }
 
+//! Evaluate shape functions of a Quadrilateral Element into a buffer
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void mpm::QuadrilateralElement<Tdim, Tnfunctions>::evaluate_shapefn(
+    const VectorDim& xi, Eigen::Ref<Eigen::VectorXd> shapefn) const {
+  shapefn = this->fixed_shapefn(xi);
+}
+
+//! Evaluate the B-matrix of a Quadrilateral Element at a given local
+//! coordinate for a real cell into a buffer
+template <unsigned Tdim, unsigned Tnfunctions>
+inline void mpm::QuadrilateralElement<Tdim, Tnfunctions>::evaluate_bmatrix(
+    const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+    std::vector<Eigen::MatrixXd>& bmatrix) const {
+  try {
+    // Check if matrices dimensions are correct
+    if ((Tnfunctions != nodal_coordinates.rows()) ||
+        (xi.rows() != nodal_coordinates.cols()))
+      throw std::runtime_error(
+          "BMatrix - Jacobian calculation: Incorrect dimension of xi and "
+          "nodal_coordinates");
+  } catch (std::exception& exception) {
+    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    return;
+  }
+
+  // Get gradient shape functions
+  const Eigen::Matrix<double, Tnfunctions, Tdim> grad_sf =
+      this->fixed_grad_shapefn(xi);
+
+  // Jacobian dx_i/dxi_j
+  const Eigen::Matrix<double, Tdim, Tdim> jacobian =
+      grad_sf.transpose().lazyProduct(nodal_coordinates);
+
+  // Gradient shapefn of the cell
+  // dN/dx = [J]^-1 * dN/dxi
+  const Eigen::Matrix<double, Tnfunctions, Tdim> grad_shapefn =
+      grad_sf * jacobian.inverse();
+
+  // Only allocate on the first call
+  bmatrix.resize(Tnfunctions);
+  for (unsigned i = 0; i < Tnfunctions; ++i) {
+    auto& bi = bmatrix[i];
+    bi.resize(3, Tdim);
+    // clang-format off
+    bi(0, 0) = grad_shapefn(i, 0); bi(0, 1) = 0.;
+    bi(1, 0) = 0.;                 bi(1, 1) = grad_shapefn(i, 1);
+    bi(2, 0) = grad_shapefn(i, 1); bi(2, 1) = grad_shapefn(i, 0);
+    // clang-format on
+  }
+}
+
 //! Return mass_matrix of a Hexahedron Element
 template <unsigned Tdim, unsigned Tnfunctions>
 inline Eigen::MatrixXd
@@ -10,11 +10,16 @@
 // Boost string algorithm
 #include "Eigen/Dense"
 #include <boost/algorithm/string.hpp>
+// JSON
+#include "json.hpp"
 // Speed log
 #include "spdlog/spdlog.h"
 
 #include "logger.h"
 
+//! Alias for JSON
+using Json = nlohmann::json;
+
 namespace mpm {
 
 //! Global index type for the cell
@@ -41,6 +46,11 @@ class ReadMesh {
   //! Delete assignement operator
   ReadMesh& operator=(const ReadMesh<Tdim>&) = delete;
 
+  //! Assign properties of the reader, such as the parameters of a generated
+  //! mesh, readers of files don't have properties
+  //! \param[in] properties Reader properties
+  virtual void properties(const Json& properties) {}
+
   //! Read mesh nodes file
   //! \param[in] mesh file name with nodes and cells
   //! \retval coordinates Vector of nodal coordinates
@@ -52,6 +62,17 @@ class ReadMesh {
   virtual std::vector<std::vector<mpm::Index>> read_mesh_cells(
       const std::string& mesh) = 0;
 
+  //! Read nodes and cells of a mesh file
+  //! \param[in] mesh file name with nodes and cells
+  //! \param[out] coordinates Vector of nodal coordinates
+  //! \param[out] cells Vector of nodal indices of cells
+  virtual void read_mesh(const std::string& mesh,
+                         std::vector<VectorDim>& coordinates,
+                         std::vector<std::vector<mpm::Index>>& cells) {
+    coordinates = this->read_mesh_nodes(mesh);
+    cells = this->read_mesh_cells(mesh);
+  }
+
   //! Read particles file
   //! \param[in] particles_files file name with particle coordinates
   //! \retval coordinates Vector of particle coordinates
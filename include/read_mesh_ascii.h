@@ -5,6 +5,11 @@
 
 #include "Eigen/Dense"
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include "ascii_parser.h"
+#include "mapped_file.h"
 #include "read_mesh.h"
 
 //! MPM namespace
@@ -42,6 +47,14 @@ class ReadMeshAscii : public ReadMesh<Tdim> {
   std::vector<std::vector<mpm::Index>> read_mesh_cells(
       const std::string& mesh) override;
 
+  //! Read nodes and cells of a mesh file in a single parallel pass over the
+  //! memory-mapped file
+  //! \param[in] mesh file name with nodes and cells
+  //! \param[out] coordinates Vector of nodal coordinates
+  //! \param[out] cells Vector of nodal indices of cells
+  void read_mesh(const std::string& mesh, std::vector<VectorDim>& coordinates,
+                 std::vector<std::vector<mpm::Index>>& cells) override;
+
   //! Read particles file
   //! \param[in] particles_files file name with particle coordinates
   //! \retval coordinates Vector of particle coordinates
@@ -4,60 +4,8 @@ std::vector<Eigen::Matrix<double, Tdim, 1>>
     mpm::ReadMeshAscii<Tdim>::read_mesh_nodes(const std::string& mesh) {
   // Nodal coordinates
   std::vector<VectorDim> coordinates;
-  coordinates.clear();
-
-  // input file stream
-  std::fstream file;
-  file.open(mesh.c_str(), std::ios::in);
-
-  try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      // bool to check firstline
-      bool read_first_line = false;
-      // Number of coordinate lines
-      unsigned nlines = 0;
-      // Coordinates
-      Eigen::Matrix<double, Tdim, 1> coords;
-      // # of nodes and cells
-      unsigned nnodes = 0, ncells = 0;
-      // ignore stream
-      double ignore;
-
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            if (!read_first_line) {
-              // Read number of nodes and cells
-              istream >> nnodes >> ncells;
-              read_first_line = true;
-              break;
-            }
-            // Read until nodal information is present
-            if (nlines <= nnodes) {
-              // Read to coordinates
-              for (unsigned i = 0; i < Tdim; ++i) istream >> coords[i];
-              coordinates.emplace_back(coords);
-              break;
-
-            } else {
-              // Ignore stream
-              istream >> ignore;
-            }
-          }
-          ++nlines;
-        }
-      }
-    }
-  } catch (std::exception& exception) {
-    console_->error("Read mesh nodes: {}", exception.what());
-  }
-
+  std::vector<std::vector<mpm::Index>> cells;
+  this->read_mesh(mesh, coordinates, cells);
   return coordinates;
 }
 
@@ -66,66 +14,62 @@ template <unsigned Tdim>
 std::vector<std::vector<mpm::Index>> mpm::ReadMeshAscii<Tdim>::read_mesh_cells(
     const std::string& mesh) {
   // Indices of nodes
+  std::vector<VectorDim> coordinates;
   std::vector<std::vector<mpm::Index>> cells;
-  cells.clear();
+  this->read_mesh(mesh, coordinates, cells);
+  return cells;
+}
 
-  std::fstream file;
-  file.open(mesh.c_str(), std::ios::in);
+//! Read nodes and cells of a mesh from input file
+//! The first data line has the number of nodes and cells, followed by a line
+//! of coordinates for each node and a line of node ids for each cell. Blank
+//! lines and lines with a comment (# or !) are ignored.
+template <unsigned Tdim>
+void mpm::ReadMeshAscii<Tdim>::read_mesh(
+    const std::string& mesh, std::vector<VectorDim>& coordinates,
+    std::vector<std::vector<mpm::Index>>& cells) {
+  coordinates.clear();
+  cells.clear();
 
   try {
-    if (file.is_open() && file.good()) {
-      std::string line;
-      // bool to check firstline
-      bool read_first_line = false;
-      // Number of coordinate lines
-      unsigned nlines = 0;
-      // Coordinates
-      Eigen::Matrix<double, Tdim, 1> coords;
-      // # of nodes and cells
-      mpm::Index nnodes = 0, ncells = 0;
-      // ignore stream
-      double ignore;
-
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // Vector of node ids for a cell
-        std::vector<mpm::Index> nodes;
-        nodes.clear();
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          while (istream.good()) {
-            if (!read_first_line) {
-              // Read number of nodes and cells
-              istream >> nnodes >> ncells;
-              read_first_line = true;
-              break;
-            }
-            // Ignore nodal coordinates
-            if (nlines > nnodes) {
+    const mpm::MappedFile file(mesh);
+    const auto lines = mpm::ascii::data_lines(file.data(), file.size());
+    if (lines.empty()) return;
+
+    // Read number of nodes and cells
+    const char* current = lines[0].begin;
+    mpm::Index nnodes = 0, ncells = 0;
+    mpm::ascii::parse_index(current, lines[0].end, nnodes);
+    mpm::ascii::parse_index(current, lines[0].end, ncells);
+
+    // Node lines follow the first line, cell lines follow nodes
+    const std::size_t nlines = lines.size();
+    const std::size_t node_lines = std::min<std::size_t>(nnodes, nlines - 1);
+    coordinates.resize(node_lines, VectorDim::Zero());
+    cells.resize(nlines - 1 - node_lines);
+
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(1, nlines),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          for (std::size_t i = range.begin(); i != range.end(); ++i) {
+            const char* current = lines[i].begin;
+            if (i <= node_lines) {
+              // Read coordinates
+              auto& coords = coordinates[i - 1];
+              for (unsigned j = 0; j < Tdim; ++j)
+                mpm::ascii::parse_double(current, lines[i].end, coords[j]);
+            } else {
               // Read node ids of each cell
+              auto& nodes = cells[i - 1 - node_lines];
               mpm::Index nid;
-              istream >> nid;
-              nodes.emplace_back(nid);
-            } else {
-              // Ignore stream not related to node ids of cells
-              istream >> ignore;
+              while (mpm::ascii::parse_index(current, lines[i].end, nid))
+                nodes.emplace_back(nid);
             }
           }
-          ++nlines;
-          // Check if nodes is not empty, before adding to cell
-          if (!nodes.empty()) {
-            cells.emplace_back(nodes);
-          }
-        }
-      }
-    }
+        });
   } catch (std::exception& exception) {
-    console_->error("Read mesh cells: {}", exception.what());
+    console_->error("Read mesh: {}", exception.what());
   }
-
-  return cells;
 }
 
 //! Return coordinates of particles
@@ -138,31 +82,22 @@ std::vector<Eigen::Matrix<double, Tdim, 1>>
   std::vector<VectorDim> coordinates;
   coordinates.clear();
 
-  // input file stream
-  std::fstream file;
-  file.open(particles_file.c_str(), std::ios::in);
-
   try {
-    if (file.is_open() && file.good()) {
-      // Line
-      std::string line;
-      while (std::getline(file, line)) {
-        boost::algorithm::trim(line);
-        std::istringstream istream(line);
-        // ignore comment lines (# or !) or blank lines
-        if ((line.find('#') == std::string::npos) &&
-            (line.find('!') == std::string::npos) && (line != "")) {
-          // Coordinates
-          Eigen::Matrix<double, Tdim, 1> coords;
-          while (istream.good()) {
-            // Read to coordinates
-            for (unsigned i = 0; i < Tdim; ++i) istream >> coords[i];
-            break;
+    const mpm::MappedFile file(particles_file);
+    const auto lines = mpm::ascii::data_lines(file.data(), file.size());
+    coordinates.resize(lines.size(), VectorDim::Zero());
+
+    // Read coordinates of each line in parallel
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0, lines.size()),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          for (std::size_t i = range.begin(); i != range.end(); ++i) {
+            const char* current = lines[i].begin;
+            for (unsigned j = 0; j < Tdim; ++j)
+              mpm::ascii::parse_double(current, lines[i].end,
+                                       coordinates[i][j]);
           }
-          coordinates.emplace_back(coords);
-        }
-      }
-    }
+        });
   } catch (std::exception& exception) {
     console_->error("Read particle coordinates: {}", exception.what());
   }
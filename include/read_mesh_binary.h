@@ -0,0 +1,83 @@
+#ifndef MPM_READ_MESH_BINARY_H_
+#define MPM_READ_MESH_BINARY_H_
+
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include "binary_mesh.h"
+#include "read_mesh.h"
+
+//! MPM namespace
+namespace mpm {
+
+//! Global index type for the cell
+using Index = unsigned long long;
+
+//! ReadMeshBinary class
+//! \brief Derived class that returns mesh and particles locations from
+//! memory-mapped binary files written by mpm-convert
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+class ReadMeshBinary : public ReadMesh<Tdim> {
+ public:
+  //! Define a vector of size dimension
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+
+  //! Constructor
+  ReadMeshBinary() : mpm::ReadMesh<Tdim>() {
+    //! Logger
+    console_ = spdlog::get("ReadMeshBinary");
+  }
+
+  //! Destructor
+  ~ReadMeshBinary() override = default;
+
+  //! Read mesh nodes file
+  //! \param[in] mesh file name with nodes and cells
+  //! \retval coordinates Vector of nodal coordinates
+  std::vector<VectorDim> read_mesh_nodes(const std::string& mesh) override;
+
+  //! Read mesh cells file
+  //! \param[in] mesh file name with nodes and cells
+  //! \retval cells Vector of nodal indices of cells
+  std::vector<std::vector<mpm::Index>> read_mesh_cells(
+      const std::string& mesh) override;
+
+  //! Read nodes and cells of a mesh file, which is mapped once
+  //! \param[in] mesh file name with nodes and cells
+  //! \param[out] coordinates Vector of nodal coordinates
+  //! \param[out] cells Vector of nodal indices of cells
+  void read_mesh(const std::string& mesh, std::vector<VectorDim>& coordinates,
+                 std::vector<std::vector<mpm::Index>>& cells) override;
+
+  //! Read particles file
+  //! \param[in] particles_files file name with particle coordinates
+  //! \retval coordinates Vector of particle coordinates
+  std::vector<VectorDim> read_particles(
+      const std::string& particles_file) override;
+
+  //! Read constraints file
+  //! \param[in] velocity_constraints_files file name with constraints
+  std::vector<std::tuple<mpm::Index, unsigned, double>>
+      read_velocity_constraints(
+          const std::string& velocity_constraints_file) override;
+
+ private:
+  //! Copy points of a mapped file in parallel
+  //! \param[in] file Mapped binary mesh file
+  //! \param[out] coordinates Vector of point coordinates
+  void read_points(const MappedBinaryMesh& file,
+                   std::vector<VectorDim>& coordinates) const;
+
+  //! Logger
+  std::shared_ptr<spdlog::logger> console_;
+};  // ReadMeshBinary class
+}  // namespace mpm
+
+#include "read_mesh_binary.tcc"
+
+#endif  // MPM_READ_MESH_BINARY_H_
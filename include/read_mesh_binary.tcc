@@ -0,0 +1,113 @@
+//! Copy points of a mapped file in parallel
+template <unsigned Tdim>
+void mpm::ReadMeshBinary<Tdim>::read_points(
+    const MappedBinaryMesh& file, std::vector<VectorDim>& coordinates) const {
+  if (file.header().dimension != Tdim)
+    throw std::runtime_error("Dimension of binary file doesn't match");
+
+  const std::size_t npoints = file.header().npoints;
+  const double* points = file.points();
+  coordinates.resize(npoints);
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, npoints),
+                    [&](const tbb::blocked_range<std::size_t>& range) {
+                      for (std::size_t i = range.begin(); i != range.end();
+                           ++i)
+                        coordinates[i] = Eigen::Map<const VectorDim>(
+                            points + i * Tdim);
+                    });
+}
+
+//! Return coordinates of nodes in a mesh from binary file
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, Tdim, 1>>
+    mpm::ReadMeshBinary<Tdim>::read_mesh_nodes(const std::string& mesh) {
+  // Nodal coordinates
+  std::vector<VectorDim> coordinates;
+  try {
+    const mpm::MappedBinaryMesh file(mesh);
+    this->read_points(file, coordinates);
+  } catch (std::exception& exception) {
+    console_->error("Read mesh nodes: {}", exception.what());
+    coordinates.clear();
+  }
+  return coordinates;
+}
+
+//! Return indices of nodes of cells in a mesh from binary file
+template <unsigned Tdim>
+std::vector<std::vector<mpm::Index>>
+    mpm::ReadMeshBinary<Tdim>::read_mesh_cells(const std::string& mesh) {
+  // Indices of nodes
+  std::vector<VectorDim> coordinates;
+  std::vector<std::vector<mpm::Index>> cells;
+  this->read_mesh(mesh, coordinates, cells);
+  return cells;
+}
+
+//! Read nodes and cells of a mesh from binary file
+template <unsigned Tdim>
+void mpm::ReadMeshBinary<Tdim>::read_mesh(
+    const std::string& mesh, std::vector<VectorDim>& coordinates,
+    std::vector<std::vector<mpm::Index>>& cells) {
+  coordinates.clear();
+  cells.clear();
+  try {
+    const mpm::MappedBinaryMesh file(mesh);
+    this->read_points(file, coordinates);
+
+    const std::size_t ncells = file.header().ncells;
+    const std::size_t nodes_per_cell = file.header().nodes_per_cell;
+    const uint64_t* nodes = file.cells();
+    cells.resize(ncells);
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, ncells),
+                      [&](const tbb::blocked_range<std::size_t>& range) {
+                        for (std::size_t i = range.begin(); i != range.end();
+                             ++i)
+                          cells[i].assign(nodes + i * nodes_per_cell,
+                                          nodes + (i + 1) * nodes_per_cell);
+                      });
+  } catch (std::exception& exception) {
+    console_->error("Read mesh: {}", exception.what());
+    coordinates.clear();
+    cells.clear();
+  }
+}
+
+//! Return coordinates of particles from binary file
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, Tdim, 1>>
+    mpm::ReadMeshBinary<Tdim>::read_particles(
+        const std::string& particles_file) {
+  // Particle coordinates
+  std::vector<VectorDim> coordinates;
+  try {
+    const mpm::MappedBinaryMesh file(particles_file);
+    this->read_points(file, coordinates);
+  } catch (std::exception& exception) {
+    console_->error("Read particle coordinates: {}", exception.what());
+    coordinates.clear();
+  }
+  return coordinates;
+}
+
+//! Return velocity constraints from binary file
+template <unsigned Tdim>
+std::vector<std::tuple<mpm::Index, unsigned, double>>
+    mpm::ReadMeshBinary<Tdim>::read_velocity_constraints(
+        const std::string& velocity_constraints_file) {
+  // Velocity constraints
+  std::vector<std::tuple<mpm::Index, unsigned, double>> constraints;
+  try {
+    const mpm::MappedBinaryMesh file(velocity_constraints_file);
+    const BinaryConstraint* records = file.constraints();
+    constraints.reserve(file.header().nconstraints);
+    for (std::size_t i = 0; i < file.header().nconstraints; ++i)
+      constraints.emplace_back(std::make_tuple(
+          records[i].id, static_cast<unsigned>(records[i].direction),
+          records[i].velocity));
+  } catch (std::exception& exception) {
+    console_->error("Read velocity constraints: {}", exception.what());
+    constraints.clear();
+  }
+  return constraints;
+}
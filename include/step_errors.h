@@ -0,0 +1,103 @@
+#ifndef MPM_STEP_ERRORS_H_
+#define MPM_STEP_ERRORS_H_
+
+#include <array>
+#include <atomic>
+#include <string>
+
+namespace mpm {
+
+//! Failures of per-step kernels, which are counted instead of thrown
+enum class StepError : unsigned {
+  //! Nodal mass is zero or below the threshold
+  NodalMass = 0,
+  //! Size of a vector doesn't match the degrees of freedom
+  DegreesOfFreedom,
+  //! Particle has no cell
+  ParticleCell,
+  //! Particle mass or volume is not computed
+  ParticleMass,
+  //! Particle has no material
+  ParticleMaterial,
+  //! Number of kinds of failures
+  Count
+};
+
+//! Step errors class
+//! \brief Counters of failures in the per-step kernels of particles, cells
+//! and nodes, which the solver summarises once per step
+//! \details Kernels record a failure and return false, without throwing or
+//! formatting a message. Exceptions and logging are kept for setup and
+//! fatal conditions. Each mesh owns its counters and scopes them over its
+//! iterations, so that concurrent analyses, e.g. the variants of an
+//! ensemble, count their failures apart. Kernels called outside a scope
+//! record in the default counters.
+class StepErrors {
+ public:
+  //! Counters of each kind of failure
+  using Counters =
+      std::array<unsigned long long, static_cast<unsigned>(StepError::Count)>;
+
+  //! Scope class
+  //! \brief Records the failures of the kernels called by the calling
+  //! thread in the given counters while the scope lasts
+  class Scope {
+   public:
+    //! Constructor with the counters of the scope
+    //! \param[in] errors Counters in which failures are recorded
+    explicit Scope(StepErrors* errors) : previous_{current_} {
+      current_ = errors;
+    }
+
+    //! Destructor restores the counters of the enclosing scope
+    ~Scope() { current_ = previous_; }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    //! Counters of the enclosing scope
+    StepErrors* previous_;
+  };
+
+  //! Constructor with zero counters
+  StepErrors() = default;
+
+  StepErrors(const StepErrors&) = delete;
+  StepErrors& operator=(const StepErrors&) = delete;
+
+  //! Return the default step errors of kernels called outside a scope
+  static StepErrors& instance();
+
+  //! Return the step errors of the scope of the calling thread, or the
+  //! default step errors outside a scope
+  static StepErrors& current() {
+    return (current_ != nullptr) ? *current_ : instance();
+  }
+
+  //! Record a failure in the counters
+  //! \param[in] error Kind of failure
+  void record(StepError error) {
+    counters_[static_cast<unsigned>(error)].fetch_add(
+        1, std::memory_order_relaxed);
+  }
+
+  //! Return the counters and reset them
+  Counters collect();
+
+  //! Return a description of a kind of failure
+  //! \param[in] error Kind of failure
+  static std::string description(StepError error);
+
+ private:
+  //! Counters of each kind of failure, updated atomically
+  std::array<std::atomic<unsigned long long>,
+             static_cast<unsigned>(StepError::Count)>
+      counters_{};
+  //! Step errors of the scope of each thread
+  static thread_local StepErrors* current_;
+};
+
+}  // namespace mpm
+
+#endif  // MPM_STEP_ERRORS_H_
@@ -0,0 +1,228 @@
+#ifndef MPM_STEP_KERNELS_H_
+#define MPM_STEP_KERNELS_H_
+
+#include <atomic>
+#include <memory>
+
+#include "Eigen/Dense"
+
+#include "cell.h"
+#include "element.h"
+#include "material/material.h"
+#include "mesh.h"
+#include "node_base.h"
+#include "particle_base.h"
+
+namespace mpm {
+
+//! Virtual kernels struct
+//! \brief Kernels of an explicit step called through the virtual interfaces
+//! of particles and nodes
+//! \details Used for any combination of registered entity types
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+struct VirtualKernels {
+  //! Particle handle
+  using ParticlePtr = std::shared_ptr<ParticleBase<Tdim>>;
+  //! Node handle
+  using NodePtr = std::shared_ptr<NodeBase<Tdim>>;
+  //! Vector of size dimension
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+
+  //! Entities of any type are accepted
+  static bool check_types(Mesh<Tdim>&, const std::shared_ptr<Material<Tdim>>&) {
+    return true;
+  }
+
+  //! Initialise a node
+  static void initialise(const NodePtr& node) { node->initialise(); }
+
+  //! Return the status of a node
+  static bool status(const NodePtr& node) { return node->status(); }
+
+  //! Compute the velocity of a node
+  static void compute_velocity(const NodePtr& node) {
+    node->compute_velocity();
+  }
+
+  //! Compute the acceleration and velocity of a node
+  static bool compute_acceleration_velocity(const NodePtr& node,
+                                            unsigned phase, double dt) {
+    return node->compute_acceleration_velocity(phase, dt);
+  }
+
+  //! Compute the shape functions of a particle
+  static bool compute_shapefn(const ParticlePtr& particle) {
+    return particle->compute_shapefn();
+  }
+
+  //! Compute the volume of a particle
+  static bool compute_volume(const ParticlePtr& particle) {
+    return particle->compute_volume();
+  }
+
+  //! Compute the mass of a particle
+  static bool compute_mass(const ParticlePtr& particle, unsigned phase) {
+    return particle->compute_mass(phase);
+  }
+
+  //! Map the mass and momentum of a particle to nodes
+  static bool map_mass_momentum_to_nodes(const ParticlePtr& particle,
+                                         unsigned phase) {
+    return particle->map_mass_momentum_to_nodes(phase);
+  }
+
+  //! Compute the strain of a particle
+  static void compute_strain(const ParticlePtr& particle, unsigned phase,
+                             double dt) {
+    particle->compute_strain(phase, dt);
+  }
+
+  //! Compute the stress of a particle
+  static bool compute_stress(const ParticlePtr& particle, unsigned phase) {
+    return particle->compute_stress(phase);
+  }
+
+  //! Map the body force of a particle to nodes
+  static void map_body_force(const ParticlePtr& particle, unsigned phase,
+                             const VectorDim& pgravity) {
+    particle->map_body_force(phase, pgravity);
+  }
+
+  //! Map the internal force of a particle to nodes
+  static bool map_internal_force(const ParticlePtr& particle, unsigned phase) {
+    return particle->map_internal_force(phase);
+  }
+
+  //! Compute the updated position of a particle
+  static bool compute_updated_position(const ParticlePtr& particle,
+                                       unsigned phase, double dt) {
+    return particle->compute_updated_position(phase, dt);
+  }
+};
+
+//! Concrete kernels struct
+//! \brief Kernels of an explicit step over the concrete types of particles,
+//! nodes, elements and materials
+//! \details Each call is resolved at compile time, so the particle, cell,
+//! node, element and material kernels of a loop can be inlined. The types
+//! are checked once against the mesh by check_types before the first step.
+//! \tparam Tdim Dimension
+//! \tparam Tparticle Particle type
+//! \tparam Tnode Node type
+//! \tparam Telement Element type of the cells
+//! \tparam Tmaterial Material type of the particles
+template <unsigned Tdim, typename Tparticle, typename Tnode, typename Telement,
+          typename Tmaterial>
+struct ConcreteKernels {
+  //! Particle handle
+  using ParticlePtr = std::shared_ptr<ParticleBase<Tdim>>;
+  //! Node handle
+  using NodePtr = std::shared_ptr<NodeBase<Tdim>>;
+  //! Vector of size dimension
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+
+  //! Check that the entities of a mesh and the material of its particles
+  //! are of the concrete types
+  //! \param[in] mesh Mesh of the analysis
+  //! \param[in] material Material assigned to the particles
+  //! \retval status Return false if an entity is of another type
+  static bool check_types(Mesh<Tdim>& mesh,
+                          const std::shared_ptr<Material<Tdim>>& material) {
+    std::atomic<bool> status{dynamic_cast<Tmaterial*>(material.get()) !=
+                             nullptr};
+    mesh.iterate_over_particles([&status](const ParticlePtr& particle) {
+      if (dynamic_cast<Tparticle*>(particle.get()) == nullptr) status = false;
+    });
+    mesh.iterate_over_nodes([&status](const NodePtr& node) {
+      if (dynamic_cast<Tnode*>(node.get()) == nullptr) status = false;
+    });
+    mesh.iterate_over_cells([&status](const std::shared_ptr<Cell<Tdim>>& cell) {
+      if (dynamic_cast<const Telement*>(cell->element_ptr().get()) == nullptr)
+        status = false;
+    });
+    return status;
+  }
+
+  //! Initialise a node
+  static void initialise(const NodePtr& node) {
+    static_cast<Tnode*>(node.get())->initialise();
+  }
+
+  //! Return the status of a node
+  static bool status(const NodePtr& node) {
+    return static_cast<Tnode*>(node.get())->status();
+  }
+
+  //! Compute the velocity of a node
+  static void compute_velocity(const NodePtr& node) {
+    static_cast<Tnode*>(node.get())->compute_velocity();
+  }
+
+  //! Compute the acceleration and velocity of a node
+  static bool compute_acceleration_velocity(const NodePtr& node,
+                                            unsigned phase, double dt) {
+    return static_cast<Tnode*>(node.get())->compute_acceleration_velocity(
+        phase, dt);
+  }
+
+  //! Compute the shape functions of a particle
+  static bool compute_shapefn(const ParticlePtr& particle) {
+    return static_cast<Tparticle*>(particle.get())
+        ->template compute_shapefn<Telement>();
+  }
+
+  //! Compute the volume of a particle
+  static bool compute_volume(const ParticlePtr& particle) {
+    return static_cast<Tparticle*>(particle.get())->compute_volume();
+  }
+
+  //! Compute the mass of a particle
+  static bool compute_mass(const ParticlePtr& particle, unsigned phase) {
+    return static_cast<Tparticle*>(particle.get())->compute_mass(phase);
+  }
+
+  //! Map the mass and momentum of a particle to nodes
+  static bool map_mass_momentum_to_nodes(const ParticlePtr& particle,
+                                         unsigned phase) {
+    return static_cast<Tparticle*>(particle.get())
+        ->template map_mass_momentum_to_nodes<Tnode>(phase);
+  }
+
+  //! Compute the strain of a particle
+  static void compute_strain(const ParticlePtr& particle, unsigned phase,
+                             double dt) {
+    static_cast<Tparticle*>(particle.get())
+        ->template compute_strain<Tnode>(phase, dt);
+  }
+
+  //! Compute the stress of a particle
+  static bool compute_stress(const ParticlePtr& particle, unsigned phase) {
+    return static_cast<Tparticle*>(particle.get())
+        ->template compute_stress<Tmaterial>(phase);
+  }
+
+  //! Map the body force of a particle to nodes
+  static void map_body_force(const ParticlePtr& particle, unsigned phase,
+                             const VectorDim& pgravity) {
+    static_cast<Tparticle*>(particle.get())
+        ->template map_body_force<Tnode>(phase, pgravity);
+  }
+
+  //! Map the internal force of a particle to nodes
+  static bool map_internal_force(const ParticlePtr& particle, unsigned phase) {
+    return static_cast<Tparticle*>(particle.get())
+        ->template map_internal_force<Tnode>(phase);
+  }
+
+  //! Compute the updated position of a particle
+  static bool compute_updated_position(const ParticlePtr& particle,
+                                       unsigned phase, double dt) {
+    return static_cast<Tparticle*>(particle.get())
+        ->template compute_updated_position<Tnode>(phase, dt);
+  }
+};
+
+}  // namespace mpm
+
+#endif  // MPM_STEP_KERNELS_H_
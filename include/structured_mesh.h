@@ -0,0 +1,102 @@
+#ifndef MPM_STRUCTURED_MESH_H_
+#define MPM_STRUCTURED_MESH_H_
+
+#include <array>
+#include <vector>
+
+#include "Eigen/Dense"
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+#include "read_mesh_ascii.h"
+
+//! MPM namespace
+namespace mpm {
+
+//! Global index type for the cell
+using Index = unsigned long long;
+
+//! StructuredMesh class
+//! \brief Derived class that generates a structured grid of ED2Q4 / ED3H8
+//! cells and velocity constraints on its boundaries in memory, from the
+//! origin, lengths and number of cells along each direction. Particles are
+//! read from ascii file, or generated in cells by the mesh.
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+class StructuredMesh : public ReadMeshAscii<Tdim> {
+ public:
+  //! Define a vector of size dimension
+  using VectorDim = Eigen::Matrix<double, Tdim, 1>;
+
+  //! Constructor
+  StructuredMesh() : mpm::ReadMeshAscii<Tdim>() {
+    static_assert((Tdim == 2 || Tdim == 3), "Invalid dimension");
+    ncells_.fill(1);
+  }
+
+  //! Destructor
+  ~StructuredMesh() override = default;
+
+  //! Assign origin, lengths, number of cells and boundary constraints
+  //! \param[in] properties Structured mesh properties
+  void properties(const Json& properties) override;
+
+  //! Generate nodes of the grid, the mesh file is ignored
+  //! \param[in] mesh Unused file name
+  //! \retval coordinates Vector of nodal coordinates
+  std::vector<VectorDim> read_mesh_nodes(const std::string& mesh) override;
+
+  //! Generate cells of the grid, the mesh file is ignored
+  //! \param[in] mesh Unused file name
+  //! \retval cells Vector of nodal indices of cells
+  std::vector<std::vector<mpm::Index>> read_mesh_cells(
+      const std::string& mesh) override;
+
+  //! Generate nodes and cells of the grid, the mesh file is ignored
+  //! \param[in] mesh Unused file name
+  //! \param[out] coordinates Vector of nodal coordinates
+  //! \param[out] cells Vector of nodal indices of cells
+  void read_mesh(const std::string& mesh, std::vector<VectorDim>& coordinates,
+                 std::vector<std::vector<mpm::Index>>& cells) override;
+
+  //! Generate velocity constraints of boundary nodes, followed by any
+  //! constraints in an ascii file
+  //! \param[in] velocity_constraints_file Optional file name with constraints
+  std::vector<std::tuple<mpm::Index, unsigned, double>>
+      read_velocity_constraints(
+          const std::string& velocity_constraints_file) override;
+
+  //! Return number of nodes
+  mpm::Index nnodes() const;
+
+  //! Return number of cells
+  mpm::Index ncells() const;
+
+ private:
+  //! Velocity constraint on a boundary of the grid
+  struct BoundaryConstraint {
+    //! Normal direction of the boundary
+    unsigned axis;
+    //! Boundary is at the upper end of the axis
+    bool upper;
+    //! Direction of the velocity
+    unsigned direction;
+    //! Velocity
+    double velocity;
+  };
+
+  //! Origin of the grid
+  VectorDim origin_{VectorDim::Zero()};
+  //! Lengths of the grid
+  VectorDim lengths_{VectorDim::Ones()};
+  //! Number of cells along each direction
+  std::array<mpm::Index, Tdim> ncells_;
+  //! Velocity constraints on boundaries
+  std::vector<BoundaryConstraint> constraints_;
+};  // StructuredMesh class
+}  // namespace mpm
+
+#include "structured_mesh.tcc"
+
+#endif  // MPM_STRUCTURED_MESH_H_
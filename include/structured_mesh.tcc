@@ -0,0 +1,162 @@
+//! Assign origin, lengths, number of cells and boundary constraints
+template <unsigned Tdim>
+void mpm::StructuredMesh<Tdim>::properties(const Json& properties) {
+  for (unsigned i = 0; i < Tdim; ++i) {
+    if (properties.find("origin") != properties.end())
+      origin_(i) = properties["origin"].at(i).template get<double>();
+    lengths_(i) = properties["lengths"].at(i).template get<double>();
+    ncells_[i] = properties["ncells"].at(i).template get<mpm::Index>();
+    if (lengths_(i) <= 0. || ncells_[i] == 0)
+      throw std::runtime_error("Structured mesh lengths or cells are invalid");
+  }
+
+  // Boundaries are named by the normal axis and end, e.g., x_min or z_max
+  const std::array<std::string, 3> axes{"x", "y", "z"};
+  constraints_.clear();
+  if (properties.find("boundary_constraints") != properties.end()) {
+    for (const auto& constraint : properties["boundary_constraints"]) {
+      const auto boundary = constraint["boundary"].template get<std::string>();
+      const auto direction = constraint["direction"].template get<unsigned>();
+      const auto velocity = constraint["velocity"].template get<double>();
+      bool valid = false;
+      for (unsigned axis = 0; axis < Tdim; ++axis) {
+        const bool upper = (boundary == axes[axis] + "_max");
+        if (upper || boundary == axes[axis] + "_min") {
+          constraints_.emplace_back(
+              BoundaryConstraint{axis, upper, direction, velocity});
+          valid = true;
+        }
+      }
+      if (!valid || direction >= Tdim)
+        throw std::runtime_error("Structured mesh boundary is invalid: " +
+                                 boundary);
+    }
+  }
+}
+
+//! Return number of nodes
+template <unsigned Tdim>
+mpm::Index mpm::StructuredMesh<Tdim>::nnodes() const {
+  mpm::Index nnodes = 1;
+  for (unsigned i = 0; i < Tdim; ++i) nnodes *= (ncells_[i] + 1);
+  return nnodes;
+}
+
+//! Return number of cells
+template <unsigned Tdim>
+mpm::Index mpm::StructuredMesh<Tdim>::ncells() const {
+  mpm::Index ncells = 1;
+  for (unsigned i = 0; i < Tdim; ++i) ncells *= ncells_[i];
+  return ncells;
+}
+
+//! Generate nodes of the grid
+template <unsigned Tdim>
+std::vector<Eigen::Matrix<double, Tdim, 1>>
+    mpm::StructuredMesh<Tdim>::read_mesh_nodes(const std::string& mesh) {
+  // Nodes are numbered along x first, then y and z
+  std::vector<VectorDim> coordinates(this->nnodes());
+  tbb::parallel_for(tbb::blocked_range<mpm::Index>(0, coordinates.size()),
+                    [&](const tbb::blocked_range<mpm::Index>& range) {
+                      for (mpm::Index n = range.begin(); n != range.end();
+                           ++n) {
+                        mpm::Index index = n;
+                        for (unsigned i = 0; i < Tdim; ++i) {
+                          coordinates[n](i) =
+                              origin_(i) + lengths_(i) *
+                                               (index % (ncells_[i] + 1)) /
+                                               ncells_[i];
+                          index /= (ncells_[i] + 1);
+                        }
+                      }
+                    });
+  return coordinates;
+}
+
+//! Generate cells of the grid
+template <unsigned Tdim>
+std::vector<std::vector<mpm::Index>>
+    mpm::StructuredMesh<Tdim>::read_mesh_cells(const std::string& mesh) {
+  // Offsets of the nodes of a cell from its first node, in the ED2Q4 / ED3H8
+  // ordering: anti-clockwise on the bottom face, then the top face
+  const mpm::Index nx = ncells_[0] + 1;
+  const mpm::Index nxy = (Tdim == 3) ? nx * (ncells_[1] + 1) : 0;
+  std::vector<mpm::Index> offsets{0, 1, nx + 1, nx};
+  if (Tdim == 3)
+    offsets.insert(offsets.end(), {nxy, nxy + 1, nxy + nx + 1, nxy + nx});
+
+  // Cells are numbered along x first, then y and z
+  std::vector<std::vector<mpm::Index>> cells(this->ncells());
+  tbb::parallel_for(tbb::blocked_range<mpm::Index>(0, cells.size()),
+                    [&](const tbb::blocked_range<mpm::Index>& range) {
+                      for (mpm::Index c = range.begin(); c != range.end();
+                           ++c) {
+                        // First node of the cell
+                        mpm::Index index = c, node = 0, stride = 1;
+                        for (unsigned i = 0; i < Tdim; ++i) {
+                          node += (index % ncells_[i]) * stride;
+                          index /= ncells_[i];
+                          stride *= (ncells_[i] + 1);
+                        }
+                        cells[c].resize(offsets.size());
+                        for (unsigned j = 0; j < offsets.size(); ++j)
+                          cells[c][j] = node + offsets[j];
+                      }
+                    });
+  return cells;
+}
+
+//! Generate nodes and cells of the grid
+template <unsigned Tdim>
+void mpm::StructuredMesh<Tdim>::read_mesh(
+    const std::string& mesh, std::vector<VectorDim>& coordinates,
+    std::vector<std::vector<mpm::Index>>& cells) {
+  coordinates = this->read_mesh_nodes(mesh);
+  cells = this->read_mesh_cells(mesh);
+}
+
+//! Generate velocity constraints of boundary nodes
+template <unsigned Tdim>
+std::vector<std::tuple<mpm::Index, unsigned, double>>
+    mpm::StructuredMesh<Tdim>::read_velocity_constraints(
+        const std::string& velocity_constraints_file) {
+  std::vector<std::tuple<mpm::Index, unsigned, double>> constraints;
+  for (const auto& constraint : constraints_) {
+    // Number of nodes on the boundary
+    mpm::Index nnodes = 1;
+    for (unsigned i = 0; i < Tdim; ++i)
+      if (i != constraint.axis) nnodes *= (ncells_[i] + 1);
+
+    const std::size_t begin = constraints.size();
+    constraints.resize(begin + nnodes);
+    tbb::parallel_for(
+        tbb::blocked_range<mpm::Index>(0, nnodes),
+        [&](const tbb::blocked_range<mpm::Index>& range) {
+          for (mpm::Index n = range.begin(); n != range.end(); ++n) {
+            // Index along the normal axis is fixed at the end of the grid
+            mpm::Index index = n, node = 0, stride = 1;
+            for (unsigned i = 0; i < Tdim; ++i) {
+              if (i == constraint.axis) {
+                if (constraint.upper) node += ncells_[i] * stride;
+              } else {
+                node += (index % (ncells_[i] + 1)) * stride;
+                index /= (ncells_[i] + 1);
+              }
+              stride *= (ncells_[i] + 1);
+            }
+            constraints[begin + n] = std::make_tuple(
+                node, constraint.direction, constraint.velocity);
+          }
+        });
+  }
+
+  // Constraints of nodes inside the grid are read from file
+  if (!velocity_constraints_file.empty()) {
+    const auto file_constraints =
+        mpm::ReadMeshAscii<Tdim>::read_velocity_constraints(
+            velocity_constraints_file);
+    constraints.insert(constraints.end(), file_constraints.begin(),
+                       file_constraints.end());
+  }
+  return constraints;
+}
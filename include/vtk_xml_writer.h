@@ -0,0 +1,74 @@
+#ifndef MPM_VTK_XML_WRITER_H_
+#define MPM_VTK_XML_WRITER_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace mpm {
+
+//! VTK XML writer class
+//! \brief Writes points and any number of point data fields to a single VTK
+//! XML PolyData (.vtp) or UnstructuredGrid (.vtu) file without the VTK
+//! library. Data is streamed as appended raw binary straight from contiguous
+//! buffers, which are not copied and must stay valid until written.
+class VtkXmlWriter {
+ public:
+  //! Constructor with coordinates
+  //! \param[in] npoints Number of points
+  //! \param[in] coordinates Contiguous (x, y, z) coordinates of each point
+  VtkXmlWriter(std::size_t npoints, const double* coordinates);
+
+  //! Add a point data field of doubles
+  //! \param[in] name Name of the field
+  //! \param[in] ncomponents Number of components of each point
+  //! \param[in] data Contiguous components of each point
+  void add_point_data(const std::string& name, unsigned ncomponents,
+                      const double* data);
+
+  //! Add a point data field of unsigned 64-bit integers
+  //! \param[in] name Name of the field
+  //! \param[in] ncomponents Number of components of each point
+  //! \param[in] data Contiguous components of each point
+  void add_point_data(const std::string& name, unsigned ncomponents,
+                      const unsigned long long* data);
+
+  //! Add a point data field of unsigned 8-bit integers
+  //! \param[in] name Name of the field
+  //! \param[in] ncomponents Number of components of each point
+  //! \param[in] data Contiguous components of each point
+  void add_point_data(const std::string& name, unsigned ncomponents,
+                      const unsigned char* data);
+
+  //! Write points as vertices and point data, the format (PolyData or
+  //! UnstructuredGrid) is chosen by the file extension (.vtp or .vtu)
+  //! \param[in] filename Name of the VTK file
+  //! \retval status Status of writing the file
+  bool write(const std::string& filename) const;
+
+ private:
+  //! Data array of the appended section
+  struct DataArray {
+    //! Name of the array
+    std::string name;
+    //! VTK type name of the components
+    std::string type;
+    //! Number of components of each point
+    unsigned ncomponents;
+    //! Contiguous data
+    const void* data;
+    //! Size of a component in bytes
+    std::size_t size;
+  };
+
+  //! Number of points
+  std::size_t npoints_;
+  //! Coordinates of points
+  const double* coordinates_;
+  //! Point data fields
+  std::vector<DataArray> fields_;
+};
+
+}  // namespace mpm
+
+#endif  // MPM_VTK_XML_WRITER_H_
@@ -0,0 +1,53 @@
+#include "arena.h"
+
+#include <algorithm>
+#include <cstdint>
+
+//! Construct an arena with the size of a slab
+mpm::Arena::Arena(std::size_t slab_size) : slab_size_{slab_size} {}
+
+//! Allocate memory in the current slab, or in a new slab if it is full
+void* mpm::Arena::allocate(std::size_t bytes, std::size_t alignment) {
+  std::lock_guard<std::mutex> guard(mutex_);
+
+  // Padding to align the free memory of the current slab
+  std::size_t padding =
+      (alignment - reinterpret_cast<std::uintptr_t>(current_) % alignment) %
+      alignment;
+
+  if (current_ == nullptr || padding + bytes > remaining_) {
+    // An object larger than a slab gets a slab of its own
+    const std::size_t size = std::max(slab_size_, bytes + alignment);
+    slabs_.emplace_back(new char[size]);
+    current_ = slabs_.back().get();
+    remaining_ = size;
+    reserved_ += size;
+    padding =
+        (alignment - reinterpret_cast<std::uintptr_t>(current_) % alignment) %
+        alignment;
+  }
+
+  void* ptr = current_ + padding;
+  current_ += padding + bytes;
+  remaining_ -= padding + bytes;
+  allocated_ += bytes;
+  return ptr;
+}
+
+//! Return the number of bytes allocated to objects
+std::size_t mpm::Arena::allocated() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return allocated_;
+}
+
+//! Return the number of bytes reserved in slabs
+std::size_t mpm::Arena::reserved() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return reserved_;
+}
+
+//! Return the number of slabs
+std::size_t mpm::Arena::nslabs() const {
+  std::lock_guard<std::mutex> guard(mutex_);
+  return slabs_.size();
+}
@@ -0,0 +1,168 @@
+#include "ascii_parser.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+#include <tbb/parallel_for.h>
+
+namespace {
+//! Check if a character separates numbers
+inline bool is_space(char c) {
+  return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+//! Return the next token of a line and advance past it
+inline bool next_token(const char*& current, const char* end,
+                       const char*& token_begin, const char*& token_end) {
+  while (current < end && is_space(*current)) ++current;
+  if (current == end) return false;
+  token_begin = current;
+  while (current < end && !is_space(*current)) ++current;
+  token_end = current;
+  return true;
+}
+
+//! Exact powers of ten as doubles
+const double powers_of_ten[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,
+                                1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                1e12, 1e13, 1e14, 1e15, 1e16, 1e17,
+                                1e18, 1e19, 1e20, 1e21, 1e22};
+
+//! Parse a decimal number exactly when the significand and the power of ten
+//! are exactly representable, which covers typical mesh input
+inline bool fast_parse_double(const char* begin, const char* end,
+                              double& value) {
+  const char* p = begin;
+  bool negative = false;
+  if (p < end && (*p == '-' || *p == '+')) negative = (*p++ == '-');
+
+  uint64_t significand = 0;
+  int ndigits = 0, exponent = 0;
+  bool has_digits = false;
+  for (; p < end && *p >= '0' && *p <= '9'; ++p, has_digits = true) {
+    if (significand == 0 && *p == '0') continue;
+    significand = significand * 10 + (*p - '0');
+    ++ndigits;
+  }
+  if (p < end && *p == '.') {
+    for (++p; p < end && *p >= '0' && *p <= '9'; ++p, has_digits = true) {
+      if (significand == 0 && *p == '0') {
+        --exponent;
+        continue;
+      }
+      significand = significand * 10 + (*p - '0');
+      ++ndigits;
+      --exponent;
+    }
+  }
+  if (!has_digits) return false;
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    bool negative_exponent = false;
+    if (p < end && (*p == '-' || *p == '+'))
+      negative_exponent = (*p++ == '-');
+    if (p == end || *p < '0' || *p > '9') return false;
+    int power = 0;
+    for (; p < end && *p >= '0' && *p <= '9'; ++p)
+      if (power < 10000) power = power * 10 + (*p - '0');
+    exponent += negative_exponent ? -power : power;
+  }
+  // Whole token has to be a number, with at most 15 significant digits
+  if (p != end || ndigits > 15 || exponent < -22 || exponent > 22)
+    return false;
+
+  value = static_cast<double>(significand);
+  value = (exponent < 0) ? value / powers_of_ten[-exponent]
+                         : value * powers_of_ten[exponent];
+  if (negative) value = -value;
+  return true;
+}
+}  // namespace
+
+//! Check if a line has data
+bool mpm::ascii::is_data_line(const Line& line) {
+  const std::size_t size = line.end - line.begin;
+  if (std::memchr(line.begin, '#', size) != nullptr ||
+      std::memchr(line.begin, '!', size) != nullptr)
+    return false;
+  return std::any_of(line.begin, line.end,
+                     [](char c) { return !is_space(c); });
+}
+
+//! Split text into data lines
+std::vector<mpm::ascii::Line> mpm::ascii::data_lines(const char* data,
+                                                     std::size_t size) {
+  // A chunk holds the lines, which begin in its range
+  const std::size_t chunk_size = 1 << 20;
+  const std::size_t nchunks = size / chunk_size + 1;
+  std::vector<std::vector<Line>> chunks(nchunks);
+
+  const char* end = data + size;
+  tbb::parallel_for(std::size_t(0), nchunks, [&](std::size_t chunk) {
+    const char* current = data + std::min(size, chunk * chunk_size);
+    const char* last = data + std::min(size, (chunk + 1) * chunk_size);
+    // Skip a line which begins in the previous chunk
+    if (chunk > 0 && current < end && *(current - 1) != '\n') {
+      const void* eol = std::memchr(current, '\n', end - current);
+      current = eol ? static_cast<const char*>(eol) + 1 : end;
+    }
+    while (current < last) {
+      const void* eol = std::memchr(current, '\n', end - current);
+      const char* line_end = eol ? static_cast<const char*>(eol) : end;
+      const Line line{current, line_end};
+      if (is_data_line(line)) chunks[chunk].emplace_back(line);
+      current = line_end + 1;
+    }
+  });
+
+  // Concatenate chunks in order
+  std::size_t nlines = 0;
+  for (const auto& chunk : chunks) nlines += chunk.size();
+  std::vector<Line> lines;
+  lines.reserve(nlines);
+  for (const auto& chunk : chunks)
+    lines.insert(lines.end(), chunk.begin(), chunk.end());
+  return lines;
+}
+
+//! Parse the next number of a line as a double
+bool mpm::ascii::parse_double(const char*& current, const char* end,
+                              double& value) {
+  const char *token_begin, *token_end;
+  if (!next_token(current, end, token_begin, token_end)) return false;
+  if (fast_parse_double(token_begin, token_end, value)) return true;
+
+  // Fall back to strtod on a null terminated copy on the stack
+  char buffer[128];
+  const std::size_t length = token_end - token_begin;
+  if (length >= sizeof(buffer)) return false;
+  std::memcpy(buffer, token_begin, length);
+  buffer[length] = '\0';
+  char* parsed_end;
+  value = std::strtod(buffer, &parsed_end);
+  return parsed_end != buffer;
+}
+
+//! Parse the next number of a line as an unsigned index
+bool mpm::ascii::parse_index(const char*& current, const char* end,
+                             mpm::Index& value) {
+  const char *token_begin, *token_end;
+  if (!next_token(current, end, token_begin, token_end)) return false;
+
+  const char* p = token_begin;
+  if (*p == '+') ++p;
+  if (p == token_end) return false;
+  value = 0;
+  for (; p < token_end && *p >= '0' && *p <= '9'; ++p)
+    value = value * 10 + (*p - '0');
+  // An index may be written as a real number, e.g. 1.0 or 1e3
+  if (p != token_end) {
+    double real;
+    const char* token = token_begin;
+    if (!parse_double(token, token_end, real) || real < 0.) return false;
+    value = static_cast<mpm::Index>(real);
+  }
+  return true;
+}
@@ -0,0 +1,358 @@
+#include <unistd.h>
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <tbb/task_arena.h>
+
+#include "spdlog/spdlog.h"
+#include "tclap/CmdLine.h"
+
+#include "factory.h"
+#include "io.h"
+#include "mpm.h"
+#include "mpm_explicit.h"
+
+namespace {
+
+//! Stages of the explicit solvers, in the order of the CSV columns
+const std::vector<std::string> stages{"setup",
+                                      "initialise_nodes",
+                                      "initialise_particles",
+                                      "map_nodes",
+                                      "stress",
+                                      "body_force",
+                                      "internal_force",
+                                      "update_nodes",
+                                      "update_particles",
+                                      "locate",
+                                      "output"};
+
+//! Benchmark case
+struct BenchmarkCase {
+  //! Canonical problem: elastic_block or column_collapse
+  std::string problem;
+  //! Solver: USF or USL
+  std::string solver;
+  //! Dispatch of the step kernels: static or virtual
+  std::string dispatch;
+  //! Dimension
+  unsigned dimension;
+  //! Number of cells along a unit length
+  unsigned resolution;
+  //! Number of particles per cell along each direction
+  unsigned ppc;
+  //! Number of TBB threads
+  unsigned threads;
+  //! Number of steps
+  mpm::Index nsteps;
+
+  //! Return a name of the case to be used as analysis id and input file
+  std::string name() const {
+    return problem + "-" + solver + "-" + dispatch + "-" +
+           std::to_string(dimension) + "d-r" +
+           std::to_string(resolution) + "-p" + std::to_string(ppc) + "-t" +
+           std::to_string(threads);
+  }
+};
+
+//! Return the input of a canonical problem on a structured mesh with
+//! particles generated in cells, so no input files are needed
+//! \details The elastic block fills a unit box under gravity. The column
+//! collapse is a Bingham column of width 0.5 in a domain of length 2, which
+//! stands in for a granular column, as there is no granular material model.
+//! Lateral boundaries are rollers and the base is fixed in the normal
+//! direction.
+//! \param[in] bcase Benchmark case
+//! \retval input JSON input of the analysis
+Json benchmark_input(const BenchmarkCase& bcase) {
+  const unsigned dim = bcase.dimension;
+  const std::string suffix = std::to_string(dim) + "D";
+  const bool column = (bcase.problem == "column_collapse");
+
+  // Grid and boundary constraints
+  std::vector<double> lengths(dim, 1.), box_max(dim, 1.E+10);
+  std::vector<unsigned> ncells(dim, bcase.resolution);
+  if (column) {
+    lengths[0] = 2.;
+    ncells[0] = 2 * bcase.resolution;
+    box_max[0] = 0.5;
+  }
+  const std::vector<std::string> axes{"x", "y", "z"};
+  Json constraints = Json::array();
+  for (unsigned i = 0; i < dim; ++i) {
+    constraints.push_back(
+        {{"boundary", axes[i] + "_min"}, {"direction", i}, {"velocity", 0.}});
+    if (i + 1 < dim)
+      constraints.push_back(
+          {{"boundary", axes[i] + "_max"}, {"direction", i}, {"velocity", 0.}});
+  }
+
+  // Material
+  const double density = column ? 1800. : 1000.;
+  const double youngs_modulus = 1.0E+6;
+  const double poisson_ratio = 0.3;
+  Json material = {{"id", 0},
+                   {"type", (column ? "Bingham" : "LinearElastic") + suffix},
+                   {"density", density},
+                   {"youngs_modulus", youngs_modulus},
+                   {"poisson_ratio", poisson_ratio}};
+  if (column) {
+    material["tau0"] = 200.;
+    material["mu"] = 0.1;
+    material["critical_shear_rate"] = 0.001;
+  }
+
+  // Time step from the P-wave speed and the cell size
+  const double pwave_modulus =
+      youngs_modulus * (1. - poisson_ratio) /
+      ((1. + poisson_ratio) * (1. - 2. * poisson_ratio));
+  const double dt =
+      0.1 / bcase.resolution / std::sqrt(pwave_modulus / density);
+
+  std::vector<double> gravity(dim, 0.);
+  gravity[dim - 1] = -9.81;
+
+  return {{"title", "Benchmark " + bcase.name()},
+          {"mesh",
+           {{"mesh_reader", "StructuredMesh" + suffix},
+            {"node_type", "N" + suffix},
+            {"cell_type", (dim == 2) ? "ED2Q4" : "ED3H8"},
+            {"particle_type", "P" + suffix},
+            {"material_id", 0},
+            {"structured_mesh",
+             {{"lengths", lengths},
+              {"ncells", ncells},
+              {"boundary_constraints", constraints}}},
+            {"generate_particles",
+             {{"nquadratures", bcase.ppc}, {"box_max", box_max}}}}},
+          {"materials", {material}},
+          {"analysis",
+           {{"dt", dt},
+            {"uuid", bcase.name()},
+            {"nsteps", bcase.nsteps},
+            {"static_dispatch", bcase.dispatch == "static"},
+            {"gravity", gravity}}},
+          {"post_processing",
+           {{"path", "results/"},
+            {"output_steps", bcase.nsteps},
+            {"vtk", "none"}}}};
+}
+
+//! Return resident memory of the process in MB, or the peak resident memory
+//! where the current one isn't available
+double resident_memory() {
+  std::ifstream statm("/proc/self/statm");
+  unsigned long long size = 0, resident = 0;
+  if (statm >> size >> resident)
+    return resident * static_cast<double>(sysconf(_SC_PAGESIZE)) / 1.0E+6;
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  return usage.ru_maxrss / 1.0E+3;
+}
+
+//! Run a benchmark case with a solver and write a row of results
+//! \tparam Tdim Dimension
+//! \param[in] bcase Benchmark case
+//! \param[in] working_dir Working directory of inputs and results
+//! \param[in] csv Results file
+//! \retval status Status of the solver
+template <unsigned Tdim>
+bool run_case(const BenchmarkCase& bcase, const std::string& working_dir,
+              std::ofstream& csv) {
+  // Write input file
+  const std::string input_file = bcase.name() + ".json";
+  std::ofstream input(working_dir + input_file);
+  input << benchmark_input(bcase).dump(2);
+  input.close();
+
+  // Create solver through the same IO as the mpm executable
+  const std::string analysis =
+      "MPMExplicit" + bcase.solver + std::to_string(Tdim) + "D";
+  std::vector<std::string> args{"mpmbenchmark", "-f",       working_dir,
+                                "-i",           input_file, "-a",
+                                analysis};
+  std::vector<char*> argv;
+  for (auto& arg : args) argv.emplace_back(&arg[0]);
+  auto io = std::make_unique<mpm::IO>(argv.size(), argv.data());
+
+  const std::string key = mpm::analysis_key(*io);
+  const auto mpm =
+      Factory<mpm::MPM, std::unique_ptr<mpm::IO>&&>::instance()->create(
+          key, std::move(io));
+  const auto solver = std::dynamic_pointer_cast<mpm::MPMExplicit<Tdim>>(mpm);
+  if (solver == nullptr)
+    throw std::runtime_error("Analysis " + key + " of " + bcase.name() +
+                             " isn't a " + std::to_string(Tdim) +
+                             "D explicit solver");
+
+  // Solve on a limited number of threads
+  bool status = false;
+  tbb::task_arena arena(bcase.threads);
+  const auto start = std::chrono::steady_clock::now();
+  arena.execute([&]() { status = solver->solve(); });
+  const double wall_time = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+  const double memory = resident_memory();
+
+  // Particle updates per second of the time steps, without setup
+  const auto& stage_times = solver->stage_times();
+  const auto setup = stage_times.find("setup");
+  const double step_time =
+      wall_time - (setup != stage_times.end() ? setup->second : 0.);
+  const double updates = static_cast<double>(solver->nparticles()) *
+                         bcase.nsteps / std::max(step_time, 1.E-12);
+
+  csv << bcase.problem << "," << bcase.solver << "," << bcase.dispatch << ","
+      << Tdim << ","
+      << bcase.resolution << "," << bcase.ppc << "," << bcase.threads << ","
+      << solver->nparticles() << "," << bcase.nsteps << "," << wall_time;
+  for (const auto& stage : stages) {
+    const auto itr = stage_times.find(stage);
+    csv << "," << (itr != stage_times.end() ? itr->second : 0.);
+  }
+  csv << "," << memory << "," << updates << "," << status << std::endl;
+  return status;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  // Only report warnings and errors of the solvers
+  spdlog::set_level(spdlog::level::warn);
+  auto console = spdlog::stdout_color_mt("mpmbenchmark");
+  console->set_level(spdlog::level::info);
+
+  try {
+    TCLAP::CmdLine cmd("Scaling benchmarks of explicit MPM (CB-Geo)", ' ',
+                       "Alpha V1.0");
+
+    TCLAP::ValueArg<std::string> output_arg(
+        "o", "output", "CSV file of results [benchmark.csv]", false,
+        "benchmark.csv", "output");
+    cmd.add(output_arg);
+    TCLAP::ValueArg<std::string> working_dir_arg(
+        "f", "working_dir", "Folder of inputs and results [benchmark/]",
+        false, "benchmark/", "working_dir");
+    cmd.add(working_dir_arg);
+    TCLAP::MultiArg<std::string> problem_arg(
+        "p", "problem", "Problem: elastic_block or column_collapse [both]",
+        false, "problem");
+    cmd.add(problem_arg);
+    TCLAP::MultiArg<std::string> solver_arg(
+        "s", "solver", "Solver: USF or USL [both]", false, "solver");
+    cmd.add(solver_arg);
+    TCLAP::MultiArg<std::string> dispatch_arg(
+        "k", "dispatch",
+        "Dispatch of the step kernels: static or virtual [static]", false,
+        "dispatch");
+    cmd.add(dispatch_arg);
+    TCLAP::MultiArg<unsigned> dimension_arg("d", "dimension",
+                                            "Dimension: 2 or 3 [both]", false,
+                                            "dimension");
+    cmd.add(dimension_arg);
+    TCLAP::MultiArg<unsigned> resolution_arg(
+        "r", "resolution", "Cells along a unit length [16]", false,
+        "resolution");
+    cmd.add(resolution_arg);
+    TCLAP::MultiArg<unsigned> ppc_arg(
+        "c", "ppc", "Particles per cell along each direction, 1 to 3 [2]",
+        false, "ppc");
+    cmd.add(ppc_arg);
+    TCLAP::ValueArg<unsigned> threads_arg(
+        "t", "threads", "Maximum number of threads [hardware concurrency]",
+        false, std::max(1u, std::thread::hardware_concurrency()), "threads");
+    cmd.add(threads_arg);
+    TCLAP::ValueArg<unsigned> nsteps_arg("n", "nsteps", "Number of steps [100]",
+                                         false, 100, "nsteps");
+    cmd.add(nsteps_arg);
+    TCLAP::SwitchArg weak_arg(
+        "w", "weak",
+        "Weak scaling: cells per thread are kept constant, otherwise the "
+        "problem size is fixed (strong scaling)");
+    cmd.add(weak_arg);
+
+    cmd.parse(argc, argv);
+
+    // Defaults of the multiple arguments
+    auto problems = problem_arg.getValue();
+    if (problems.empty()) problems = {"elastic_block", "column_collapse"};
+    auto solvers = solver_arg.getValue();
+    if (solvers.empty()) solvers = {"USF", "USL"};
+    auto dispatches = dispatch_arg.getValue();
+    if (dispatches.empty()) dispatches = {"static"};
+    auto dimensions = dimension_arg.getValue();
+    if (dimensions.empty()) dimensions = {2, 3};
+    auto resolutions = resolution_arg.getValue();
+    if (resolutions.empty()) resolutions = {16};
+    auto ppcs = ppc_arg.getValue();
+    if (ppcs.empty()) ppcs = {2};
+
+    // Thread counts are powers of two up to the maximum
+    std::vector<unsigned> threads;
+    for (unsigned t = 1; t < threads_arg.getValue(); t *= 2)
+      threads.emplace_back(t);
+    threads.emplace_back(threads_arg.getValue());
+
+    std::string working_dir = working_dir_arg.getValue();
+    if (working_dir.back() != '/') working_dir += "/";
+    boost::filesystem::create_directories(working_dir);
+
+    // Cases of all combinations of the arguments
+    std::vector<BenchmarkCase> cases;
+    for (const auto& problem : problems)
+      for (const auto& solver : solvers)
+        for (const auto& dispatch : dispatches)
+          for (const auto dimension : dimensions)
+            for (const auto resolution : resolutions)
+              for (const auto ppc : ppcs)
+                for (const auto nthreads : threads) {
+                  BenchmarkCase bcase{problem,   solver,     dispatch,
+                                      dimension, resolution, ppc,
+                                      nthreads,  nsteps_arg.getValue()};
+                  // Cells grow with threads in weak scaling
+                  if (weak_arg.getValue())
+                    bcase.resolution = static_cast<unsigned>(std::lround(
+                        resolution * std::pow(nthreads, 1. / dimension)));
+                  cases.emplace_back(bcase);
+                }
+
+    std::ofstream csv(output_arg.getValue());
+    csv << "problem,solver,dispatch,dimension,resolution,particles_per_cell,"
+           "threads,nparticles,nsteps,wall_time";
+    for (const auto& stage : stages) csv << "," << stage;
+    csv << ",memory_mb,particle_updates_per_second,status" << std::endl;
+
+    bool status = true;
+    for (const auto& bcase : cases) {
+      console->info("Running {}", bcase.name());
+      if (bcase.dimension == 2)
+        status = run_case<2>(bcase, working_dir, csv) && status;
+      else if (bcase.dimension == 3)
+        status = run_case<3>(bcase, working_dir, csv) && status;
+      else
+        throw std::runtime_error("Dimension must be 2 or 3");
+    }
+    if (!status) return EXIT_FAILURE;
+
+  } catch (TCLAP::ArgException& except) {
+    console->error("error: {}  for arg {}", except.error(), except.argId());
+    return EXIT_FAILURE;
+  } catch (std::exception& exception) {
+    console->error("mpmbenchmark: {}", exception.what());
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,67 @@
+#include "binary_mesh.h"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+namespace {
+//! Signature of a binary mesh file
+const char binary_mesh_signature[8] = {'M', 'P', 'M', 'M', 'E', 'S', 'H', '\0'};
+//! Version of the binary mesh format
+const uint32_t binary_mesh_version = 1;
+}  // namespace
+
+//! Write a binary mesh input file
+bool mpm::write_binary_mesh(const std::string& filename, unsigned dimension,
+                            const std::vector<double>& points,
+                            uint64_t nodes_per_cell,
+                            const std::vector<uint64_t>& cells,
+                            const std::vector<BinaryConstraint>& constraints) {
+  if (dimension == 0 || points.size() % dimension != 0 ||
+      (nodes_per_cell == 0 && !cells.empty()) ||
+      (nodes_per_cell > 0 && cells.size() % nodes_per_cell != 0))
+    return false;
+
+  BinaryMeshHeader header;
+  std::memcpy(header.signature, binary_mesh_signature,
+              sizeof(header.signature));
+  header.version = binary_mesh_version;
+  header.dimension = dimension;
+  header.npoints = points.size() / dimension;
+  header.nodes_per_cell = nodes_per_cell;
+  header.ncells = (nodes_per_cell > 0) ? cells.size() / nodes_per_cell : 0;
+  header.nconstraints = constraints.size();
+
+  std::ofstream file(filename, std::ios::out | std::ios::binary);
+  if (!file.is_open()) return false;
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  file.write(reinterpret_cast<const char*>(points.data()),
+             points.size() * sizeof(double));
+  file.write(reinterpret_cast<const char*>(cells.data()),
+             cells.size() * sizeof(uint64_t));
+  file.write(reinterpret_cast<const char*>(constraints.data()),
+             constraints.size() * sizeof(BinaryConstraint));
+  return file.good();
+}
+
+//! Map a binary mesh file
+mpm::MappedBinaryMesh::MappedBinaryMesh(const std::string& filename)
+    : file_(filename) {
+  // Check signature, version and size
+  if (file_.size() < sizeof(BinaryMeshHeader))
+    throw std::runtime_error("Binary mesh file is invalid: " + filename);
+  const auto& header = this->header();
+  if (std::memcmp(header.signature, binary_mesh_signature,
+                  sizeof(header.signature)) != 0)
+    throw std::runtime_error("Binary mesh file is invalid: " + filename);
+  if (header.version != binary_mesh_version)
+    throw std::runtime_error("Binary mesh version is not supported: " +
+                             filename);
+  const std::size_t size =
+      sizeof(BinaryMeshHeader) +
+      header.npoints * header.dimension * sizeof(double) +
+      header.ncells * header.nodes_per_cell * sizeof(uint64_t) +
+      header.nconstraints * sizeof(BinaryConstraint);
+  if (file_.size() != size)
+    throw std::runtime_error("Binary mesh file is truncated: " + filename);
+}
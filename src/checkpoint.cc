@@ -0,0 +1,99 @@
+#include "checkpoint.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+namespace {
+//! Signature of a checkpoint file
+const char checkpoint_signature[8] = {'M', 'P', 'M', 'C', 'K', 'P', 'T', '\0'};
+//! Version of the checkpoint format
+const uint32_t checkpoint_version = 1;
+
+//! Write a buffer at an offset, retrying partial writes
+bool write_at(int fd, const char* data, std::size_t nbytes, off_t offset) {
+  while (nbytes > 0) {
+    const ssize_t written = pwrite(fd, data, nbytes, offset);
+    if (written <= 0) return false;
+    data += written;
+    nbytes -= written;
+    offset += written;
+  }
+  return true;
+}
+}  // namespace
+
+//! Create a header of a binary checkpoint file
+mpm::CheckpointHeader mpm::checkpoint_header(unsigned dimension,
+                                             mpm::Index nparticles,
+                                             mpm::Index step, double time) {
+  CheckpointHeader header;
+  std::memcpy(header.signature, checkpoint_signature,
+              sizeof(header.signature));
+  header.version = checkpoint_version;
+  header.dimension = dimension;
+  header.nparticles = nparticles;
+  header.step = step;
+  header.time = time;
+  return header;
+}
+
+//! Write a binary checkpoint file
+bool mpm::write_checkpoint(const std::string& filename,
+                           const CheckpointHeader& header,
+                           const std::vector<CheckpointParticle>& particles) {
+  const std::string tmp_filename = filename + ".tmp";
+  const int fd = open(tmp_filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) return false;
+
+  const std::size_t nbytes =
+      sizeof(CheckpointHeader) + particles.size() * sizeof(CheckpointParticle);
+  bool status = (ftruncate(fd, nbytes) == 0) &&
+                write_at(fd, reinterpret_cast<const char*>(&header),
+                         sizeof(CheckpointHeader), 0);
+
+  // Particles are written as independent ranges of the file
+  std::atomic<bool> particles_status{status};
+  if (status)
+    tbb::parallel_for(
+        tbb::blocked_range<std::size_t>(0, particles.size(), 16384),
+        [&](const tbb::blocked_range<std::size_t>& range) {
+          const off_t offset = sizeof(CheckpointHeader) +
+                               range.begin() * sizeof(CheckpointParticle);
+          const auto data =
+              reinterpret_cast<const char*>(&particles[range.begin()]);
+          if (!write_at(fd, data, range.size() * sizeof(CheckpointParticle),
+                        offset))
+            particles_status = false;
+        });
+  status = particles_status;
+
+  if (close(fd) != 0) status = false;
+  // Replace the checkpoint only if it is complete
+  if (status)
+    status = (std::rename(tmp_filename.c_str(), filename.c_str()) == 0);
+  if (!status) std::remove(tmp_filename.c_str());
+  return status;
+}
+
+//! Map a checkpoint file
+mpm::MappedCheckpoint::MappedCheckpoint(const std::string& filename)
+    : file_(filename) {
+  // Check signature, version and size
+  if (file_.size() < sizeof(CheckpointHeader))
+    throw std::runtime_error("Checkpoint file is invalid: " + filename);
+  const auto& header = this->header();
+  if (std::memcmp(header.signature, checkpoint_signature,
+                  sizeof(header.signature)) != 0 ||
+      header.version != checkpoint_version ||
+      file_.size() != sizeof(CheckpointHeader) +
+                          header.nparticles * sizeof(CheckpointParticle))
+    throw std::runtime_error("Checkpoint file is invalid: " + filename);
+}
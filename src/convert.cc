@@ -0,0 +1,143 @@
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "spdlog/spdlog.h"
+#include "tclap/CmdLine.h"
+
+#include "binary_mesh.h"
+#include "read_mesh_ascii.h"
+
+//! Convert ASCII mesh, particles and velocity constraints files to binary
+//! \tparam Tdim Dimension
+//! \param[in] mesh_file ASCII mesh file, ignored if empty
+//! \param[in] particles_file ASCII particles file, ignored if empty
+//! \param[in] constraints_file ASCII velocity constraints file, ignored if
+//! empty
+//! \param[in] output Prefix of binary files
+template <unsigned Tdim>
+void convert(const std::string& mesh_file, const std::string& particles_file,
+             const std::string& constraints_file, const std::string& output) {
+  auto console = spdlog::get("mpm-convert");
+  auto reader = std::make_unique<mpm::ReadMeshAscii<Tdim>>();
+
+  // Mesh nodes and cells
+  if (!mesh_file.empty()) {
+    std::vector<Eigen::Matrix<double, Tdim, 1>> coordinates;
+    std::vector<std::vector<mpm::Index>> cells;
+    reader->read_mesh(mesh_file, coordinates, cells);
+    if (coordinates.empty())
+      throw std::runtime_error("No nodes were read from " + mesh_file);
+
+    std::vector<double> points;
+    points.reserve(coordinates.size() * Tdim);
+    for (const auto& coordinate : coordinates)
+      points.insert(points.end(), coordinate.data(), coordinate.data() + Tdim);
+
+    const uint64_t nodes_per_cell = cells.empty() ? 0 : cells.front().size();
+    std::vector<uint64_t> connectivity;
+    connectivity.reserve(cells.size() * nodes_per_cell);
+    for (const auto& cell : cells) {
+      if (cell.size() != nodes_per_cell)
+        throw std::runtime_error("Cells with different number of nodes");
+      connectivity.insert(connectivity.end(), cell.begin(), cell.end());
+    }
+
+    const std::string file = output + "-mesh.bin";
+    if (!mpm::write_binary_mesh(file, Tdim, points, nodes_per_cell,
+                                connectivity, {}))
+      throw std::runtime_error("Failed to write " + file);
+    console->info("Wrote {} nodes and {} cells to {}", coordinates.size(),
+                  cells.size(), file);
+  }
+
+  // Particles
+  if (!particles_file.empty()) {
+    const auto coordinates = reader->read_particles(particles_file);
+    if (coordinates.empty())
+      throw std::runtime_error("No particles were read from " +
+                               particles_file);
+
+    std::vector<double> points;
+    points.reserve(coordinates.size() * Tdim);
+    for (const auto& coordinate : coordinates)
+      points.insert(points.end(), coordinate.data(), coordinate.data() + Tdim);
+
+    const std::string file = output + "-particles.bin";
+    if (!mpm::write_binary_mesh(file, Tdim, points, 0, {}, {}))
+      throw std::runtime_error("Failed to write " + file);
+    console->info("Wrote {} particles to {}", coordinates.size(), file);
+  }
+
+  // Velocity constraints
+  if (!constraints_file.empty()) {
+    const auto constraints =
+        reader->read_velocity_constraints(constraints_file);
+
+    std::vector<mpm::BinaryConstraint> records;
+    records.reserve(constraints.size());
+    for (const auto& constraint : constraints)
+      records.emplace_back(mpm::BinaryConstraint{std::get<0>(constraint),
+                                                 std::get<1>(constraint),
+                                                 std::get<2>(constraint)});
+
+    const std::string file = output + "-constraints.bin";
+    if (!mpm::write_binary_mesh(file, Tdim, {}, 0, {}, records))
+      throw std::runtime_error("Failed to write " + file);
+    console->info("Wrote {} velocity constraints to {}", records.size(), file);
+  }
+}
+
+int main(int argc, char** argv) {
+  // Initialise logger
+  auto console = spdlog::stdout_color_mt("mpm-convert");
+
+  try {
+    TCLAP::CmdLine cmd("Convert ASCII mesh and particles to binary (CB-Geo)",
+                       ' ', "Alpha V1.0");
+
+    // Dimension
+    TCLAP::ValueArg<unsigned> dim_arg("d", "dimension", "Dimension (2 or 3)",
+                                      true, 3, "dimension");
+    cmd.add(dim_arg);
+
+    // Input files
+    TCLAP::ValueArg<std::string> mesh_arg("m", "mesh", "ASCII mesh file",
+                                          false, "", "mesh");
+    cmd.add(mesh_arg);
+    TCLAP::ValueArg<std::string> particles_arg(
+        "p", "particles", "ASCII particles file", false, "", "particles");
+    cmd.add(particles_arg);
+    TCLAP::ValueArg<std::string> constraints_arg(
+        "c", "constraints", "ASCII velocity constraints file", false, "",
+        "constraints");
+    cmd.add(constraints_arg);
+
+    // Output prefix
+    TCLAP::ValueArg<std::string> output_arg(
+        "o", "output", "Prefix of binary files [mpm]", false, "mpm", "output");
+    cmd.add(output_arg);
+
+    // Parse arguments
+    cmd.parse(argc, argv);
+
+    if (dim_arg.getValue() == 2)
+      convert<2>(mesh_arg.getValue(), particles_arg.getValue(),
+                 constraints_arg.getValue(), output_arg.getValue());
+    else if (dim_arg.getValue() == 3)
+      convert<3>(mesh_arg.getValue(), particles_arg.getValue(),
+                 constraints_arg.getValue(), output_arg.getValue());
+    else
+      throw std::runtime_error("Dimension must be 2 or 3");
+
+  } catch (TCLAP::ArgException& except) {
+    console->error("error: {}  for arg {}", except.error(), except.argId());
+    return EXIT_FAILURE;
+  } catch (std::exception& exception) {
+    console->error("mpm-convert: {}", exception.what());
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,339 @@
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+#include "hdf5.h"
+
+namespace {
+//! Write a scalar attribute to a HDF5 object
+bool write_hdf5_attribute(hid_t object_id, const char* name, hid_t type,
+                          const void* value) {
+  hid_t space_id = H5Screate(H5S_SCALAR);
+  hid_t attribute_id = H5Acreate2(object_id, name, type, space_id,
+                                  H5P_DEFAULT, H5P_DEFAULT);
+  bool status = (attribute_id >= 0);
+  if (status) status = (H5Awrite(attribute_id, type, value) >= 0);
+  if (attribute_id >= 0) H5Aclose(attribute_id);
+  H5Sclose(space_id);
+  return status;
+}
+
+//! Read a scalar attribute of a HDF5 object
+bool read_hdf5_attribute(hid_t object_id, const char* name, hid_t type,
+                         void* value) {
+  if (H5Aexists(object_id, name) <= 0) return false;
+  hid_t attribute_id = H5Aopen(object_id, name, H5P_DEFAULT);
+  if (attribute_id < 0) return false;
+  const bool status = (H5Aread(attribute_id, type, value) >= 0);
+  H5Aclose(attribute_id);
+  return status;
+}
+
+//! Collect output step groups while iterating over links of a file
+herr_t collect_hdf5_step(hid_t file_id, const char* name, const H5L_info_t*,
+                         void* data) {
+  auto steps = static_cast<std::vector<mpm::HDF5Step>*>(data);
+  if (H5Oexists_by_name(file_id, name, H5P_DEFAULT) <= 0) return 0;
+
+  hid_t group_id = H5Gopen2(file_id, name, H5P_DEFAULT);
+  if (group_id < 0) return 0;
+  mpm::HDF5Step step;
+  step.group = name;
+  // Skip groups which aren't output steps
+  if (read_hdf5_attribute(group_id, "step", H5T_NATIVE_ULLONG, &step.step) &&
+      read_hdf5_attribute(group_id, "time", H5T_NATIVE_DOUBLE, &step.time)) {
+    step.nparticles = mpm::hdf5_dataset_rows(group_id, "id");
+    steps->emplace_back(step);
+  }
+  H5Gclose(group_id);
+  return 0;
+}
+
+//! Closing elements of an XDMF index, after the grids of its steps
+const std::string xdmf_footer = "    </Grid>\n  </Domain>\n</Xdmf>\n";
+
+//! Write the grid of an output step to an XDMF index
+void write_xdmf_grid(std::ostream& xdmf, const std::string& hdf5_file,
+                     const mpm::HDF5Step& step) {
+  // Write a data item referring to a dataset of a step
+  auto data_item = [&xdmf, &hdf5_file, &step](const std::string& dataset,
+                                              unsigned ncols, const char* type,
+                                              unsigned precision) {
+    xdmf << "        <DataItem Dimensions=\"" << step.nparticles << " "
+         << ncols << "\" NumberType=\"" << type << "\" Precision=\""
+         << precision << "\" Format=\"HDF\">" << hdf5_file << ":/"
+         << step.group << "/" << dataset << "</DataItem>\n";
+  };
+  // Write a particle attribute of a step
+  auto attribute = [&xdmf, &data_item](const std::string& name,
+                                       const char* type, unsigned ncols) {
+    xdmf << "      <Attribute Name=\"" << name << "\" AttributeType=\""
+         << type << "\" Center=\"Node\">\n";
+    data_item(name, ncols, "Float", 8);
+    xdmf << "      </Attribute>\n";
+  };
+
+  const unsigned nvector = mpm::HDF5ParticleColumns::Nvector;
+  const unsigned ntensor = mpm::HDF5ParticleColumns::Ntensor;
+
+  xdmf.precision(16);
+  xdmf << "    <Grid Name=\"" << step.group << "\" GridType=\"Uniform\">\n"
+       << "      <Time Value=\"" << step.time << "\"/>\n"
+       << "      <Topology TopologyType=\"Polyvertex\" NumberOfElements=\""
+       << step.nparticles << "\" NodesPerElement=\"1\"/>\n"
+       << "      <Geometry GeometryType=\"XYZ\">\n";
+  data_item("coordinates", nvector, "Float", 8);
+  xdmf << "      </Geometry>\n"
+       << "      <Attribute Name=\"id\" AttributeType=\"Scalar\" "
+       << "Center=\"Node\">\n";
+  data_item("id", 1, "UInt", 8);
+  xdmf << "      </Attribute>\n";
+  attribute("mass", "Scalar", 1);
+  attribute("velocities", "Vector", nvector);
+  attribute("stresses", "Tensor6", ntensor);
+  attribute("strains", "Tensor6", ntensor);
+  attribute("volumetric_strains", "Scalar", 1);
+  xdmf << "    </Grid>\n";
+}
+}  // namespace
+
+//! Write a 2D dataset to a HDF5 file or group
+bool mpm::write_hdf5_dataset(hid_t location_id, const std::string& name,
+                             hid_t type, hsize_t nrows, hsize_t ncols,
+                             const void* data, const HDF5Options& options) {
+  const hsize_t dims[2] = {nrows, ncols};
+  hid_t space_id = H5Screate_simple(2, dims, NULL);
+  hid_t plist_id = H5Pcreate(H5P_DATASET_CREATE);
+
+  // Filters need a chunked layout, which can't have empty chunks
+  if (nrows > 0 && options.chunk_size > 0) {
+    const hsize_t chunk[2] = {std::min(nrows, options.chunk_size), ncols};
+    H5Pset_chunk(plist_id, 2, chunk);
+    if (options.shuffle) H5Pset_shuffle(plist_id);
+    if (options.compression > 0 && H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0)
+      H5Pset_deflate(plist_id, std::min(options.compression, 9u));
+  }
+
+  hid_t dataset_id = H5Dcreate2(location_id, name.c_str(), type, space_id,
+                                H5P_DEFAULT, plist_id, H5P_DEFAULT);
+  bool status = (dataset_id >= 0);
+  if (status && nrows > 0)
+    status =
+        (H5Dwrite(dataset_id, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) >= 0);
+
+  if (dataset_id >= 0) H5Dclose(dataset_id);
+  H5Pclose(plist_id);
+  H5Sclose(space_id);
+  return status;
+}
+
+//! Return the number of rows of a dataset
+hsize_t mpm::hdf5_dataset_rows(hid_t location_id, const std::string& name) {
+  hsize_t nrows = 0;
+  if (H5Lexists(location_id, name.c_str(), H5P_DEFAULT) <= 0) return nrows;
+
+  hid_t dataset_id = H5Dopen2(location_id, name.c_str(), H5P_DEFAULT);
+  if (dataset_id < 0) return nrows;
+  hid_t space_id = H5Dget_space(dataset_id);
+  if (H5Sget_simple_extent_ndims(space_id) > 0) {
+    hsize_t dims[H5S_MAX_RANK];
+    H5Sget_simple_extent_dims(space_id, dims, NULL);
+    nrows = dims[0];
+  }
+  H5Sclose(space_id);
+  H5Dclose(dataset_id);
+  return nrows;
+}
+
+//! Read a complete dataset from a HDF5 file or group
+bool mpm::read_hdf5_dataset(hid_t location_id, const std::string& name,
+                            hid_t type, void* data) {
+  if (H5Lexists(location_id, name.c_str(), H5P_DEFAULT) <= 0) return false;
+
+  hid_t dataset_id = H5Dopen2(location_id, name.c_str(), H5P_DEFAULT);
+  if (dataset_id < 0) return false;
+  const bool status =
+      (H5Dread(dataset_id, type, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) >= 0);
+  H5Dclose(dataset_id);
+  return status;
+}
+
+//! Write columnar particle data to a file or group
+bool mpm::write_hdf5_particles(hid_t location_id,
+                               const HDF5ParticleColumns& columns,
+                               const HDF5Options& options) {
+  const hsize_t nparticles = columns.size();
+  const unsigned nvector = HDF5ParticleColumns::Nvector;
+  const unsigned ntensor = HDF5ParticleColumns::Ntensor;
+
+  // One dataset per field
+  return write_hdf5_dataset(location_id, "id", H5T_NATIVE_ULLONG, nparticles,
+                            1, columns.id.data(), options) &&
+         write_hdf5_dataset(location_id, "mass", H5T_NATIVE_DOUBLE, nparticles,
+                            1, columns.mass.data(), options) &&
+         write_hdf5_dataset(location_id, "coordinates", H5T_NATIVE_DOUBLE,
+                            nparticles, nvector, columns.coordinates.data(),
+                            options) &&
+         write_hdf5_dataset(location_id, "velocities", H5T_NATIVE_DOUBLE,
+                            nparticles, nvector, columns.velocities.data(),
+                            options) &&
+         write_hdf5_dataset(location_id, "stresses", H5T_NATIVE_DOUBLE,
+                            nparticles, ntensor, columns.stresses.data(),
+                            options) &&
+         write_hdf5_dataset(location_id, "strains", H5T_NATIVE_DOUBLE,
+                            nparticles, ntensor, columns.strains.data(),
+                            options) &&
+         write_hdf5_dataset(location_id, "volumetric_strains",
+                            H5T_NATIVE_DOUBLE, nparticles, 1,
+                            columns.volumetric_strains.data(), options) &&
+         write_hdf5_dataset(location_id, "status", H5T_NATIVE_UCHAR,
+                            nparticles, 1, columns.status.data(), options);
+}
+
+//! Read columnar particle data from a file or group
+bool mpm::read_hdf5_particles(hid_t location_id, hsize_t nparticles,
+                              HDF5ParticleColumns& columns) {
+  if (hdf5_dataset_rows(location_id, "id") != nparticles) return false;
+  columns.resize(nparticles);
+
+  return read_hdf5_dataset(location_id, "id", H5T_NATIVE_ULLONG,
+                           columns.id.data()) &&
+         read_hdf5_dataset(location_id, "mass", H5T_NATIVE_DOUBLE,
+                           columns.mass.data()) &&
+         read_hdf5_dataset(location_id, "coordinates", H5T_NATIVE_DOUBLE,
+                           columns.coordinates.data()) &&
+         read_hdf5_dataset(location_id, "velocities", H5T_NATIVE_DOUBLE,
+                           columns.velocities.data()) &&
+         read_hdf5_dataset(location_id, "stresses", H5T_NATIVE_DOUBLE,
+                           columns.stresses.data()) &&
+         read_hdf5_dataset(location_id, "strains", H5T_NATIVE_DOUBLE,
+                           columns.strains.data()) &&
+         read_hdf5_dataset(location_id, "volumetric_strains",
+                           H5T_NATIVE_DOUBLE,
+                           columns.volumetric_strains.data()) &&
+         read_hdf5_dataset(location_id, "status", H5T_NATIVE_UCHAR,
+                           columns.status.data());
+}
+
+//! Name of the group of an output step
+std::string mpm::hdf5_step_group(mpm::Index step) {
+  return "step" + std::to_string(step);
+}
+
+//! Append an output step to a time-series HDF5 file
+bool mpm::write_hdf5_time_series(const std::string& filename, mpm::Index step,
+                                 double time,
+                                 const HDF5ParticleColumns& columns,
+                                 const HDF5Options& options) {
+  // Open the time-series file or create it at the first output
+  hid_t file_id = -1;
+  if (std::ifstream(filename).good()) {
+    file_id = H5Fopen(filename.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+  } else {
+    // Space of deleted groups is tracked in the file and reused by the
+    // groups of later steps
+    hid_t plist_id = H5Pcreate(H5P_FILE_CREATE);
+    H5Pset_file_space_strategy(plist_id, H5F_FSPACE_STRATEGY_FSM_AGGR, 1, 1);
+    file_id =
+        H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, plist_id, H5P_DEFAULT);
+    H5Pclose(plist_id);
+  }
+  // Return if the file can't be opened
+  if (file_id < 0) return false;
+
+  // Replace the step of a previous run
+  const std::string group = hdf5_step_group(step);
+  if (H5Lexists(file_id, group.c_str(), H5P_DEFAULT) > 0)
+    H5Ldelete(file_id, group.c_str(), H5P_DEFAULT);
+
+  hid_t group_id = H5Gcreate2(file_id, group.c_str(), H5P_DEFAULT,
+                              H5P_DEFAULT, H5P_DEFAULT);
+  bool status = (group_id >= 0);
+  if (status) {
+    status =
+        write_hdf5_attribute(group_id, "step", H5T_NATIVE_ULLONG, &step) &&
+        write_hdf5_attribute(group_id, "time", H5T_NATIVE_DOUBLE, &time) &&
+        write_hdf5_particles(group_id, columns, options);
+    H5Gclose(group_id);
+  }
+  H5Fclose(file_id);
+  return status;
+}
+
+//! Return the output steps of a time-series HDF5 file
+std::vector<mpm::HDF5Step> mpm::hdf5_time_series(const std::string& filename) {
+  std::vector<HDF5Step> steps;
+  if (!std::ifstream(filename).good()) return steps;
+
+  hid_t file_id = H5Fopen(filename.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  if (file_id < 0) return steps;
+  H5Literate(file_id, H5_INDEX_NAME, H5_ITER_NATIVE, NULL, collect_hdf5_step,
+             &steps);
+  H5Fclose(file_id);
+
+  std::sort(steps.begin(), steps.end(),
+            [](const HDF5Step& lhs, const HDF5Step& rhs) {
+              return lhs.step < rhs.step;
+            });
+  return steps;
+}
+
+//! Delete the output steps after a step from a time-series HDF5 file
+std::vector<mpm::HDF5Step> mpm::truncate_hdf5_time_series(
+    const std::string& filename, mpm::Index step) {
+  auto steps = hdf5_time_series(filename);
+  const auto last = std::find_if(
+      steps.begin(), steps.end(),
+      [step](const HDF5Step& output) { return output.step > step; });
+  if (last == steps.end()) return steps;
+
+  hid_t file_id = H5Fopen(filename.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+  if (file_id < 0)
+    throw std::runtime_error("HDF5 file cannot be opened: " + filename);
+  for (auto itr = last; itr != steps.end(); ++itr)
+    H5Ldelete(file_id, itr->group.c_str(), H5P_DEFAULT);
+  H5Fclose(file_id);
+  steps.erase(last, steps.end());
+  return steps;
+}
+
+//! Write an XDMF index of a time-series HDF5 file
+bool mpm::write_xdmf(const std::string& filename, const std::string& hdf5_file,
+                     const std::vector<HDF5Step>& steps) {
+  std::ofstream xdmf(filename);
+  if (!xdmf.is_open()) return false;
+
+  xdmf << "<?xml version=\"1.0\" ?>\n"
+       << "<Xdmf Version=\"3.0\">\n"
+       << "  <Domain>\n"
+       << "    <Grid Name=\"particles\" GridType=\"Collection\" "
+       << "CollectionType=\"Temporal\">\n";
+  for (const auto& step : steps) write_xdmf_grid(xdmf, hdf5_file, step);
+  xdmf << xdmf_footer;
+  return xdmf.good();
+}
+
+//! Append an output step to an XDMF index of a time-series HDF5 file
+bool mpm::append_xdmf(const std::string& filename, const std::string& hdf5_file,
+                      const HDF5Step& step) {
+  std::fstream xdmf(filename,
+                    std::ios::in | std::ios::out | std::ios::binary);
+  // Index of the first step
+  if (!xdmf.is_open()) return write_xdmf(filename, hdf5_file, {step});
+
+  // Grid of the step replaces the closing elements, which are rewritten
+  // after it
+  xdmf.seekg(0, std::ios::end);
+  const std::streamoff size = xdmf.tellg();
+  const std::streamoff nfooter = xdmf_footer.size();
+  if (size < nfooter) return false;
+  std::string footer(nfooter, ' ');
+  xdmf.seekg(size - nfooter);
+  xdmf.read(&footer[0], nfooter);
+  if (footer != xdmf_footer) return false;
+
+  xdmf.seekp(size - nfooter);
+  write_xdmf_grid(xdmf, hdf5_file, step);
+  xdmf << xdmf_footer;
+  return xdmf.good();
+}
@@ -56,6 +56,14 @@ mpm::IO::IO(int argc, char** argv) {
   json_ = Json::parse(ifs);
 }
 
+//! Constructor with an input JSON object
+mpm::IO::IO(const std::string& working_dir, const std::string& analysis,
+            const Json& json)
+    : working_dir_(working_dir), json_(json), analysis_(analysis) {
+  //! Logger
+  console_ = spdlog::get("IO");
+}
+
 //! Return input file name of mesh/submesh/soil particles
 //! or an empty string if specified file for the key is not found
 std::string mpm::IO::file_name(const std::string& filename) {
@@ -100,7 +108,6 @@ boost::filesystem::path mpm::IO::output_file(const std::string& attribute,
                                              unsigned step,
                                              unsigned max_steps) {
   std::stringstream file_name;
-  std::string path = this->output_folder();
 
   file_name.str(std::string());
   file_name << attribute;
@@ -110,6 +117,24 @@ boost::filesystem::path mpm::IO::output_file(const std::string& attribute,
   file_name << step;
   file_name << file_extension;
 
+  boost::filesystem::path file_path(this->analysis_folder(analysis_id) +
+                                    file_name.str().c_str());
+  return file_path;
+}
+
+//! Create output file name of a time series (eg. particles.h5)
+boost::filesystem::path mpm::IO::output_file(const std::string& attribute,
+                                             const std::string& file_extension,
+                                             const std::string& analysis_id) {
+  boost::filesystem::path file_path(this->analysis_folder(analysis_id) +
+                                    attribute + file_extension);
+  return file_path;
+}
+
+//! Create and return the output folder of an analysis
+std::string mpm::IO::analysis_folder(const std::string& analysis_id) {
+  std::string path = this->output_folder();
+
   // Include path
   if (!path.empty()) path = working_dir_ + path;
 
@@ -122,8 +147,7 @@ boost::filesystem::path mpm::IO::output_file(const std::string& attribute,
   dir = path;
   if (!boost::filesystem::exists(dir)) boost::filesystem::create_directory(dir);
 
-  boost::filesystem::path file_path(path + file_name.str().c_str());
-  return file_path;
+  return path;
 }
 
 //! Return output folder
@@ -1,29 +1,87 @@
 #include "logger.h"
 
+#include <atomic>
+#include <map>
+#include <mutex>
+
+namespace {
+//! Entities share a logger per type
+std::atomic<bool> slim{false};
+}  // namespace
+
 // Create a logger for IO
 const std::shared_ptr<spdlog::logger> mpm::Logger::io_logger =
-    spdlog::stdout_color_st("IO");
+    spdlog::stdout_color_mt("IO");
 
 // Create a logger for reading mesh
 const std::shared_ptr<spdlog::logger> mpm::Logger::read_mesh =
-    spdlog::stdout_color_st("ReadMesh");
+    spdlog::stdout_color_mt("ReadMesh");
 
 // Create a logger for reading ascii mesh
 const std::shared_ptr<spdlog::logger> mpm::Logger::read_mesh_ascii =
-    spdlog::stdout_color_st("ReadMeshAscii");
+    spdlog::stdout_color_mt("ReadMeshAscii");
+
+// Create a logger for reading binary mesh
+const std::shared_ptr<spdlog::logger> mpm::Logger::read_mesh_binary =
+    spdlog::stdout_color_mt("ReadMeshBinary");
 
 // Create a logger for MPM
 const std::shared_ptr<spdlog::logger> mpm::Logger::mpm_logger =
-    spdlog::stdout_color_st("MPM");
+    spdlog::stdout_color_mt("MPM");
 
 // Create a logger for MPM Explicit
 const std::shared_ptr<spdlog::logger> mpm::Logger::mpm_explicit_logger =
-    spdlog::stdout_color_st("MPMExplicit");
+    spdlog::stdout_color_mt("MPMExplicit");
 
 // Create a logger for MPM Explicit USF
 const std::shared_ptr<spdlog::logger> mpm::Logger::mpm_explicit_usf_logger =
-    spdlog::stdout_color_st("MPMExplicitUSF");
+    spdlog::stdout_color_mt("MPMExplicitUSF");
 
 // Create a logger for MPM Explicit USL
 const std::shared_ptr<spdlog::logger> mpm::Logger::mpm_explicit_usl_logger =
-    spdlog::stdout_color_st("MPMExplicitUSL");
+    spdlog::stdout_color_mt("MPMExplicitUSL");
+
+// Create a logger for MPM Explicit DR
+const std::shared_ptr<spdlog::logger> mpm::Logger::mpm_explicit_dr_logger =
+    spdlog::stdout_color_mt("MPMExplicitDR");
+
+// Create a logger for MPM Implicit
+const std::shared_ptr<spdlog::logger> mpm::Logger::mpm_implicit_logger =
+    spdlog::stdout_color_mt("MPMImplicit");
+
+// Create a logger for MPM Ensemble
+const std::shared_ptr<spdlog::logger> mpm::Logger::mpm_ensemble_logger =
+    spdlog::stdout_color_mt("MPMEnsemble");
+
+//! Set if entities share a logger per type
+void mpm::Logger::slim_entities(bool slim_entities) { slim = slim_entities; }
+
+//! Return if entities share a logger per type
+bool mpm::Logger::slim_entities() { return slim; }
+
+//! Return a logger of a particle, node or cell
+std::shared_ptr<spdlog::logger> mpm::Logger::entity_logger(
+    const std::string& type, unsigned long long id) {
+  if (slim) {
+    static std::mutex mutex;
+    static std::map<std::string, std::shared_ptr<spdlog::logger>> loggers;
+    std::lock_guard<std::mutex> guard(mutex);
+    auto& logger = loggers[type];
+    if (!logger) logger = std::make_shared<spdlog::logger>(type, stdout_sink);
+    return logger;
+  }
+  return std::make_shared<spdlog::logger>(type + "::" + std::to_string(id),
+                                          stdout_sink);
+}
+
+//! Return the bytes of a logger owned by an entity
+std::size_t mpm::Logger::footprint(
+    const std::shared_ptr<spdlog::logger>& logger) {
+  if (logger == nullptr || logger.use_count() > 1) return 0;
+  // Logger and control block of make_shared, its name and list of sinks
+  std::size_t bytes = sizeof(spdlog::logger) + 2 * sizeof(long);
+  if (logger->name().capacity() >= sizeof(std::string))
+    bytes += logger->name().capacity() + 1;
+  bytes += logger->sinks().capacity() * sizeof(spdlog::sink_ptr);
+  return bytes;
+}
@@ -16,8 +16,9 @@ int main(int argc, char** argv) {
     // Create an IO object
     auto io = std::make_unique<mpm::IO>(argc, argv);
 
-    // Get analysis
-    const std::string analysis = io->analysis_type();
+    // Get analysis, over the concrete entity types of the input if a solver
+    // is registered for them
+    const std::string analysis = mpm::analysis_key(*io);
 
     // Create an MPM analysis
     auto mpm =
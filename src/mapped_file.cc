@@ -0,0 +1,38 @@
+#include "mapped_file.h"
+
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//! Map a file
+mpm::MappedFile::MappedFile(const std::string& filename) {
+  const int fd = open(filename.c_str(), O_RDONLY);
+  if (fd < 0) throw std::runtime_error("File is not found: " + filename);
+
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0) {
+    close(fd);
+    throw std::runtime_error("File cannot be read: " + filename);
+  }
+  size_ = file_stat.st_size;
+
+  // An empty file can't be mapped, it has no content
+  if (size_ > 0) {
+    void* data = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED) {
+      close(fd);
+      throw std::runtime_error("File cannot be mapped: " + filename);
+    }
+    data_ = static_cast<const char*>(data);
+  }
+  // The mapping stays valid after closing the file
+  close(fd);
+}
+
+//! Unmap the file
+mpm::MappedFile::~MappedFile() {
+  if (data_ != nullptr) munmap(const_cast<char*>(data_), size_);
+}
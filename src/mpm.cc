@@ -1,11 +1,24 @@
+#include <algorithm>
 #include <memory>
+#include <mutex>
+#include <string>
 
 #include "factory.h"
+#include "hexahedron_element.h"
 #include "io.h"
+#include "material/bingham.h"
+#include "material/linear_elastic.h"
 #include "mpm.h"
+#include "mpm_ensemble.h"
 #include "mpm_explicit.h"
+#include "mpm_explicit_dr.h"
 #include "mpm_explicit_usf.h"
 #include "mpm_explicit_usl.h"
+#include "mpm_implicit.h"
+#include "node.h"
+#include "particle.h"
+#include "quadrilateral_element.h"
+#include "step_kernels.h"
 
 // 2D Explicit MPM USF
 static Register<mpm::MPM, mpm::MPMExplicitUSF<2>, std::unique_ptr<mpm::IO>&&>
@@ -22,3 +35,138 @@ static Register<mpm::MPM, mpm::MPMExplicitUSL<2>, std::unique_ptr<mpm::IO>&&>
 // 3D Explicit MPM USL
 static Register<mpm::MPM, mpm::MPMExplicitUSL<3>, std::unique_ptr<mpm::IO>&&>
     mpm_explicit_usl_3d("MPMExplicitUSL3D");
+
+// 2D Explicit MPM with dynamic relaxation
+static Register<mpm::MPM, mpm::MPMExplicitDR<2>, std::unique_ptr<mpm::IO>&&>
+    mpm_explicit_dr_2d("MPMExplicitDR2D");
+
+// 3D Explicit MPM with dynamic relaxation
+static Register<mpm::MPM, mpm::MPMExplicitDR<3>, std::unique_ptr<mpm::IO>&&>
+    mpm_explicit_dr_3d("MPMExplicitDR3D");
+
+// 2D Implicit MPM
+static Register<mpm::MPM, mpm::MPMImplicit<2>, std::unique_ptr<mpm::IO>&&>
+    mpm_implicit_2d("MPMImplicit2D");
+
+// 3D Implicit MPM
+static Register<mpm::MPM, mpm::MPMImplicit<3>, std::unique_ptr<mpm::IO>&&>
+    mpm_implicit_3d("MPMImplicit3D");
+
+// 2D ensemble of analyses sharing a mesh
+static Register<mpm::MPM, mpm::MPMEnsemble<2>, std::unique_ptr<mpm::IO>&&>
+    mpm_ensemble_2d("MPMEnsemble2D");
+
+// 3D ensemble of analyses sharing a mesh
+static Register<mpm::MPM, mpm::MPMEnsemble<3>, std::unique_ptr<mpm::IO>&&>
+    mpm_ensemble_3d("MPMEnsemble3D");
+
+// Kernels over P2D particles, N2D nodes and ED2Q4 cells
+template <typename Tmaterial>
+using KernelsQ4 =
+    mpm::ConcreteKernels<2, mpm::Particle<2, 1>, mpm::Node<2, 2, 1>,
+                         mpm::QuadrilateralElement<2, 4>, Tmaterial>;
+
+// Kernels over P3D particles, N3D nodes and ED3H8 cells
+template <typename Tmaterial>
+using KernelsH8 =
+    mpm::ConcreteKernels<3, mpm::Particle<3, 1>, mpm::Node<3, 3, 1>,
+                         mpm::HexahedronElement<3, 8>, Tmaterial>;
+
+// 2D Explicit MPM USF over ED2Q4 cells and LinearElastic2D
+static Register<mpm::MPM,
+                mpm::MPMExplicitUSF<2, KernelsQ4<mpm::LinearElastic<2>>>,
+                std::unique_ptr<mpm::IO>&&>
+    mpm_explicit_usf_2d_q4_linear_elastic(
+        "MPMExplicitUSF2D/P2D/N2D/ED2Q4/LinearElastic2D");
+
+// 2D Explicit MPM USF over ED2Q4 cells and Bingham2D
+static Register<mpm::MPM, mpm::MPMExplicitUSF<2, KernelsQ4<mpm::Bingham<2>>>,
+                std::unique_ptr<mpm::IO>&&>
+    mpm_explicit_usf_2d_q4_bingham("MPMExplicitUSF2D/P2D/N2D/ED2Q4/Bingham2D");
+
+// 3D Explicit MPM USF over ED3H8 cells and LinearElastic3D
+static Register<mpm::MPM,
+                mpm::MPMExplicitUSF<3, KernelsH8<mpm::LinearElastic<3>>>,
+                std::unique_ptr<mpm::IO>&&>
+    mpm_explicit_usf_3d_h8_linear_elastic(
+        "MPMExplicitUSF3D/P3D/N3D/ED3H8/LinearElastic3D");
+
+// 3D Explicit MPM USF over ED3H8 cells and Bingham3D
+static Register<mpm::MPM, mpm::MPMExplicitUSF<3, KernelsH8<mpm::Bingham<3>>>,
+                std::unique_ptr<mpm::IO>&&>
+    mpm_explicit_usf_3d_h8_bingham("MPMExplicitUSF3D/P3D/N3D/ED3H8/Bingham3D");
+
+// 2D Explicit MPM USL over ED2Q4 cells and LinearElastic2D
+static Register<mpm::MPM,
+                mpm::MPMExplicitUSL<2, KernelsQ4<mpm::LinearElastic<2>>>,
+                std::unique_ptr<mpm::IO>&&>
+    mpm_explicit_usl_2d_q4_linear_elastic(
+        "MPMExplicitUSL2D/P2D/N2D/ED2Q4/LinearElastic2D");
+
+// 2D Explicit MPM USL over ED2Q4 cells and Bingham2D
+static Register<mpm::MPM, mpm::MPMExplicitUSL<2, KernelsQ4<mpm::Bingham<2>>>,
+                std::unique_ptr<mpm::IO>&&>
+    mpm_explicit_usl_2d_q4_bingham("MPMExplicitUSL2D/P2D/N2D/ED2Q4/Bingham2D");
+
+// 3D Explicit MPM USL over ED3H8 cells and LinearElastic3D
+static Register<mpm::MPM,
+                mpm::MPMExplicitUSL<3, KernelsH8<mpm::LinearElastic<3>>>,
+                std::unique_ptr<mpm::IO>&&>
+    mpm_explicit_usl_3d_h8_linear_elastic(
+        "MPMExplicitUSL3D/P3D/N3D/ED3H8/LinearElastic3D");
+
+// 3D Explicit MPM USL over ED3H8 cells and Bingham3D
+static Register<mpm::MPM, mpm::MPMExplicitUSL<3, KernelsH8<mpm::Bingham<3>>>,
+                std::unique_ptr<mpm::IO>&&>
+    mpm_explicit_usl_3d_h8_bingham("MPMExplicitUSL3D/P3D/N3D/ED3H8/Bingham3D");
+
+//! Return the key of an analysis in the factory of MPM solvers
+std::string mpm::analysis_key(const mpm::IO& io) {
+  const std::string analysis = io.analysis_type();
+  try {
+    // Static dispatch can be disabled in the analysis
+    const auto analysis_props = io.analysis();
+    if (analysis_props.find("static_dispatch") != analysis_props.end() &&
+        !analysis_props.at("static_dispatch").template get<bool>())
+      return analysis;
+
+    // Types of the entities of the mesh
+    const auto mesh_props = io.json_object("mesh");
+    const auto material_id =
+        mesh_props.at("material_id").template get<unsigned>();
+    std::string material_type;
+    for (const auto& material_props : io.json_object("materials"))
+      if (material_props.at("id").template get<unsigned>() == material_id)
+        material_type = material_props.at("type").template get<std::string>();
+
+    const std::string key =
+        analysis + "/" +
+        mesh_props.at("particle_type").template get<std::string>() + "/" +
+        mesh_props.at("node_type").template get<std::string>() + "/" +
+        mesh_props.at("cell_type").template get<std::string>() + "/" +
+        material_type;
+
+    const auto keys =
+        Factory<mpm::MPM, std::unique_ptr<mpm::IO>&&>::instance()->list();
+    if (std::find(keys.begin(), keys.end(), key) != keys.end()) return key;
+  } catch (std::exception&) {
+    // Incomplete inputs are reported by the solver
+  }
+  return analysis;
+}
+
+//! Create an analysis from an input JSON object
+std::shared_ptr<mpm::MPM> mpm::create_analysis(const std::string& analysis,
+                                               const Json& json,
+                                               const std::string& working_dir) {
+  auto io = std::make_unique<mpm::IO>(working_dir, analysis, json);
+  const std::string key = mpm::analysis_key(*io);
+  return Factory<mpm::MPM, std::unique_ptr<mpm::IO>&&>::instance()->create(
+      key, std::move(io));
+}
+
+//! Return the mutex which serialises the outputs of all analyses
+std::mutex& mpm::output_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
@@ -1,6 +1,8 @@
 #include "read_mesh.h"
 #include "factory.h"
 #include "read_mesh_ascii.h"
+#include "read_mesh_binary.h"
+#include "structured_mesh.h"
 
 // ReadMeshAscii
 static Register<mpm::ReadMesh<2>, mpm::ReadMeshAscii<2>> readmesh_ascii_2d(
@@ -9,3 +11,19 @@ static Register<mpm::ReadMesh<2>, mpm::ReadMeshAscii<2>> readmesh_ascii_2d(
 // ReadMeshAscii
 static Register<mpm::ReadMesh<3>, mpm::ReadMeshAscii<3>> readmesh_ascii_3d(
     "Ascii3D");
+
+// ReadMeshBinary
+static Register<mpm::ReadMesh<2>, mpm::ReadMeshBinary<2>> readmesh_binary_2d(
+    "Binary2D");
+
+// ReadMeshBinary
+static Register<mpm::ReadMesh<3>, mpm::ReadMeshBinary<3>> readmesh_binary_3d(
+    "Binary3D");
+
+// StructuredMesh
+static Register<mpm::ReadMesh<2>, mpm::StructuredMesh<2>> structured_mesh_2d(
+    "StructuredMesh2D");
+
+// StructuredMesh
+static Register<mpm::ReadMesh<3>, mpm::StructuredMesh<3>> structured_mesh_3d(
+    "StructuredMesh3D");
@@ -0,0 +1,36 @@
+#include "step_errors.h"
+
+//! Step errors of the scope of each thread
+thread_local mpm::StepErrors* mpm::StepErrors::current_ = nullptr;
+
+//! Return the default step errors of kernels called outside a scope
+mpm::StepErrors& mpm::StepErrors::instance() {
+  static StepErrors step_errors;
+  return step_errors;
+}
+
+//! Return the counters and reset them
+mpm::StepErrors::Counters mpm::StepErrors::collect() {
+  Counters total{};
+  for (unsigned i = 0; i < total.size(); ++i)
+    total[i] = counters_[i].exchange(0, std::memory_order_relaxed);
+  return total;
+}
+
+//! Return a description of a kind of failure
+std::string mpm::StepErrors::description(StepError error) {
+  switch (error) {
+    case StepError::NodalMass:
+      return "nodal mass is zero or below threshold";
+    case StepError::DegreesOfFreedom:
+      return "degrees of freedom don't match";
+    case StepError::ParticleCell:
+      return "particle cell is not initialised";
+    case StepError::ParticleMass:
+      return "particle mass or volume is not computed";
+    case StepError::ParticleMaterial:
+      return "particle material is invalid";
+    default:
+      return "unknown error";
+  }
+}
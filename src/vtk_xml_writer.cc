@@ -0,0 +1,146 @@
+#include "vtk_xml_writer.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace {
+//! Return the byte order of the machine as named by VTK
+const char* vtk_byte_order() {
+  const uint16_t word = 1;
+  return (*reinterpret_cast<const unsigned char*>(&word) == 1)
+             ? "LittleEndian"
+             : "BigEndian";
+}
+
+//! Write the XML header of a data array in the appended section
+void write_data_array(std::ofstream& file, const std::string& type,
+                      const std::string& name, unsigned ncomponents,
+                      uint64_t offset) {
+  file << "        <DataArray type=\"" << type << "\"";
+  if (!name.empty()) file << " Name=\"" << name << "\"";
+  file << " NumberOfComponents=\"" << ncomponents
+       << "\" format=\"appended\" offset=\"" << offset << "\"/>\n";
+}
+
+//! Write a block of the appended section, prefixed by its size in bytes
+void write_block(std::ofstream& file, const void* data, uint64_t nbytes) {
+  file.write(reinterpret_cast<const char*>(&nbytes), sizeof(nbytes));
+  file.write(static_cast<const char*>(data), nbytes);
+}
+
+//! Write a block of vertex cells generated in chunks, which are either the
+//! connectivity (i) or the offsets (i + 1) of point i
+void write_vertex_block(std::ofstream& file, std::size_t npoints,
+                        int64_t shift) {
+  const uint64_t nbytes = npoints * sizeof(int64_t);
+  file.write(reinterpret_cast<const char*>(&nbytes), sizeof(nbytes));
+
+  const std::size_t chunk_size = 4096;
+  std::vector<int64_t> chunk(std::min(npoints, chunk_size));
+  for (std::size_t begin = 0; begin < npoints; begin += chunk_size) {
+    const std::size_t end = std::min(npoints, begin + chunk_size);
+    for (std::size_t i = begin; i < end; ++i)
+      chunk[i - begin] = static_cast<int64_t>(i) + shift;
+    file.write(reinterpret_cast<const char*>(chunk.data()),
+               (end - begin) * sizeof(int64_t));
+  }
+}
+}  // namespace
+
+//! Constructor with coordinates
+mpm::VtkXmlWriter::VtkXmlWriter(std::size_t npoints, const double* coordinates)
+    : npoints_{npoints}, coordinates_{coordinates} {}
+
+//! Add a point data field of doubles
+void mpm::VtkXmlWriter::add_point_data(const std::string& name,
+                                       unsigned ncomponents,
+                                       const double* data) {
+  fields_.emplace_back(
+      DataArray{name, "Float64", ncomponents, data, sizeof(double)});
+}
+
+//! Add a point data field of unsigned 64-bit integers
+void mpm::VtkXmlWriter::add_point_data(const std::string& name,
+                                       unsigned ncomponents,
+                                       const unsigned long long* data) {
+  fields_.emplace_back(
+      DataArray{name, "UInt64", ncomponents, data, sizeof(unsigned long long)});
+}
+
+//! Add a point data field of unsigned 8-bit integers
+void mpm::VtkXmlWriter::add_point_data(const std::string& name,
+                                       unsigned ncomponents,
+                                       const unsigned char* data) {
+  fields_.emplace_back(
+      DataArray{name, "UInt8", ncomponents, data, sizeof(unsigned char)});
+}
+
+//! Write points as vertices and point data
+bool mpm::VtkXmlWriter::write(const std::string& filename) const {
+  // Format is chosen by the extension
+  const bool polydata = (filename.size() < 4 ||
+                         filename.compare(filename.size() - 4, 4, ".vtu") != 0);
+  const std::string dataset = polydata ? "PolyData" : "UnstructuredGrid";
+
+  std::ofstream file(filename, std::ios::out | std::ios::binary);
+  if (!file.is_open()) return false;
+
+  // Offsets of blocks in the appended section, each has a 64-bit size header
+  uint64_t offset = 0;
+  const uint64_t vertex_nbytes = sizeof(uint64_t) + npoints_ * sizeof(int64_t);
+
+  file << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"" << dataset << "\" version=\"1.0\" byte_order=\""
+       << vtk_byte_order() << "\" header_type=\"UInt64\">\n"
+       << "  <" << dataset << ">\n"
+       << "    <Piece NumberOfPoints=\"" << npoints_ << "\"";
+  if (polydata)
+    file << " NumberOfVerts=\"" << npoints_ << "\" NumberOfLines=\"0\""
+         << " NumberOfStrips=\"0\" NumberOfPolys=\"0\">\n";
+  else
+    file << " NumberOfCells=\"" << npoints_ << "\">\n";
+
+  // Point data
+  file << "      <PointData>\n";
+  for (const auto& field : fields_) {
+    write_data_array(file, field.type, field.name, field.ncomponents, offset);
+    offset += sizeof(uint64_t) + npoints_ * field.ncomponents * field.size;
+  }
+  file << "      </PointData>\n";
+
+  // Points
+  file << "      <Points>\n";
+  write_data_array(file, "Float64", "", 3, offset);
+  offset += sizeof(uint64_t) + npoints_ * 3 * sizeof(double);
+  file << "      </Points>\n";
+
+  // Each point is a vertex cell
+  const std::string cells = polydata ? "Verts" : "Cells";
+  file << "      <" << cells << ">\n";
+  write_data_array(file, "Int64", "connectivity", 1, offset);
+  offset += vertex_nbytes;
+  write_data_array(file, "Int64", "offsets", 1, offset);
+  offset += vertex_nbytes;
+  if (!polydata) write_data_array(file, "UInt8", "types", 1, offset);
+  file << "      </" << cells << ">\n"
+       << "    </Piece>\n"
+       << "  </" << dataset << ">\n"
+       << "  <AppendedData encoding=\"raw\">\n"
+       << "   _";
+
+  // Appended raw binary in the order of the headers
+  for (const auto& field : fields_)
+    write_block(file, field.data, npoints_ * field.ncomponents * field.size);
+  write_block(file, coordinates_, npoints_ * 3 * sizeof(double));
+  write_vertex_block(file, npoints_, 0);
+  write_vertex_block(file, npoints_, 1);
+  if (!polydata) {
+    // VTK_VERTEX
+    const std::vector<unsigned char> types(npoints_, 1);
+    write_block(file, types.data(), npoints_);
+  }
+
+  file << "\n  </AppendedData>\n"
+       << "</VTKFile>\n";
+  return file.good();
+}
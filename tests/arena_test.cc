@@ -0,0 +1,85 @@
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "catch.hpp"
+
+#include "arena.h"
+#include "factory.h"
+#include "mesh.h"
+#include "node.h"
+
+//! \brief Check arena and arena allocator
+TEST_CASE("Arena is checked", "[arena]") {
+  SECTION("Allocations are aligned and placed in slabs") {
+    mpm::Arena arena(1024);
+    REQUIRE(arena.nslabs() == 0);
+    REQUIRE(arena.reserved() == 0);
+
+    void* first = arena.allocate(3, 1);
+    void* second = arena.allocate(64, 32);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(second) % 32 == 0);
+    REQUIRE(static_cast<char*>(second) >= static_cast<char*>(first) + 3);
+    REQUIRE(arena.nslabs() == 1);
+    REQUIRE(arena.allocated() == 67);
+
+    // A full slab is followed by a new slab
+    for (unsigned i = 0; i < 16; ++i) arena.allocate(128, 8);
+    REQUIRE(arena.nslabs() > 1);
+    REQUIRE(arena.reserved() >= arena.allocated());
+
+    // An object larger than a slab gets a slab of its own
+    void* large = arena.allocate(4096, 64);
+    REQUIRE(large != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(large) % 64 == 0);
+    REQUIRE(arena.reserved() >= 16 * 128 + 4096);
+  }
+
+  SECTION("Shared objects keep their arena alive") {
+    auto arena = std::make_shared<mpm::Arena>();
+    std::shared_ptr<Eigen::Vector4d> vector = std::allocate_shared<
+        Eigen::Vector4d>(mpm::ArenaAllocator<Eigen::Vector4d>(arena), 1., 2.,
+                         3., 4.);
+    REQUIRE(arena->allocated() >= sizeof(Eigen::Vector4d));
+
+    std::weak_ptr<mpm::Arena> weak_arena = arena;
+    arena.reset();
+    // The control block of the object holds the arena
+    REQUIRE(weak_arena.expired() == false);
+    REQUIRE((*vector)(3) == Approx(4.).epsilon(1.E-12));
+
+    vector.reset();
+    REQUIRE(weak_arena.expired() == true);
+  }
+
+  SECTION("Factory creates objects in an arena") {
+    auto arena = std::make_shared<mpm::Arena>();
+    const Eigen::Vector3d coords(1., 2., 3.);
+
+    std::vector<std::shared_ptr<mpm::NodeBase<3>>> nodes;
+    for (mpm::Index id = 0; id < 10; ++id)
+      nodes.emplace_back(
+          Factory<mpm::NodeBase<3>, mpm::Index,
+                  const Eigen::Matrix<double, 3, 1>&>::instance()
+              ->create("N3D", arena, std::move(id), coords));
+
+    REQUIRE(arena->allocated() >= 10 * sizeof(mpm::Node<3, 3, 1>));
+    for (mpm::Index id = 0; id < 10; ++id) {
+      REQUIRE(nodes.at(id)->id() == id);
+      REQUIRE(nodes.at(id)->coordinates()(2) == Approx(3.).epsilon(1.E-12));
+    }
+  }
+
+  SECTION("Mesh creates nodes in its arena") {
+    auto mesh = std::make_unique<mpm::Mesh<2>>(0);
+    std::vector<Eigen::Vector2d> coordinates(4, Eigen::Vector2d::Zero());
+    REQUIRE(mesh->create_nodes(0, "N2D", coordinates) == true);
+    REQUIRE(mesh->nnodes() == 4);
+    REQUIRE(mesh->arena()->allocated() >= 4 * sizeof(mpm::Node<2, 2, 1>));
+
+    std::weak_ptr<mpm::Arena> arena = mesh->arena();
+    mesh.reset();
+    REQUIRE(arena.expired() == true);
+  }
+}
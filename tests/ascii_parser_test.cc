@@ -0,0 +1,81 @@
+#include <string>
+
+#include "catch.hpp"
+
+#include "ascii_parser.h"
+
+// Check ASCII parser
+TEST_CASE("ASCII parser is checked", "[ascii][parser]") {
+  // Tolerance
+  const double Tolerance = 1.E-15;
+
+  SECTION("Check parse doubles") {
+    const std::string text = "  0.5\t-1.25e-3 +3 1E2 0.000123456789 "
+                             "1.2345678901234567890 abc";
+    const char* current = text.data();
+    const char* end = text.data() + text.size();
+    double value;
+    REQUIRE(mpm::ascii::parse_double(current, end, value) == true);
+    REQUIRE(value == Approx(0.5).epsilon(Tolerance));
+    REQUIRE(mpm::ascii::parse_double(current, end, value) == true);
+    REQUIRE(value == Approx(-1.25e-3).epsilon(Tolerance));
+    REQUIRE(mpm::ascii::parse_double(current, end, value) == true);
+    REQUIRE(value == Approx(3.).epsilon(Tolerance));
+    REQUIRE(mpm::ascii::parse_double(current, end, value) == true);
+    REQUIRE(value == Approx(100.).epsilon(Tolerance));
+    REQUIRE(mpm::ascii::parse_double(current, end, value) == true);
+    REQUIRE(value == 0.000123456789);
+    // More than 15 significant digits fall back to strtod
+    REQUIRE(mpm::ascii::parse_double(current, end, value) == true);
+    REQUIRE(value == 1.2345678901234567890);
+    // Not a number
+    REQUIRE(mpm::ascii::parse_double(current, end, value) == false);
+    // End of line
+    REQUIRE(mpm::ascii::parse_double(current, end, value) == false);
+  }
+
+  SECTION("Check parse indices") {
+    const std::string text = "0 12\t345 1.0 -1";
+    const char* current = text.data();
+    const char* end = text.data() + text.size();
+    mpm::Index value;
+    REQUIRE(mpm::ascii::parse_index(current, end, value) == true);
+    REQUIRE(value == 0);
+    REQUIRE(mpm::ascii::parse_index(current, end, value) == true);
+    REQUIRE(value == 12);
+    REQUIRE(mpm::ascii::parse_index(current, end, value) == true);
+    REQUIRE(value == 345);
+    REQUIRE(mpm::ascii::parse_index(current, end, value) == true);
+    REQUIRE(value == 1);
+    REQUIRE(mpm::ascii::parse_index(current, end, value) == false);
+    REQUIRE(mpm::ascii::parse_index(current, end, value) == false);
+  }
+
+  SECTION("Check data lines") {
+    const std::string text =
+        "! comment\n2 1\r\n\n   \n0. 0.\n# comment\n1. 0.\n0 1 2 3";
+    const auto lines = mpm::ascii::data_lines(text.data(), text.size());
+    REQUIRE(lines.size() == 4);
+    REQUIRE(std::string(lines.at(0).begin, lines.at(0).end) == "2 1\r");
+    REQUIRE(std::string(lines.at(1).begin, lines.at(1).end) == "0. 0.");
+    REQUIRE(std::string(lines.at(3).begin, lines.at(3).end) == "0 1 2 3");
+
+    // Lines spanning chunks of the parallel split are kept whole
+    std::string large;
+    const unsigned nlines = 200000;
+    for (unsigned i = 0; i < nlines; ++i)
+      large += std::to_string(i) + " 0.125 0.25\n";
+    const auto large_lines = mpm::ascii::data_lines(large.data(), large.size());
+    REQUIRE(large_lines.size() == nlines);
+    for (unsigned i = 0; i < nlines; i += 997) {
+      const char* current = large_lines.at(i).begin;
+      mpm::Index value;
+      REQUIRE(mpm::ascii::parse_index(current, large_lines.at(i).end, value) ==
+              true);
+      REQUIRE(value == i);
+    }
+
+    // Empty text
+    REQUIRE(mpm::ascii::data_lines(text.data(), 0).empty());
+  }
+}
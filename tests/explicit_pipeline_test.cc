@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "catch.hpp"
+#include "json.hpp"
+using Json = nlohmann::json;
+
+#include "explicit_pipeline.h"
+#include "particle.h"
+
+//! \brief Check explicit pipeline of stages
+TEST_CASE("Explicit pipeline is checked", "[pipeline]") {
+  // Dimension
+  const unsigned Dim = 2;
+  using ParticlePtr = std::shared_ptr<mpm::ParticleBase<Dim>>;
+
+  // Particles which fused stages iterate over
+  std::vector<ParticlePtr> particles;
+  for (mpm::Index id = 0; id < 3; ++id)
+    particles.emplace_back(
+        std::make_shared<mpm::Particle<Dim, 1>>(id, Eigen::Vector2d::Zero()));
+
+  // Log of the operations which are run
+  std::vector<std::string> log;
+
+  // Stage which doesn't only iterate over particles
+  std::map<std::string, mpm::ExplicitStage<Dim>> stages;
+  stages["nodes"] = {"nodes", [&log]() { log.emplace_back("nodes"); }, {}};
+
+  // Stages which iterate over particles
+  for (const std::string name : {"strain", "stress", "forces"}) {
+    const auto kernel = [&log, name](const ParticlePtr& particle) {
+      log.emplace_back(name + std::to_string(particle->id()));
+    };
+    const auto run = [&particles, kernel]() {
+      for (const auto& particle : particles) kernel(particle);
+    };
+    stages[name] = {name, run, {kernel}};
+  }
+
+  const auto iterate =
+      [&particles](
+          const typename mpm::ExplicitStage<Dim>::ParticleKernel& kernel) {
+        for (const auto& particle : particles) kernel(particle);
+      };
+
+  // Names of the stages which are done
+  std::vector<std::string> done;
+  const auto timer = [&done](const std::string& stage, double seconds) {
+    done.emplace_back(stage);
+  };
+
+  mpm::ExplicitPipeline<Dim> pipeline(
+      stages, {"nodes", "strain", "stress", "forces"}, iterate);
+
+  SECTION("Stages run in order") {
+    const std::vector<std::string> names{"nodes", "strain", "stress",
+                                         "forces"};
+    REQUIRE(pipeline.names() == names);
+    pipeline.run(timer);
+    REQUIRE(done == pipeline.names());
+    REQUIRE(log.size() == 10);
+    REQUIRE(log.at(0) == "nodes");
+    REQUIRE(log.at(1) == "strain0");
+    REQUIRE(log.at(3) == "strain2");
+    REQUIRE(log.at(4) == "stress0");
+  }
+
+  SECTION("Stages are reordered and skipped") {
+    const auto config = Json::parse(
+        R"({"order": ["forces", "nodes", "strain"], "skip": ["nodes"]})");
+    pipeline.configure(config);
+    const std::vector<std::string> names{"forces", "strain"};
+    REQUIRE(pipeline.names() == names);
+    pipeline.run(timer);
+    REQUIRE(log.size() == 6);
+    REQUIRE(log.at(0) == "forces0");
+  }
+
+  SECTION("Particle stages are fused into a single loop") {
+    const auto config =
+        Json::parse(R"({"fuse": [["strain", "stress", "forces"]]})");
+    pipeline.configure(config);
+    const std::vector<std::string> names{"nodes", "strain+stress+forces"};
+    REQUIRE(pipeline.names() == names);
+    pipeline.run(timer);
+    REQUIRE(done == pipeline.names());
+    // Kernels are run in order on each particle
+    REQUIRE(log.size() == 10);
+    REQUIRE(log.at(1) == "strain0");
+    REQUIRE(log.at(2) == "stress0");
+    REQUIRE(log.at(3) == "forces0");
+    REQUIRE(log.at(4) == "strain1");
+  }
+
+  SECTION("Invalid stages are rejected") {
+    REQUIRE_THROWS_AS(pipeline.configure(Json::parse(R"({"order": ["mass"]})")),
+                      std::domain_error&);
+    REQUIRE_THROWS_AS(pipeline.configure(Json::parse(R"({"skip": ["mass"]})")),
+                      std::domain_error&);
+    // Stages which don't only iterate over particles
+    REQUIRE_THROWS_AS(
+        pipeline.configure(Json::parse(R"({"fuse": [["nodes", "strain"]]})")),
+        std::domain_error&);
+    // Stages which aren't consecutive
+    REQUIRE_THROWS_AS(
+        pipeline.configure(Json::parse(R"({"fuse": [["strain", "forces"]]})")),
+        std::domain_error&);
+  }
+
+  SECTION("Stages run in a flow graph by their access") {
+    using Access = mpm::StageAccess;
+    // Nodes accumulated by stages, which may run concurrently
+    std::atomic<unsigned> accumulated{0};
+    unsigned accumulated_before_update = 0;
+    const auto accumulate = [&accumulated]() { ++accumulated; };
+    const auto kernel = [](const ParticlePtr& particle) {};
+    std::map<std::string, mpm::ExplicitStage<Dim>> graph_stages;
+    graph_stages["body_force"] = {"body_force",
+                                  accumulate,
+                                  {kernel},
+                                  {{"particles", Access::Read},
+                                   {"nodes", Access::Accumulate}}};
+    graph_stages["internal_force"] = {"internal_force",
+                                      accumulate,
+                                      {kernel},
+                                      {{"particles", Access::Read},
+                                       {"nodes", Access::Accumulate}}};
+    graph_stages["output"] = {
+        "output", []() {}, {}, {{"particles", Access::Read}}};
+    graph_stages["update_nodes"] = {
+        "update_nodes",
+        [&accumulated, &accumulated_before_update]() {
+          accumulated_before_update = accumulated;
+        },
+        {},
+        {{"nodes", Access::Write}}};
+
+    mpm::ExplicitPipeline<Dim> graph(
+        graph_stages,
+        {"body_force", "internal_force", "output", "update_nodes"}, iterate);
+
+    // Accumulations and reads of the same state don't wait for each other
+    REQUIRE(graph.dependencies("body_force").empty());
+    REQUIRE(graph.dependencies("internal_force").empty());
+    REQUIRE(graph.dependencies("output").empty());
+    // A write waits for the accumulations of the state
+    const std::vector<std::string> forces{"body_force", "internal_force"};
+    REQUIRE(graph.dependencies("update_nodes") == forces);
+
+    for (unsigned step = 0; step < 3; ++step) graph.run(timer);
+    REQUIRE(done.size() == 12);
+    // Stages of a step finish before the next step, and the write of each
+    // step after the accumulations it depends on
+    for (unsigned step = 0; step < 3; ++step) {
+      const auto begin = done.begin() + step * 4;
+      const auto end = begin + 4;
+      const auto position = [begin, end](const std::string& stage) {
+        return std::find(begin, end, stage) - begin;
+      };
+      REQUIRE(position("update_nodes") < 4);
+      REQUIRE(position("output") < 4);
+      REQUIRE(position("update_nodes") > position("body_force"));
+      REQUIRE(position("update_nodes") > position("internal_force"));
+    }
+    REQUIRE(accumulated == 6);
+    REQUIRE(accumulated_before_update == 6);
+
+    // Stages run in order without the graph
+    done.clear();
+    graph.configure(Json::parse(R"({"graph": false})"));
+    graph.run(timer);
+    const std::vector<std::string> order{"body_force", "internal_force",
+                                         "output", "update_nodes"};
+    REQUIRE(done == order);
+
+    // Fused stages access the union of the states of their stages
+    graph.configure(
+        Json::parse(R"({"fuse": [["body_force", "internal_force"]]})"));
+    REQUIRE(graph.dependencies("output").empty());
+    const std::vector<std::string> fused{"body_force+internal_force"};
+    REQUIRE(graph.dependencies("update_nodes") == fused);
+  }
+}
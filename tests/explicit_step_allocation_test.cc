@@ -0,0 +1,124 @@
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+
+#include "catch.hpp"
+
+//! Alias for JSON
+#include "json.hpp"
+using Json = nlohmann::json;
+
+#include "mpm_explicit_usf.h"
+#include "write_mesh_particles.h"
+
+// Allocations are counted by replacing malloc, which also catches Eigen, so
+// this test is built as its own executable instead of a part of mpmtest
+namespace {
+//! Count allocations of all threads, as the stages of a step run in the
+//! threads of the TBB pool
+std::atomic<bool> counting{false};
+//! Number of heap allocations of all threads while counting
+std::atomic<std::size_t> allocations{0};
+
+//! Count the heap allocations of all threads in a scope
+class AllocationCounter {
+ public:
+  AllocationCounter() {
+    allocations = 0;
+    counting = true;
+  }
+  ~AllocationCounter() { counting = false; }
+
+  //! Return the number of allocations in the scope so far
+  std::size_t nallocations() const { return allocations; }
+};
+}  // namespace
+
+#if defined(__GLIBC__)
+//! Count allocations by interposing malloc
+extern "C" {
+void* __libc_malloc(std::size_t size);
+void* malloc(std::size_t size) noexcept {
+  if (counting.load(std::memory_order_relaxed))
+    allocations.fetch_add(1, std::memory_order_relaxed);
+  return __libc_malloc(size);
+}
+}
+#else
+//! Count allocations made through the global operator new
+void* operator new(std::size_t size) {
+  if (counting.load(std::memory_order_relaxed))
+    allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size)) return ptr;
+  throw std::bad_alloc();
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+#endif
+
+//! Return the number of heap allocations of a steady-state step of an
+//! explicit (USF) analysis, which runs all stages of its step
+//! \tparam Tdim Dimension
+template <unsigned Tdim>
+std::size_t step_allocations() {
+  // Write JSON file, mesh and particles
+  const std::string fname = "mpm-explicit-allocation";
+  const std::string dimension = std::to_string(Tdim) + "d";
+  REQUIRE(mpm_test::write_json(Tdim, false, fname) == true);
+  if (Tdim == 2) {
+    REQUIRE(mpm_test::write_mesh_2d() == true);
+    REQUIRE(mpm_test::write_particles_2d() == true);
+  } else {
+    REQUIRE(mpm_test::write_mesh_3d() == true);
+    REQUIRE(mpm_test::write_particles_3d() == true);
+  }
+
+  // Outputs are only written at the first step
+  const std::string input_file = fname + "-" + dimension + ".json";
+  std::ifstream input(input_file);
+  Json json;
+  input >> json;
+  input.close();
+  json["post_processing"]["output_steps"] = 1000;
+  std::ofstream output(input_file);
+  output << json.dump(2);
+  output.close();
+
+  // Assign argc and argv to input arguments of MPM
+  int argc = 7;
+  std::string analysis = "MPMExplicitUSF" + std::to_string(Tdim) + "D";
+  std::string input_argument = input_file;
+  // clang-format off
+  char* argv[] = {(char*)"./mpm",
+                  (char*)"-a",  &analysis[0],
+                  (char*)"-f",  (char*)"./",
+                  (char*)"-i",  &input_argument[0]};
+  // clang-format on
+  auto io = std::make_unique<mpm::IO>(argc, argv);
+  auto mpm = std::make_unique<mpm::MPMExplicitUSF<Tdim>>(std::move(io));
+  REQUIRE(mpm->initialise() == true);
+
+  // The first steps size the buffers, and the outputs of the first step are
+  // written before the counted step
+  REQUIRE(mpm->advance(2) == 2);
+  mpm->finalise();
+
+  mpm::Index nadvanced = 0;
+  std::size_t nallocations = 0;
+  {
+    AllocationCounter counter;
+    nadvanced = mpm->advance(1);
+    nallocations = counter.nallocations();
+  }
+  REQUIRE(nadvanced == 1);
+  mpm->finalise();
+  return nallocations;
+}
+
+//! \brief Check that a steady-state explicit step doesn't allocate
+TEST_CASE("Explicit step is free of heap allocations", "[allocation]") {
+  SECTION("Check 2D step") { REQUIRE(step_allocations<2>() == 0); }
+
+  SECTION("Check 3D step") { REQUIRE(step_allocations<3>() == 0); }
+}
@@ -0,0 +1,71 @@
+#include <memory>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "catch.hpp"
+
+#include "cell.h"
+#include "element.h"
+#include "factory.h"
+#include "logger.h"
+#include "mesh.h"
+#include "node.h"
+#include "particle.h"
+
+//! \brief Check memory footprint of particles, nodes, cells and meshes
+TEST_CASE("Memory footprint is checked", "[footprint]") {
+  // Dimension
+  const unsigned Dim = 2;
+  const Eigen::Vector2d coords(0.5, 0.5);
+  std::shared_ptr<mpm::Element<Dim>> element =
+      Factory<mpm::Element<Dim>>::instance()->create("ED2Q4");
+
+  SECTION("Entities own their loggers") {
+    mpm::Logger::slim_entities(false);
+    mpm::Particle<Dim, 1> particle(0, coords);
+    mpm::Node<Dim, Dim, 1> node(0, coords);
+    mpm::Cell<Dim> cell(0, 4, element);
+
+    REQUIRE(particle.footprint() > sizeof(mpm::Particle<Dim, 1>));
+    REQUIRE(node.footprint() > sizeof(mpm::Node<Dim, Dim, 1>));
+    REQUIRE(cell.footprint() > sizeof(mpm::Cell<Dim>));
+
+    // A velocity constraint is stored on the heap
+    const std::size_t bytes = node.footprint();
+    REQUIRE(node.assign_velocity_constraint(0, 1.) == true);
+    REQUIRE(node.footprint() > bytes);
+  }
+
+  SECTION("Slim entities share loggers") {
+    mpm::Logger::slim_entities(false);
+    const std::size_t bytes = mpm::Particle<Dim, 1>(0, coords).footprint();
+
+    mpm::Logger::slim_entities(true);
+    REQUIRE(mpm::Logger::slim_entities() == true);
+    mpm::Particle<Dim, 1> first(0, coords);
+    mpm::Particle<Dim, 1> second(1, coords);
+    mpm::Node<Dim, Dim, 1> node(0, coords);
+    mpm::Logger::slim_entities(false);
+
+    REQUIRE(first.footprint() == second.footprint());
+    REQUIRE(first.footprint() < bytes);
+    REQUIRE(node.footprint() == sizeof(mpm::Node<Dim, Dim, 1>));
+  }
+
+  SECTION("Mesh reports its entities") {
+    mpm::Logger::slim_entities(false);
+    auto mesh = std::make_shared<mpm::Mesh<Dim>>(0);
+    std::vector<Eigen::Vector2d> coordinates(4, coords);
+    REQUIRE(mesh->create_nodes(0, "N2D", coordinates) == true);
+
+    const auto footprint = mesh->footprint();
+    REQUIRE(footprint.nparticles == 0);
+    REQUIRE(footprint.particles == 0);
+    REQUIRE(footprint.nnodes == 4);
+    REQUIRE(footprint.nodes > 4 * sizeof(mpm::Node<Dim, Dim, 1>));
+    REQUIRE(footprint.ncells == 0);
+    REQUIRE(footprint.cells == 0);
+    REQUIRE(footprint.arena_reserved >= footprint.arena_allocated);
+    REQUIRE(footprint.total() >= footprint.nodes);
+  }
+}
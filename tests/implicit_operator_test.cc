@@ -0,0 +1,163 @@
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include "Eigen/Dense"
+#include "catch.hpp"
+
+#include "cell.h"
+#include "element.h"
+#include "factory.h"
+#include "implicit_operator.h"
+#include "material/material.h"
+#include "mesh.h"
+
+//! \brief Check the implicit operator of a mesh of two cells
+TEST_CASE("Implicit operator is checked for 2D case",
+          "[ImplicitOperator][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Phase
+  const unsigned phase = 0;
+  // Coefficient of the nodal mass, 1 / (beta dt^2)
+  const double mass_coefficient = 1.E+6;
+
+  auto mesh = std::make_unique<mpm::Mesh<Dim>>(0);
+
+  // Nodes of two cells
+  std::vector<Eigen::Matrix<double, Dim, 1>> coordinates(6);
+  coordinates[0] << 0., 0.;
+  coordinates[1] << 0.5, 0.;
+  coordinates[2] << 0.5, 0.5;
+  coordinates[3] << 0., 0.5;
+  coordinates[4] << 1.0, 0.;
+  coordinates[5] << 1.0, 0.5;
+  REQUIRE(mesh->create_nodes(0, "N2D", coordinates) == true);
+  std::shared_ptr<mpm::Element<Dim>> element =
+      Factory<mpm::Element<Dim>>::instance()->create("ED2Q4");
+  REQUIRE(mesh->create_cells(0, element, {{0, 1, 2, 3}, {1, 4, 5, 2}}) ==
+          true);
+
+  // Particles at the quadrature points of the cells
+  std::vector<Eigen::Matrix<double, Dim, 1>> particles;
+  const double offset = 0.25 / std::sqrt(3.);
+  for (const double xcentre : {0.25, 0.75})
+    for (unsigned i = 0; i < 4; ++i) {
+      Eigen::Matrix<double, Dim, 1> particle;
+      particle << xcentre + ((i % 2) ? offset : -offset),
+          0.25 + ((i / 2) ? offset : -offset);
+      particles.emplace_back(particle);
+    }
+  REQUIRE(mesh->create_particles(0, "P2D", particles) == true);
+  REQUIRE(mesh->locate_particles_mesh().empty() == true);
+
+  // Material
+  unsigned mid = 0;
+  auto material = Factory<mpm::Material<Dim>, unsigned>::instance()->create(
+      "LinearElastic2D", std::move(mid));
+  Json jmaterial;
+  jmaterial["density"] = 1000.;
+  jmaterial["youngs_modulus"] = 1.0E+7;
+  jmaterial["poisson_ratio"] = 0.3;
+  material->properties(jmaterial);
+
+  // Mass of the particles mapped to the active nodes
+  mesh->iterate_over_nodes(
+      [](const std::shared_ptr<mpm::NodeBase<Dim>>& node) {
+        node->initialise();
+      });
+  mesh->iterate_over_cells(
+      std::bind(&mpm::Cell<Dim>::activate_nodes, std::placeholders::_1));
+  mesh->iterate_over_particles(
+      [&material](const std::shared_ptr<mpm::ParticleBase<Dim>>& particle) {
+        particle->assign_material(material);
+        particle->compute_shapefn();
+        particle->compute_volume();
+        particle->compute_mass(phase);
+        particle->map_mass_momentum_to_nodes(phase);
+      });
+
+  mpm::ImplicitOperator<Dim> implicit;
+  implicit.assemble(*mesh, phase, mass_coefficient);
+  const unsigned ndofs = implicit.ndofs();
+  REQUIRE(ndofs == 12);
+
+  // Matrix of the operator, assembled from the products with unit vectors
+  Eigen::MatrixXd matrix(ndofs, ndofs);
+  for (unsigned i = 0; i < ndofs; ++i)
+    matrix.col(i) = implicit.apply(Eigen::VectorXd::Unit(ndofs, i));
+
+  // Known solution
+  Eigen::VectorXd solution(ndofs);
+  for (unsigned i = 0; i < ndofs; ++i) solution(i) = std::sin(1. + i);
+  const Eigen::VectorXd rhs = matrix * solution;
+
+  SECTION("Check symmetry of the operator") {
+    Eigen::VectorXd x(ndofs), y(ndofs);
+    for (unsigned i = 0; i < ndofs; ++i) {
+      x(i) = std::cos(0.5 * i);
+      y(i) = 1. - 0.1 * i * i;
+    }
+    REQUIRE(x.dot(implicit.apply(y)) ==
+            Approx(y.dot(implicit.apply(x))).epsilon(1.E-12));
+    REQUIRE((matrix - matrix.transpose()).norm() <=
+            1.E-12 * matrix.norm());
+    // Diagonal of the preconditioner
+    REQUIRE((implicit.diagonal() - matrix.diagonal()).norm() <=
+            1.E-12 * matrix.norm());
+    // Mass term of the operator
+    REQUIRE(Eigen::VectorXd::Ones(ndofs).dot(
+                implicit.apply(Eigen::VectorXd::Ones(ndofs))) ==
+            Approx(Dim * mass_coefficient * 8 * 1000. * 0.0625)
+                .epsilon(1.E-9));
+  }
+
+  SECTION("Check solve without constraints") {
+    REQUIRE(implicit.free().sum() == Approx(ndofs));
+    Eigen::VectorXd x = Eigen::VectorXd::Zero(ndofs);
+    REQUIRE(implicit.solve(rhs, x, 1.E-12, 100) == true);
+    REQUIRE(implicit.iterations() > 0);
+    REQUIRE(implicit.iterations() <= ndofs);
+    REQUIRE((x - solution).norm() <= 1.E-9 * solution.norm());
+  }
+
+  SECTION("Check solve with constrained degrees of freedom") {
+    // Base of the mesh is fixed vertically and a corner horizontally
+    const std::vector<std::tuple<mpm::Index, unsigned, double>> constraints{
+        {0, 0, 0.}, {0, 1, 0.}, {1, 1, 0.}, {4, 1, 0.}};
+    REQUIRE(mesh->assign_velocity_constraints(constraints) == true);
+    implicit.assemble(*mesh, phase, mass_coefficient);
+    REQUIRE(implicit.free().sum() == Approx(ndofs - 4));
+
+    // Constrained degrees of freedom are prescribed by the initial guess
+    const Eigen::VectorXd free = implicit.free();
+    Eigen::VectorXd x = (Eigen::VectorXd::Ones(ndofs) - free)
+                            .cwiseProduct(solution);
+    REQUIRE(implicit.solve(rhs, x, 1.E-12, 100) == true);
+    REQUIRE((x - solution).norm() <= 1.E-9 * solution.norm());
+
+    // Solution of the free degrees of freedom of the assembled system
+    std::vector<unsigned> free_dofs, fixed_dofs;
+    for (unsigned i = 0; i < ndofs; ++i)
+      (free(i) > 0.5 ? free_dofs : fixed_dofs).emplace_back(i);
+    const unsigned nfree = free_dofs.size();
+    Eigen::MatrixXd reduced(nfree, nfree);
+    Eigen::VectorXd reduced_rhs(nfree);
+    for (unsigned i = 0; i < nfree; ++i) {
+      reduced_rhs(i) = rhs(free_dofs[i]);
+      for (unsigned j = 0; j < nfree; ++j)
+        reduced(i, j) = matrix(free_dofs[i], free_dofs[j]);
+      for (const auto fixed : fixed_dofs)
+        reduced_rhs(i) -= matrix(free_dofs[i], fixed) * solution(fixed);
+    }
+    const Eigen::VectorXd reduced_solution = reduced.ldlt().solve(reduced_rhs);
+    for (unsigned i = 0; i < nfree; ++i)
+      REQUIRE(x(free_dofs[i]) ==
+              Approx(reduced_solution(i)).epsilon(1.E-9).margin(1.E-12));
+    // Constrained degrees of freedom keep their values
+    for (const auto fixed : fixed_dofs)
+      REQUIRE(x(fixed) == Approx(solution(fixed)).epsilon(1.E-12));
+  }
+}
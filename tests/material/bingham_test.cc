@@ -1,3 +1,4 @@
+#include <cmath>
 #include <limits>
 #include <vector>
 
@@ -70,6 +71,11 @@ TEST_CASE("Bingham is checked in 2D", "[material][bingham][2D]") {
     // Get material properties
     REQUIRE(material->property("density") ==
             Approx(jmaterial["density"]).epsilon(Tolerance));
+
+    // Speed of a compression wave from the bulk modulus
+    const double K = 8333333.333333333;
+    REQUIRE(material->wave_speed() ==
+            Approx(std::sqrt(K / 1000.)).epsilon(Tolerance));
   }
 
   SECTION("Bingham check stresses with no strain rate") {
@@ -419,6 +425,11 @@ TEST_CASE("Bingham is checked in 3D", "[material][bingham][3D]") {
     // Get material properties
     REQUIRE(material->property("density") ==
             Approx(jmaterial["density"]).epsilon(Tolerance));
+
+    // Speed of a compression wave from the bulk modulus
+    const double K = 8333333.333333333;
+    REQUIRE(material->wave_speed() ==
+            Approx(std::sqrt(K / 1000.)).epsilon(Tolerance));
   }
 
   SECTION("Bingham check stresses with no strain rate") {
@@ -1,3 +1,4 @@
+#include <cmath>
 #include <limits>
 
 #include "Eigen/Dense"
@@ -113,6 +114,10 @@ TEST_CASE("LinearElastic is checked in 2D", "[material][linear_elastic][2D]") {
     REQUIRE(de(5, 3) == Approx(0.).epsilon(Tolerance));
     REQUIRE(de(5, 4) == Approx(0.).epsilon(Tolerance));
     REQUIRE(de(5, 5) == Approx(G).epsilon(Tolerance));
+
+    // Speed of a compression wave
+    REQUIRE(material->wave_speed() ==
+            Approx(std::sqrt(a1 / 1000.)).epsilon(Tolerance));
   }
 
   SECTION("LinearElastic check stresses") {
@@ -312,6 +317,10 @@ TEST_CASE("LinearElastic is checked in 3D", "[material][linear_elastic][3D]") {
     REQUIRE(de(5, 3) == Approx(0.).epsilon(Tolerance));
     REQUIRE(de(5, 4) == Approx(0.).epsilon(Tolerance));
     REQUIRE(de(5, 5) == Approx(G).epsilon(Tolerance));
+
+    // Speed of a compression wave
+    REQUIRE(material->wave_speed() ==
+            Approx(std::sqrt(a1 / 1000.)).epsilon(Tolerance));
   }
 
   SECTION("LinearElastic check stresses") {
@@ -1,3 +1,6 @@
+#include <cstdio>
+#include <fstream>
+#include <iterator>
 #include <limits>
 #include <memory>
 
@@ -476,6 +479,43 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
         mesh->create_cells(gcid, element, cells);
         REQUIRE(mesh->ncells() == ncells);
 
+        SECTION("Generate particles at quadrature points") {
+          // Particle type 2D
+          const std::string particle_type = "P2D";
+          // Invalid number of quadratures
+          REQUIRE(mesh->generate_particles(0, particle_type, 4) == false);
+          REQUIRE(mesh->nparticles() == 0);
+
+          // No cells in the box
+          Eigen::Matrix<double, Dim, 1> box_min, box_max;
+          box_min.fill(2.);
+          box_max.fill(3.);
+          REQUIRE(mesh->generate_particles(0, particle_type, 1, box_min,
+                                           box_max) == false);
+          REQUIRE(mesh->nparticles() == 0);
+
+          // Generate particles in the cell whose centroid lies in the box
+          box_min.fill(0.);
+          box_max << 0.5, 1.0;
+          REQUIRE(mesh->generate_particles(0, particle_type, 3, box_min,
+                                           box_max) == true);
+          REQUIRE(mesh->nparticles() == 9);
+
+          // Generate particles in all cells
+          REQUIRE(mesh->generate_particles(100, particle_type, 2) == true);
+          REQUIRE(mesh->nparticles() == 17);
+
+          // Particles are in cells and their volumes sum to the cell volumes
+          double volume = 0.;
+          mesh->iterate_over_particles(
+              [&volume](std::shared_ptr<mpm::ParticleBase<Dim>> particle) {
+                REQUIRE(particle->cell_id() !=
+                        std::numeric_limits<mpm::Index>::max());
+                volume += particle->volume();
+              });
+          REQUIRE(volume == Approx(0.75).epsilon(Tolerance));
+        }
+
         SECTION("Check creation of particles") {
           // Vector of particle coordinates
           std::vector<Eigen::Matrix<double, Dim, 1>> coordinates;
@@ -565,9 +605,137 @@ TEST_CASE("Mesh is checked for 2D case", "[mesh][2D]") {
               REQUIRE(particles.size() == 0);
             }
 
+            // Test binary checkpoint
+            SECTION("Write and restore binary checkpoint") {
+              REQUIRE(mesh->locate_particles_mesh().size() == 0);
+
+              // Snapshot particle state
+              std::vector<mpm::CheckpointParticle> particles;
+              mesh->particles_checkpoint(particles);
+              REQUIRE(particles.size() == mesh->nparticles());
+              REQUIRE(particles.at(0).cell_id == 0);
+              REQUIRE(particles.at(0).material_id ==
+                      mpm::CheckpointUndefinedMaterial);
+
+              const auto header =
+                  mpm::checkpoint_header(Dim, particles.size(), 10, 0.1);
+              REQUIRE(mpm::write_checkpoint("checkpoint-2d.bin", header,
+                                            particles) == true);
+              REQUIRE(mpm::write_checkpoint("invalid-folder/checkpoint.bin",
+                                            header, particles) == false);
+
+              // Map checkpoint
+              const mpm::MappedCheckpoint checkpoint("checkpoint-2d.bin");
+              REQUIRE(checkpoint.header().dimension == Dim);
+              REQUIRE(checkpoint.header().step == 10);
+              REQUIRE(checkpoint.header().time ==
+                      Approx(0.1).epsilon(1.E-12));
+              REQUIRE(checkpoint.nparticles() == mesh->nparticles());
+              REQUIRE(checkpoint.particles()[1].id == particles.at(1).id);
+              REQUIRE_THROWS(mpm::MappedCheckpoint("checkpoint-missing.bin"));
+
+              // Restore particles without locating them
+              const std::map<unsigned, std::shared_ptr<mpm::Material<Dim>>>
+                  materials;
+              REQUIRE(mesh->restore_particles_checkpoint(
+                          checkpoint.particles(), checkpoint.nparticles(),
+                          materials) == true);
+              const auto coordinates = mesh->particle_coordinates();
+              for (unsigned i = 0; i < mesh->nparticles(); ++i)
+                for (unsigned j = 0; j < Dim; ++j)
+                  REQUIRE(coordinates.at(i)(j) ==
+                          Approx(particles.at(i).coordinates[j])
+                              .epsilon(1.E-12));
+              // Number of particles has to match
+              REQUIRE_THROWS(mesh->restore_particles_checkpoint(
+                  checkpoint.particles(), checkpoint.nparticles() - 1,
+                  materials));
+              // Particles are created from a checkpoint in a mesh without
+              // particles
+              REQUIRE_THROWS(mesh->create_particles_checkpoint(
+                  "P2D", checkpoint.particles(), checkpoint.nparticles(),
+                  materials));
+            }
+
             // Test HDF5
             SECTION("Write particles HDF5") {
               REQUIRE(mesh->write_particles_hdf5(0, "particles-2d.h5") == true);
+
+              // Snapshot particles to a buffer and write the buffer
+              std::vector<mpm::HDF5Particle> particle_data;
+              mesh->particles_hdf5(0, particle_data);
+              REQUIRE(particle_data.size() == mesh->nparticles());
+              REQUIRE(mpm::Mesh<Dim>::write_particles_hdf5(
+                          "particles-2d.h5", particle_data) == true);
+              // Read particles table
+              REQUIRE(mesh->read_particles_hdf5(0, "particles-2d.h5") ==
+                      true);
+
+              // Columnar, chunked and compressed output
+              mpm::HDF5Options options;
+              options.columnar = true;
+              options.chunk_size = 2;
+              options.compression = 4;
+              options.shuffle = true;
+              mpm::HDF5ParticleColumns columns;
+              mesh->particles_hdf5(0, columns);
+              REQUIRE(columns.size() == mesh->nparticles());
+              REQUIRE(columns.coordinates.size() == 3 * mesh->nparticles());
+              REQUIRE(columns.stresses.size() == 6 * mesh->nparticles());
+              REQUIRE(mpm::Mesh<Dim>::write_particles_hdf5(
+                          "particles-columns-2d.h5", columns, options) ==
+                      true);
+              // Read particles columns
+              REQUIRE(mesh->read_particles_hdf5(
+                          0, "particles-columns-2d.h5") == true);
+              REQUIRE(mesh->particle_coordinates().at(0)(0) ==
+                      Approx(columns.coordinates.at(0)).epsilon(1.E-12));
+
+              // Time series of steps in a single file
+              const std::string series = "particles-series-2d.h5";
+              std::remove(series.c_str());
+              REQUIRE(mpm::write_hdf5_time_series(series, 10, 0.1, columns,
+                                                  options) == true);
+              REQUIRE(mpm::write_hdf5_time_series(series, 0, 0.0, columns,
+                                                  options) == true);
+              // Rewrite a step
+              REQUIRE(mpm::write_hdf5_time_series(series, 10, 0.1, columns,
+                                                  options) == true);
+              const auto steps = mpm::hdf5_time_series(series);
+              REQUIRE(steps.size() == 2);
+              REQUIRE(steps.at(0).step == 0);
+              REQUIRE(steps.at(1).step == 10);
+              REQUIRE(steps.at(1).group == mpm::hdf5_step_group(10));
+              REQUIRE(steps.at(1).time == Approx(0.1).epsilon(1.E-12));
+              REQUIRE(steps.at(1).nparticles == mesh->nparticles());
+              REQUIRE(mpm::write_xdmf("particles-series-2d.xdmf", series,
+                                      steps) == true);
+              // Read particles of a step
+              REQUIRE(mesh->read_particles_hdf5(
+                          0, series, mpm::hdf5_step_group(10)) == true);
+              REQUIRE_THROWS(mesh->read_particles_hdf5(
+                  0, series, mpm::hdf5_step_group(5)));
+
+              // Append a step to the index without rewriting it
+              const std::string xdmf = "particles-series-2d.xdmf";
+              REQUIRE(mpm::append_xdmf(xdmf, series, steps.at(1)) == true);
+              std::ifstream index(xdmf);
+              const std::string contents(
+                  (std::istreambuf_iterator<char>(index)),
+                  std::istreambuf_iterator<char>());
+              std::size_t ngrids = 0;
+              for (auto pos = contents.find("GridType=\"Uniform\"");
+                   pos != std::string::npos;
+                   pos = contents.find("GridType=\"Uniform\"", pos + 1))
+                ++ngrids;
+              REQUIRE(ngrids == 3);
+              REQUIRE(contents.substr(contents.size() - 8) == "</Xdmf>\n");
+
+              // Delete steps after a resumed step
+              const auto kept = mpm::truncate_hdf5_time_series(series, 5);
+              REQUIRE(kept.size() == 1);
+              REQUIRE(kept.at(0).step == 0);
+              REQUIRE(mpm::hdf5_time_series(series).size() == 1);
             }
           }
         }
@@ -1058,6 +1226,43 @@ TEST_CASE("Mesh is checked for 3D case", "[mesh][3D]") {
         mesh->create_cells(gcid, element, cells);
         REQUIRE(mesh->ncells() == ncells);
 
+        SECTION("Generate particles at quadrature points") {
+          // Particle type 3D
+          const std::string particle_type = "P3D";
+          // Invalid number of quadratures
+          REQUIRE(mesh->generate_particles(0, particle_type, 4) == false);
+          REQUIRE(mesh->nparticles() == 0);
+
+          // No cells in the box
+          Eigen::Matrix<double, Dim, 1> box_min, box_max;
+          box_min.fill(2.);
+          box_max.fill(3.);
+          REQUIRE(mesh->generate_particles(0, particle_type, 1, box_min,
+                                           box_max) == false);
+          REQUIRE(mesh->nparticles() == 0);
+
+          // Generate particles in the cell whose centroid lies in the box
+          box_min.fill(0.);
+          box_max << 0.5, 1.0, 1.0;
+          REQUIRE(mesh->generate_particles(0, particle_type, 3, box_min,
+                                           box_max) == true);
+          REQUIRE(mesh->nparticles() == 27);
+
+          // Generate particles in all cells
+          REQUIRE(mesh->generate_particles(100, particle_type, 2) == true);
+          REQUIRE(mesh->nparticles() == 43);
+
+          // Particles are in cells and their volumes sum to the cell volumes
+          double volume = 0.;
+          mesh->iterate_over_particles(
+              [&volume](std::shared_ptr<mpm::ParticleBase<Dim>> particle) {
+                REQUIRE(particle->cell_id() !=
+                        std::numeric_limits<mpm::Index>::max());
+                volume += particle->volume();
+              });
+          REQUIRE(volume == Approx(0.375).epsilon(Tolerance));
+        }
+
         SECTION("Check creation of particles") {
           // Vector of particle coordinates
           std::vector<Eigen::Matrix<double, Dim, 1>> coordinates;
@@ -1168,9 +1373,137 @@ TEST_CASE("Mesh is checked for 3D case", "[mesh][3D]") {
               // Should miss particle100
               REQUIRE(particles.size() == 0);
             }
+            // Test binary checkpoint
+            SECTION("Write and restore binary checkpoint") {
+              REQUIRE(mesh->locate_particles_mesh().size() == 0);
+
+              // Snapshot particle state
+              std::vector<mpm::CheckpointParticle> particles;
+              mesh->particles_checkpoint(particles);
+              REQUIRE(particles.size() == mesh->nparticles());
+              REQUIRE(particles.at(0).cell_id == 0);
+              REQUIRE(particles.at(0).material_id ==
+                      mpm::CheckpointUndefinedMaterial);
+
+              const auto header =
+                  mpm::checkpoint_header(Dim, particles.size(), 10, 0.1);
+              REQUIRE(mpm::write_checkpoint("checkpoint-3d.bin", header,
+                                            particles) == true);
+              REQUIRE(mpm::write_checkpoint("invalid-folder/checkpoint.bin",
+                                            header, particles) == false);
+
+              // Map checkpoint
+              const mpm::MappedCheckpoint checkpoint("checkpoint-3d.bin");
+              REQUIRE(checkpoint.header().dimension == Dim);
+              REQUIRE(checkpoint.header().step == 10);
+              REQUIRE(checkpoint.header().time ==
+                      Approx(0.1).epsilon(1.E-12));
+              REQUIRE(checkpoint.nparticles() == mesh->nparticles());
+              REQUIRE(checkpoint.particles()[1].id == particles.at(1).id);
+              REQUIRE_THROWS(mpm::MappedCheckpoint("checkpoint-missing.bin"));
+
+              // Restore particles without locating them
+              const std::map<unsigned, std::shared_ptr<mpm::Material<Dim>>>
+                  materials;
+              REQUIRE(mesh->restore_particles_checkpoint(
+                          checkpoint.particles(), checkpoint.nparticles(),
+                          materials) == true);
+              const auto coordinates = mesh->particle_coordinates();
+              for (unsigned i = 0; i < mesh->nparticles(); ++i)
+                for (unsigned j = 0; j < Dim; ++j)
+                  REQUIRE(coordinates.at(i)(j) ==
+                          Approx(particles.at(i).coordinates[j])
+                              .epsilon(1.E-12));
+              // Number of particles has to match
+              REQUIRE_THROWS(mesh->restore_particles_checkpoint(
+                  checkpoint.particles(), checkpoint.nparticles() - 1,
+                  materials));
+              // Particles are created from a checkpoint in a mesh without
+              // particles
+              REQUIRE_THROWS(mesh->create_particles_checkpoint(
+                  "P3D", checkpoint.particles(), checkpoint.nparticles(),
+                  materials));
+            }
+
             // Test HDF5
             SECTION("Write particles HDF5") {
               REQUIRE(mesh->write_particles_hdf5(0, "particles-3d.h5") == true);
+
+              // Snapshot particles to a buffer and write the buffer
+              std::vector<mpm::HDF5Particle> particle_data;
+              mesh->particles_hdf5(0, particle_data);
+              REQUIRE(particle_data.size() == mesh->nparticles());
+              REQUIRE(mpm::Mesh<Dim>::write_particles_hdf5(
+                          "particles-3d.h5", particle_data) == true);
+              // Read particles table
+              REQUIRE(mesh->read_particles_hdf5(0, "particles-3d.h5") ==
+                      true);
+
+              // Columnar, chunked and compressed output
+              mpm::HDF5Options options;
+              options.columnar = true;
+              options.chunk_size = 2;
+              options.compression = 4;
+              options.shuffle = true;
+              mpm::HDF5ParticleColumns columns;
+              mesh->particles_hdf5(0, columns);
+              REQUIRE(columns.size() == mesh->nparticles());
+              REQUIRE(columns.coordinates.size() == 3 * mesh->nparticles());
+              REQUIRE(columns.stresses.size() == 6 * mesh->nparticles());
+              REQUIRE(mpm::Mesh<Dim>::write_particles_hdf5(
+                          "particles-columns-3d.h5", columns, options) ==
+                      true);
+              // Read particles columns
+              REQUIRE(mesh->read_particles_hdf5(
+                          0, "particles-columns-3d.h5") == true);
+              REQUIRE(mesh->particle_coordinates().at(0)(0) ==
+                      Approx(columns.coordinates.at(0)).epsilon(1.E-12));
+
+              // Time series of steps in a single file
+              const std::string series = "particles-series-3d.h5";
+              std::remove(series.c_str());
+              REQUIRE(mpm::write_hdf5_time_series(series, 10, 0.1, columns,
+                                                  options) == true);
+              REQUIRE(mpm::write_hdf5_time_series(series, 0, 0.0, columns,
+                                                  options) == true);
+              // Rewrite a step
+              REQUIRE(mpm::write_hdf5_time_series(series, 10, 0.1, columns,
+                                                  options) == true);
+              const auto steps = mpm::hdf5_time_series(series);
+              REQUIRE(steps.size() == 2);
+              REQUIRE(steps.at(0).step == 0);
+              REQUIRE(steps.at(1).step == 10);
+              REQUIRE(steps.at(1).group == mpm::hdf5_step_group(10));
+              REQUIRE(steps.at(1).time == Approx(0.1).epsilon(1.E-12));
+              REQUIRE(steps.at(1).nparticles == mesh->nparticles());
+              REQUIRE(mpm::write_xdmf("particles-series-3d.xdmf", series,
+                                      steps) == true);
+              // Read particles of a step
+              REQUIRE(mesh->read_particles_hdf5(
+                          0, series, mpm::hdf5_step_group(10)) == true);
+              REQUIRE_THROWS(mesh->read_particles_hdf5(
+                  0, series, mpm::hdf5_step_group(5)));
+
+              // Append a step to the index without rewriting it
+              const std::string xdmf = "particles-series-3d.xdmf";
+              REQUIRE(mpm::append_xdmf(xdmf, series, steps.at(1)) == true);
+              std::ifstream index(xdmf);
+              const std::string contents(
+                  (std::istreambuf_iterator<char>(index)),
+                  std::istreambuf_iterator<char>());
+              std::size_t ngrids = 0;
+              for (auto pos = contents.find("GridType=\"Uniform\"");
+                   pos != std::string::npos;
+                   pos = contents.find("GridType=\"Uniform\"", pos + 1))
+                ++ngrids;
+              REQUIRE(ngrids == 3);
+              REQUIRE(contents.substr(contents.size() - 8) == "</Xdmf>\n");
+
+              // Delete steps after a resumed step
+              const auto kept = mpm::truncate_hdf5_time_series(series, 5);
+              REQUIRE(kept.size() == 1);
+              REQUIRE(kept.at(0).step == 0);
+              REQUIRE(mpm::hdf5_time_series(series).size() == 1);
             }
           }
         }
@@ -0,0 +1,131 @@
+#include <fstream>
+
+#include "catch.hpp"
+
+//! Alias for JSON
+#include "json.hpp"
+using Json = nlohmann::json;
+
+#include "mpm_ensemble.h"
+#include "write_mesh_particles.h"
+
+// Check MPM Ensemble
+TEST_CASE("MPM 2D Ensemble implementation is checked",
+          "[MPM][2D][Ensemble][1Phase]") {
+  // Dimension
+  const unsigned Dim = 2;
+
+  // Write JSON file
+  const std::string fname = "mpm-ensemble";
+  const bool resume = false;
+  bool status = mpm_test::write_json(2, resume, fname);
+  REQUIRE(status == true);
+
+  // Write Mesh
+  bool mesh_status = mpm_test::write_mesh_2d();
+  REQUIRE(mesh_status == true);
+
+  // Write Particles
+  bool particle_status = mpm_test::write_particles_2d();
+  REQUIRE(particle_status == true);
+
+  // Variants of the density and stiffness of the material of the particles
+  std::ifstream input("mpm-ensemble-2d.json");
+  Json json = Json::parse(input);
+  input.close();
+  Json density, stiffness;
+  density["materials"] = Json::array({{{"id", 1}, {"density", 1150.}}});
+  stiffness["materials"] =
+      Json::array({{{"id", 1}, {"youngs_modulus", 3.0E+6}}});
+  json["analysis"]["ensemble"]["analysis"] = "MPMExplicitUSF2D";
+  json["analysis"]["ensemble"]["variants"] =
+      Json::array({Json::object(), density, stiffness});
+  std::ofstream output("mpm-ensemble-2d.json");
+  output << json.dump(2);
+  output.close();
+
+  // Assign argc and argv to input arguments of MPM
+  int argc = 7;
+  // clang-format off
+  char* argv[] = {(char*)"./mpm",
+                  (char*)"-a",  (char*)"MPMEnsemble2D",
+                  (char*)"-f",  (char*)"./",
+                  (char*)"-i",  (char*)"mpm-ensemble-2d.json"};
+  // clang-format on
+
+  SECTION("Check solver") {
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Run an ensemble of explicit MPM
+    auto mpm = std::make_unique<mpm::MPMEnsemble<Dim>>(std::move(io));
+    REQUIRE(mpm->nvariants() == 3);
+    // Solve
+    REQUIRE(mpm->solve() == true);
+    for (unsigned i = 0; i < mpm->nvariants(); ++i) {
+      REQUIRE(mpm->variant_status(i) == true);
+      REQUIRE(mpm->variant(i).time() == Approx(10 * 0.001).epsilon(1.E-9));
+      // Variants create their own particles from the shared mesh input
+      REQUIRE(mpm->variant(i).nparticles() == mpm->variant(0).nparticles());
+    }
+    REQUIRE(mpm->variant(0).nparticles() > 0);
+    // Kinetic energy is proportional to the density of the variant
+    REQUIRE(mpm->variant(1).diagnostics().kinetic_energy ==
+            Approx(0.5 * mpm->variant(0).diagnostics().kinetic_energy)
+                .epsilon(1.E-6));
+  }
+}
+
+// Check MPM Ensemble
+TEST_CASE("MPM 3D Ensemble implementation is checked",
+          "[MPM][3D][Ensemble][1Phase]") {
+  // Dimension
+  const unsigned Dim = 3;
+
+  // Write JSON file
+  const std::string fname = "mpm-ensemble";
+  const bool resume = false;
+  bool status = mpm_test::write_json(3, resume, fname);
+  REQUIRE(status == true);
+
+  // Write Mesh
+  bool mesh_status = mpm_test::write_mesh_3d();
+  REQUIRE(mesh_status == true);
+
+  // Write Particles
+  bool particle_status = mpm_test::write_particles_3d();
+  REQUIRE(particle_status == true);
+
+  // Variants of the stiffness of the material of the particles
+  std::ifstream input("mpm-ensemble-3d.json");
+  Json json = Json::parse(input);
+  input.close();
+  Json soft, stiff;
+  soft["materials"] = Json::array({{{"id", 1}, {"youngs_modulus", 1.0E+6}}});
+  stiff["materials"] = Json::array({{{"id", 1}, {"youngs_modulus", 2.0E+6}}});
+  json["analysis"]["ensemble"]["analysis"] = "MPMExplicitUSL3D";
+  json["analysis"]["ensemble"]["variants"] = Json::array({soft, stiff});
+  std::ofstream output("mpm-ensemble-3d.json");
+  output << json.dump(2);
+  output.close();
+
+  // Assign argc and argv to input arguments of MPM
+  int argc = 7;
+  // clang-format off
+  char* argv[] = {(char*)"./mpm",
+                  (char*)"-a",  (char*)"MPMEnsemble3D",
+                  (char*)"-f",  (char*)"./",
+                  (char*)"-i",  (char*)"mpm-ensemble-3d.json"};
+  // clang-format on
+
+  SECTION("Check solver") {
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Run an ensemble of explicit MPM
+    auto mpm = std::make_unique<mpm::MPMEnsemble<Dim>>(std::move(io));
+    REQUIRE(mpm->nvariants() == 2);
+    // Solve
+    REQUIRE(mpm->solve() == true);
+    for (unsigned i = 0; i < mpm->nvariants(); ++i)
+      REQUIRE(mpm->variant_status(i) == true);
+  }
+}
@@ -0,0 +1,179 @@
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <boost/filesystem.hpp>
+
+#include "catch.hpp"
+
+//! Alias for JSON
+#include "json.hpp"
+using Json = nlohmann::json;
+
+#include "mpm_explicit_dr.h"
+#include "mpm_explicit_usf.h"
+#include "write_mesh_particles.h"
+
+// Check MPM Explicit dynamic relaxation
+TEST_CASE("MPM 2D Explicit dynamic relaxation is checked",
+          "[MPM][2D][Explicit][DR][1Phase]") {
+  // Dimension
+  const unsigned Dim = 2;
+
+  // Write JSON file
+  const std::string fname = "mpm-explicit-dr";
+  bool resume = false;
+  bool status = mpm_test::write_json(2, resume, fname);
+  REQUIRE(status == true);
+
+  // Write Mesh
+  bool mesh_status = mpm_test::write_mesh_2d();
+  REQUIRE(mesh_status == true);
+
+  // Write Particles
+  bool particle_status = mpm_test::write_particles_2d();
+  REQUIRE(particle_status == true);
+
+  // Assign argc and argv to input arguments of MPM
+  int argc = 7;
+  // clang-format off
+  char* argv[] = {(char*)"./mpm",
+                  (char*)"-a",  (char*)"MPMExplicitDR2D",
+                  (char*)"-f",  (char*)"./",
+                  (char*)"-i",  (char*)"mpm-explicit-dr-2d.json"};
+  // clang-format on
+
+  // Base of the mesh is fixed vertically and a corner horizontally
+  std::ofstream constraints("velocity-constraints-dr.txt");
+  constraints << "0\t0\t0\n0\t1\t0\n1\t1\t0\n4\t1\t0\n";
+  constraints.close();
+
+  std::ifstream input("mpm-explicit-dr-2d.json");
+  Json json = Json::parse(input);
+  input.close();
+  json["input_files"]["velocity_constraints"] = "velocity-constraints-dr.txt";
+  json["analysis"]["nsteps"] = 10000;
+  json["post_processing"]["output_steps"] = 10000;
+
+  // Tolerance of the out-of-balance force ratio
+  const double tolerance = 1.E-6;
+  // Density of the material of the mesh
+  const double density = 2300.;
+  // Vertical gravity
+  const double gravity = -9.81;
+
+  // Check the static solution, in which the virtual work of the stresses of
+  // particles of equal volumes balances the gravity at each height: sum of
+  // stress_yy = density * g * sum of y
+  const auto check_static_solution = [=](mpm::MPMExplicitDR<Dim>* mpm) {
+    REQUIRE(mpm->equilibrium() == true);
+    REQUIRE(mpm->unbalanced_force_ratio() < tolerance);
+    REQUIRE(mpm->step() < 10000);
+
+    const auto coordinates = mpm->particles_field("coordinates");
+    const auto stresses = mpm->particles_field("stress");
+    REQUIRE(coordinates.size() == 8);
+    double stress = 0., height = 0.;
+    for (unsigned i = 0; i < coordinates.size(); ++i) {
+      stress += stresses[i](1);
+      height += coordinates[i](1);
+    }
+    REQUIRE(stress < 0.);
+    REQUIRE(stress == Approx(density * gravity * height).epsilon(1.E-4));
+  };
+
+  SECTION("Check equilibrium and resume from its checkpoint") {
+    json["analysis"]["dynamic_relaxation"] = {{"damping", "kinetic"},
+                                              {"tolerance", tolerance}};
+    std::ofstream output("mpm-explicit-dr-2d.json");
+    output << json.dump(2);
+    output.close();
+
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Run dynamic relaxation
+    auto mpm = std::make_unique<mpm::MPMExplicitDR<Dim>>(std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == true);
+    check_static_solution(mpm.get());
+
+    // Checkpoint of the last step
+    const mpm::Index step = mpm->step() - 1;
+    std::ostringstream checkpoint;
+    checkpoint << "checkpoint" << std::setfill('0') << std::setw(5) << step
+               << ".bin";
+    REQUIRE(boost::filesystem::exists("results/mpm-explicit-dr-2d/" +
+                                      checkpoint.str()) == true);
+
+    // Resume a USF analysis with a different number of steps from the
+    // equilibrium checkpoint, whose particles aren't read from the input,
+    // without writing checkpoints of its own
+    json["input_files"]["particles"] = "particles-missing.txt";
+    json["analysis"]["nsteps"] = step + 12;
+    json["analysis"]["resume"] = {{"resume", true},
+                                  {"uuid", "mpm-explicit-dr-2d"},
+                                  {"step", step},
+                                  {"checkpoint", checkpoint.str()}};
+    json["post_processing"]["checkpoint"] = false;
+    output.open("mpm-explicit-dr-usf-2d.json");
+    output << json.dump(2);
+    output.close();
+
+    // clang-format off
+    char* argv_resume[] = {(char*)"./mpm",
+                           (char*)"-a",  (char*)"MPMExplicitUSF2D",
+                           (char*)"-f",  (char*)"./",
+                           (char*)"-i",  (char*)"mpm-explicit-dr-usf-2d.json"};
+    // clang-format on
+    io = std::make_unique<mpm::IO>(argc, argv_resume);
+    auto usf = std::make_unique<mpm::MPMExplicitUSF<Dim>>(std::move(io));
+    REQUIRE(usf->initialise() == true);
+    REQUIRE(usf->nparticles() == 8);
+    REQUIRE(usf->step() == step + 1);
+    // Particles are created in the stress state of the checkpoint
+    const auto stresses = mpm->particles_field("stress");
+    const auto resumed_stresses = usf->particles_field("stress");
+    for (unsigned i = 0; i < stresses.size(); ++i)
+      REQUIRE((resumed_stresses[i] - stresses[i]).norm() <=
+              1.E-12 * stresses[i].norm());
+    REQUIRE(usf->advance(12) == 11);
+    usf->finalise();
+    // The checkpoint is at rest at the start of the analysis
+    REQUIRE(usf->time() == Approx(11 * 0.001).epsilon(1.E-9));
+  }
+
+  SECTION("Check equilibrium with viscous damping") {
+    json["analysis"]["dynamic_relaxation"] = {{"damping", "viscous"},
+                                              {"damping_coefficient", 200.},
+                                              {"tolerance", tolerance}};
+    std::ofstream output("mpm-explicit-dr-2d.json");
+    output << json.dump(2);
+    output.close();
+
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Run dynamic relaxation
+    auto mpm = std::make_unique<mpm::MPMExplicitDR<Dim>>(std::move(io));
+    REQUIRE(mpm->solve() == true);
+    check_static_solution(mpm.get());
+  }
+
+  SECTION("Check viscous damping without equilibrium") {
+    json["analysis"]["nsteps"] = 10;
+    json["analysis"]["dynamic_relaxation"] = {{"damping", "viscous"},
+                                              {"damping_coefficient", 200.},
+                                              {"tolerance", tolerance}};
+    std::ofstream output("mpm-explicit-dr-2d.json");
+    output << json.dump(2);
+    output.close();
+
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Run dynamic relaxation
+    auto mpm = std::make_unique<mpm::MPMExplicitDR<Dim>>(std::move(io));
+    // All steps are solved without reaching equilibrium
+    REQUIRE(mpm->solve() == false);
+    REQUIRE(mpm->equilibrium() == false);
+    REQUIRE(mpm->unbalanced_force_ratio() > tolerance);
+  }
+}
@@ -1,10 +1,21 @@
+#include <cmath>
+#include <fstream>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+
 #include "catch.hpp"
 
 //! Alias for JSON
 #include "json.hpp"
 using Json = nlohmann::json;
 
+#include "factory.h"
+#include "hexahedron_element.h"
+#include "material/bingham.h"
 #include "mpm_explicit_usf.h"
+#include "quadrilateral_element.h"
+#include "step_kernels.h"
 #include "write_mesh_particles.h"
 
 // Check MPM Explicit
@@ -66,6 +77,313 @@ TEST_CASE("MPM 2D Explicit implementation is checked",
     REQUIRE(mpm->checkpoint_resume() == false);
   }
 
+  SECTION("Check solver over concrete types") {
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Solver over the types of the entities of the input
+    const std::string analysis = mpm::analysis_key(*io);
+    REQUIRE(analysis == "MPMExplicitUSF2D/P2D/N2D/ED2Q4/LinearElastic2D");
+    // Run explicit MPM
+    auto mpm =
+        Factory<mpm::MPM, std::unique_ptr<mpm::IO>&&>::instance()->create(
+            analysis, std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == true);
+  }
+
+  SECTION("Check solver over mismatching concrete types") {
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Kernels of another material than the input
+    using Kernels =
+        mpm::ConcreteKernels<2, mpm::Particle<2, 1>, mpm::Node<2, 2, 1>,
+                             mpm::QuadrilateralElement<2, 4>, mpm::Bingham<2>>;
+    auto mpm =
+        std::make_unique<mpm::MPMExplicitUSF<Dim, Kernels>>(std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == false);
+  }
+
+  SECTION("Check solver with an adaptive time step") {
+    // Steps are bounded and end at output times and at the end time
+    std::ifstream input("mpm-explicit-usf-2d.json");
+    Json json = Json::parse(input);
+    json["analysis"]["adaptive_dt"] = {
+        {"cfl", 0.5}, {"dt_min", 1.E-6}, {"dt_max", 1.E-3}};
+    json["analysis"]["time"] = 0.004;
+    // Output steps are optional with an interval of time between outputs
+    json["post_processing"]["output_time"] = 0.0025;
+    json["post_processing"].erase("output_steps");
+    std::ofstream output("mpm-explicit-usf-adaptive-2d.json");
+    output << json.dump(2);
+    output.close();
+
+    // clang-format off
+    char* argv_adaptive[] = {(char*)"./mpm",
+                             (char*)"-a",  (char*)"MPMExplicitUSF2D",
+                             (char*)"-f",  (char*)"./",
+                             (char*)"-i",
+                             (char*)"mpm-explicit-usf-adaptive-2d.json"};
+    // clang-format on
+
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv_adaptive);
+    // Run explicit MPM
+    auto mpm = std::make_unique<mpm::MPMExplicitUSF<Dim>>(std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == true);
+    REQUIRE(mpm->time() == Approx(0.004).epsilon(1.E-9));
+    // The last step ends at the end time after an output at 0.0025
+    REQUIRE(mpm->dt() == Approx(0.0005).epsilon(1.E-9));
+  }
+
+  SECTION("Check solver with mass scaling") {
+    // Particles below the target time step are scaled up to the maximum
+    std::ifstream input("mpm-explicit-usf-2d.json");
+    Json json = Json::parse(input);
+    json["analysis"]["mass_scaling"] = {{"dt", 1.}, {"max_scale", 4.}};
+    std::ofstream output("mpm-explicit-usf-mass-scaling-2d.json");
+    output << json.dump(2);
+    output.close();
+
+    // clang-format off
+    char* argv_scaling[] = {(char*)"./mpm",
+                            (char*)"-a",  (char*)"MPMExplicitUSF2D",
+                            (char*)"-f",  (char*)"./",
+                            (char*)"-i",
+                            (char*)"mpm-explicit-usf-mass-scaling-2d.json"};
+    // clang-format on
+
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv_scaling);
+    // Run explicit MPM
+    auto mpm = std::make_unique<mpm::MPMExplicitUSF<Dim>>(std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == true);
+    REQUIRE(mpm->added_mass_ratio() == Approx(3.).epsilon(1.E-9));
+  }
+
+  SECTION("Check solver with sub-cycling") {
+    // Particles whose critical time step is below the time step take
+    // sub-steps, up to the maximum number of sub-cycles
+    std::ifstream input("mpm-explicit-usf-2d.json");
+    Json json = Json::parse(input);
+    // Stiff material, whose critical time step is below the time step
+    json["mesh"]["material_id"] = 0;
+    json["analysis"]["subcycling"] = {{"max_subcycles", 16}};
+    std::ofstream output("mpm-explicit-usf-subcycling-2d.json");
+    output << json.dump(2);
+    output.close();
+
+    // clang-format off
+    char* argv_subcycling[] = {(char*)"./mpm",
+                               (char*)"-a",  (char*)"MPMExplicitUSF2D",
+                               (char*)"-f",  (char*)"./",
+                               (char*)"-i",
+                               (char*)"mpm-explicit-usf-subcycling-2d.json"};
+    // clang-format on
+
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv_subcycling);
+    // Run explicit MPM
+    auto mpm = std::make_unique<mpm::MPMExplicitUSF<Dim>>(std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == true);
+    REQUIRE(mpm->time() == Approx(10 * 0.001).epsilon(1.E-9));
+    // Sub-steps are a power of two up to the maximum
+    REQUIRE(mpm->nsubcycles() > 1);
+    REQUIRE(mpm->nsubcycles() <= 16);
+    REQUIRE((mpm->nsubcycles() & (mpm->nsubcycles() - 1)) == 0);
+    // Classes hold all particles
+    const auto classes = mpm->rate_classes();
+    REQUIRE(classes.size() == 5);
+    mpm::Index nparticles = 0;
+    for (const auto nclass : classes) nparticles += nclass;
+    REQUIRE(nparticles == mpm->nparticles());
+    REQUIRE(std::isfinite(mpm->diagnostics().kinetic_energy));
+    // Sub-steps integrate the nodes of the cells of the fast particles
+    REQUIRE(mpm->nsubcycled_nodes() > 0);
+
+    // Sub-steps run the configured stages, so a run whose forces are mapped
+    // in a fused loop and whose stages run in order matches
+    json["analysis"]["stages"] = {
+        {"fuse", Json::array({Json::array({"body_force", "internal_force"})})},
+        {"graph", false}};
+    output.open("mpm-explicit-usf-subcycling-2d.json");
+    output << json.dump(2);
+    output.close();
+
+    io = std::make_unique<mpm::IO>(argc, argv_subcycling);
+    auto fused = std::make_unique<mpm::MPMExplicitUSF<Dim>>(std::move(io));
+    REQUIRE(fused->solve() == true);
+    REQUIRE(fused->nsubcycles() == mpm->nsubcycles());
+    REQUIRE(fused->nsubcycled_nodes() == mpm->nsubcycled_nodes());
+    REQUIRE(fused->diagnostics().kinetic_energy ==
+            Approx(mpm->diagnostics().kinetic_energy).epsilon(1.E-6));
+    REQUIRE(fused->diagnostics().momentum.norm() ==
+            Approx(mpm->diagnostics().momentum.norm()).epsilon(1.E-6));
+    json["analysis"].erase("stages");
+
+    // A run with a uniform time step of the sub-step matches the sub-cycled
+    // run, which only holds the stress of the slow classes over their steps
+    const unsigned nsubcycles = mpm->nsubcycles();
+    json["analysis"].erase("subcycling");
+    json["analysis"]["dt"] = 0.001 / nsubcycles;
+    json["analysis"]["nsteps"] = 10 * nsubcycles;
+    json["post_processing"]["output_steps"] = 5 * nsubcycles;
+    output.open("mpm-explicit-usf-subcycling-2d.json");
+    output << json.dump(2);
+    output.close();
+
+    io = std::make_unique<mpm::IO>(argc, argv_subcycling);
+    auto uniform = std::make_unique<mpm::MPMExplicitUSF<Dim>>(std::move(io));
+    REQUIRE(uniform->solve() == true);
+    REQUIRE(uniform->time() == Approx(mpm->time()).epsilon(1.E-9));
+    REQUIRE(mpm->diagnostics().kinetic_energy ==
+            Approx(uniform->diagnostics().kinetic_energy).epsilon(1.E-2));
+    REQUIRE(mpm->diagnostics().momentum.norm() ==
+            Approx(uniform->diagnostics().momentum.norm()).epsilon(1.E-2));
+    REQUIRE(mpm->diagnostics().max_velocity ==
+            Approx(uniform->diagnostics().max_velocity).epsilon(1.E-2));
+  }
+
+  SECTION("Check solver until a steady state") {
+    // Diagnostics are below the thresholds from the first step
+    std::ifstream input("mpm-explicit-usf-2d.json");
+    Json json = Json::parse(input);
+    json["analysis"]["uuid"] = "mpm-explicit-usf-steady-2d";
+    json["analysis"]["steady_state"] = {
+        {"kinetic_energy", 1.E+6}, {"max_velocity", 1.E+3}, {"steps", 2}};
+    std::ofstream output("mpm-explicit-steady-2d.json");
+    output << json.dump(2);
+    output.close();
+
+    // clang-format off
+    char* argv_steady[] = {(char*)"./mpm",
+                           (char*)"-a",  (char*)"MPMExplicitUSF2D",
+                           (char*)"-f",  (char*)"./",
+                           (char*)"-i",  (char*)"mpm-explicit-steady-2d.json"};
+    // clang-format on
+
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv_steady);
+    // Run explicit MPM
+    auto mpm = std::make_unique<mpm::MPMExplicitUSF<Dim>>(std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == true);
+    REQUIRE(mpm->steady_state() == true);
+    // Two steps of the ten steps are solved
+    REQUIRE(mpm->time() == Approx(0.002).epsilon(1.E-9));
+    REQUIRE(mpm->diagnostics().kinetic_energy > 0.);
+    REQUIRE(mpm->diagnostics().max_velocity > 0.);
+    // Final output includes a checkpoint, which other outputs don't
+    REQUIRE(boost::filesystem::exists(
+                "results/mpm-explicit-usf-steady-2d/checkpoint01.bin") == true);
+    REQUIRE(boost::filesystem::exists(
+                "results/mpm-explicit-usf-steady-2d/checkpoint00.bin") ==
+            false);
+  }
+
+  SECTION("Check stepping from an input JSON object") {
+    // Analysis is created from the input in memory
+    std::ifstream input("mpm-explicit-usf-2d.json");
+    Json json = Json::parse(input);
+    json["analysis"]["uuid"] = "mpm-explicit-usf-stepping-2d";
+    auto mpm = std::dynamic_pointer_cast<mpm::MPMExplicit<Dim>>(
+        mpm::create_analysis("MPMExplicitUSF2D", json, "./"));
+    REQUIRE(mpm != nullptr);
+
+    // Callbacks at the events of each step
+    std::vector<mpm::Index> begin, coupling, end;
+    mpm->add_step_callback(mpm::StepEvent::Begin, [&](mpm::Index step,
+                                                      double) {
+      begin.emplace_back(step);
+    });
+    // Forces of a coupled solver are added to the external nodal forces
+    mpm->add_step_callback(mpm::StepEvent::NodalForces, [&](mpm::Index step,
+                                                            double) {
+      coupling.emplace_back(step);
+      auto forces = mpm->nodes_field("external_force");
+      for (std::size_t i = 0; i < forces.size(); ++i) forces[i](0) += 1.;
+    });
+    mpm->add_step_callback(mpm::StepEvent::End, [&](mpm::Index step,
+                                                    double time) {
+      end.emplace_back(step);
+      REQUIRE(time == Approx((step + 1) * 0.001).epsilon(1.E-9));
+    });
+    REQUIRE(mpm->advance(1) == 0);
+    REQUIRE(mpm->initialise() == true);
+
+    // Views of the particles before the steps
+    const auto coordinates = mpm->particles_field("coordinates");
+    REQUIRE(coordinates.size() == mpm->nparticles());
+    REQUIRE(coordinates.ncomponents() == Dim);
+    const Eigen::VectorXd initial = coordinates[0];
+
+    // Advance some steps
+    REQUIRE(mpm->advance(3) == 3);
+    REQUIRE(mpm->step() == 3);
+    REQUIRE(mpm->finished() == false);
+    REQUIRE(begin == std::vector<mpm::Index>({0, 1, 2}));
+    REQUIRE(coupling == begin);
+    REQUIRE(end == begin);
+    // Particles are moved in the storage of the view
+    REQUIRE((coordinates[0] - initial).norm() > 0.);
+
+    // Velocity is written in place
+    auto velocity = mpm->particles_field("velocity");
+    REQUIRE(velocity.ncomponents() == Dim);
+    velocity[0] << 0.1, 0.2;
+    REQUIRE(mpm->particles_field("velocity")[0](0) == Approx(0.1));
+    REQUIRE(mpm->particles_field("velocity")[0](1) == Approx(0.2));
+    REQUIRE(mpm->particles_field("stress").ncomponents() == 6);
+    // Particle mass is recomputed at each step, and is read-only
+    const auto mass = mpm->particles_field("mass");
+    REQUIRE(mass.ncomponents() == 1);
+    REQUIRE(mass.read_only() == true);
+    REQUIRE(mass[0](0) > 0.);
+    REQUIRE_THROWS(mpm->particles_field("mass")[0]);
+    // Nodal fields
+    REQUIRE(mpm->nodes_field("mass").ncomponents() == 1);
+    REQUIRE(mpm->nodes_field("velocity").size() == 6);
+    // Nodal momentum and acceleration are recomputed at each step
+    REQUIRE(mpm->nodes_field("momentum").read_only() == true);
+    REQUIRE(mpm->nodes_field("acceleration").read_only() == true);
+    REQUIRE(mpm->nodes_field("external_force").read_only() == false);
+    // Nodal coordinates are cached by the cells, and are read-only
+    auto nodal_coordinates = mpm->nodes_field("coordinates");
+    REQUIRE(nodal_coordinates.read_only() == true);
+    REQUIRE(mpm->nodes_field("velocity").read_only() == false);
+    REQUIRE_THROWS(nodal_coordinates[0]);
+    const auto& coordinates_view = nodal_coordinates;
+    REQUIRE(coordinates_view[1](0) == Approx(0.5).epsilon(1.E-12));
+    // Unknown fields and phases have empty views
+    REQUIRE(mpm->particles_field("pressure").size() == 0);
+    REQUIRE(mpm->nodes_field("velocity", 1).size() == 0);
+
+    // Callbacks at the nodal forces aren't added after the initialisation
+    // without a coupling stage
+    json["analysis"]["uuid"] = "mpm-explicit-usf-uncoupled-2d";
+    auto uncoupled = std::dynamic_pointer_cast<mpm::MPMExplicit<Dim>>(
+        mpm::create_analysis("MPMExplicitUSF2D", json, "./"));
+    REQUIRE(uncoupled->initialise() == true);
+    REQUIRE_THROWS(uncoupled->add_step_callback(mpm::StepEvent::NodalForces,
+                                                [](mpm::Index, double) {}));
+    REQUIRE_NOTHROW(uncoupled->add_step_callback(mpm::StepEvent::End,
+                                                 [](mpm::Index, double) {}));
+    REQUIRE_NOTHROW(mpm->add_step_callback(mpm::StepEvent::NodalForces,
+                                           [](mpm::Index, double) {}));
+
+    // Remaining steps end at the end of the analysis
+    REQUIRE(mpm->advance(100) == 7);
+    REQUIRE(mpm->finished() == true);
+    REQUIRE(mpm->advance(1) == 0);
+    mpm->finalise();
+    REQUIRE(mpm->time() == Approx(10 * 0.001).epsilon(1.E-9));
+    REQUIRE(coupling.size() == 10);
+    REQUIRE(mpm->stage_times().count("coupling") == 1);
+  }
+
   SECTION("Check resume") {
     // Write JSON file
     const std::string fname = "mpm-explicit-usf";
@@ -143,6 +461,33 @@ TEST_CASE("MPM 3D Explicit implementation is checked",
     REQUIRE(mpm->checkpoint_resume() == false);
   }
 
+  SECTION("Check solver over concrete types") {
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Solver over the types of the entities of the input
+    const std::string analysis = mpm::analysis_key(*io);
+    REQUIRE(analysis == "MPMExplicitUSF3D/P3D/N3D/ED3H8/LinearElastic3D");
+    // Run explicit MPM
+    auto mpm =
+        Factory<mpm::MPM, std::unique_ptr<mpm::IO>&&>::instance()->create(
+            analysis, std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == true);
+  }
+
+  SECTION("Check solver over mismatching concrete types") {
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Kernels of another material than the input
+    using Kernels =
+        mpm::ConcreteKernels<3, mpm::Particle<3, 1>, mpm::Node<3, 3, 1>,
+                             mpm::HexahedronElement<3, 8>, mpm::Bingham<3>>;
+    auto mpm =
+        std::make_unique<mpm::MPMExplicitUSF<Dim, Kernels>>(std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == false);
+  }
+
   SECTION("Check resume") {
     // Write JSON file
     const std::string fname = "mpm-explicit-usf";
@@ -1,3 +1,5 @@
+#include <fstream>
+
 #include "catch.hpp"
 
 //! Alias for JSON
@@ -66,6 +68,58 @@ TEST_CASE("MPM 2D Explicit USL implementation is checked",
     REQUIRE(mpm->checkpoint_resume() == false);
   }
 
+  SECTION("Check solver with configured stages") {
+    // Stress and position updates are fused, and an unknown stage fails
+    std::ifstream input("mpm-explicit-usl-2d.json");
+    Json json = Json::parse(input);
+    json["analysis"]["stages"] = {
+        {"fuse", Json::array({Json::array({"update_particles", "stress"})})}};
+    std::ofstream output("mpm-explicit-usl-stages-2d.json");
+    output << json.dump(2);
+    output.close();
+
+    // clang-format off
+    char* argv_stages[] = {(char*)"./mpm",
+                           (char*)"-a",  (char*)"MPMExplicitUSL2D",
+                           (char*)"-f",  (char*)"./",
+                           (char*)"-i",
+                           (char*)"mpm-explicit-usl-stages-2d.json"};
+    // clang-format on
+
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv_stages);
+    // Run explicit MPM
+    auto mpm = std::make_unique<mpm::MPMExplicitUSL<Dim>>(std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == true);
+    REQUIRE(mpm->stage_times().count("update_particles+stress") == 1);
+    REQUIRE(mpm->stage_times().count("stress") == 0);
+
+    json["analysis"]["stages"] = {{"skip", Json::array({"mass"})}};
+    output.open("mpm-explicit-usl-stages-2d.json");
+    output << json.dump(2);
+    output.close();
+
+    io = std::make_unique<mpm::IO>(argc, argv_stages);
+    mpm = std::make_unique<mpm::MPMExplicitUSL<Dim>>(std::move(io));
+    REQUIRE(mpm->solve() == false);
+
+    // Outputs of the last step are pending until the output stage, which
+    // can't be skipped or reordered
+    for (const auto& stages :
+         {Json{{"skip", Json::array({"output"})}},
+          Json{{"order", Json::array({"initialise_nodes", "output"})}}}) {
+      json["analysis"]["stages"] = stages;
+      output.open("mpm-explicit-usl-stages-2d.json");
+      output << json.dump(2);
+      output.close();
+
+      io = std::make_unique<mpm::IO>(argc, argv_stages);
+      mpm = std::make_unique<mpm::MPMExplicitUSL<Dim>>(std::move(io));
+      REQUIRE(mpm->solve() == false);
+    }
+  }
+
   SECTION("Check resume") {
     // Write JSON file
     const std::string fname = "mpm-explicit-usl";
@@ -0,0 +1,133 @@
+#include <cmath>
+#include <fstream>
+
+#include "catch.hpp"
+
+//! Alias for JSON
+#include "json.hpp"
+using Json = nlohmann::json;
+
+#include "mpm_implicit.h"
+#include "write_mesh_particles.h"
+
+// Check MPM Implicit
+TEST_CASE("MPM 2D Implicit implementation is checked",
+          "[MPM][2D][Implicit][1Phase]") {
+  // Dimension
+  const unsigned Dim = 2;
+
+  // Write JSON file
+  const std::string fname = "mpm-implicit";
+  const bool resume = false;
+  bool status = mpm_test::write_json(2, resume, fname);
+  REQUIRE(status == true);
+
+  // Write Mesh
+  bool mesh_status = mpm_test::write_mesh_2d();
+  REQUIRE(mesh_status == true);
+
+  // Write Particles
+  bool particle_status = mpm_test::write_particles_2d();
+  REQUIRE(particle_status == true);
+
+  // Assign argc and argv to input arguments of MPM
+  int argc = 7;
+  // clang-format off
+  char* argv[] = {(char*)"./mpm",
+                  (char*)"-a",  (char*)"MPMImplicit2D",
+                  (char*)"-f",  (char*)"./",
+                  (char*)"-i",  (char*)"mpm-implicit-2d.json"};
+  // clang-format on
+
+  SECTION("Check solver") {
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Run implicit MPM
+    auto mpm = std::make_unique<mpm::MPMImplicit<Dim>>(std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == true);
+    REQUIRE(mpm->linear_iterations() > 0);
+    REQUIRE(mpm->time() == Approx(10 * 0.001).epsilon(1.E-9));
+  }
+
+  SECTION("Check a time step above the critical time step") {
+    // Time step of about twenty critical time steps of the mesh
+    std::ifstream input("mpm-implicit-2d.json");
+    Json json = Json::parse(input);
+    input.close();
+    json["analysis"]["dt"] = 0.005;
+    json["analysis"]["linear_solver"] = {{"tolerance", 1.E-10},
+                                         {"max_iterations", 500}};
+    std::ofstream output("mpm-implicit-2d.json");
+    output << json.dump(2);
+    output.close();
+
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Run implicit MPM
+    auto mpm = std::make_unique<mpm::MPMImplicit<Dim>>(std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == true);
+    REQUIRE(mpm->time() == Approx(10 * 0.005).epsilon(1.E-9));
+    REQUIRE(std::isfinite(mpm->diagnostics().kinetic_energy));
+  }
+
+  SECTION("Check solver without convergence") {
+    std::ifstream input("mpm-implicit-2d.json");
+    Json json = Json::parse(input);
+    input.close();
+    json["analysis"]["linear_solver"] = {{"tolerance", 1.E-300},
+                                         {"max_iterations", 1}};
+    std::ofstream output("mpm-implicit-2d.json");
+    output << json.dump(2);
+    output.close();
+
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Run implicit MPM
+    auto mpm = std::make_unique<mpm::MPMImplicit<Dim>>(std::move(io));
+    // Steps are solved, but the linear solver doesn't converge
+    REQUIRE(mpm->solve() == false);
+    REQUIRE(mpm->linear_iterations() <= 10);
+  }
+}
+
+// Check MPM Implicit
+TEST_CASE("MPM 3D Implicit implementation is checked",
+          "[MPM][3D][Implicit][1Phase]") {
+  // Dimension
+  const unsigned Dim = 3;
+
+  // Write JSON file
+  const std::string fname = "mpm-implicit";
+  const bool resume = false;
+  bool status = mpm_test::write_json(3, resume, fname);
+  REQUIRE(status == true);
+
+  // Write Mesh
+  bool mesh_status = mpm_test::write_mesh_3d();
+  REQUIRE(mesh_status == true);
+
+  // Write Particles
+  bool particle_status = mpm_test::write_particles_3d();
+  REQUIRE(particle_status == true);
+
+  // Assign argc and argv to input arguments of MPM
+  int argc = 7;
+  // clang-format off
+  char* argv[] = {(char*)"./mpm",
+                  (char*)"-a",  (char*)"MPMImplicit3D",
+                  (char*)"-f",  (char*)"./",
+                  (char*)"-i",  (char*)"mpm-implicit-3d.json"};
+  // clang-format on
+
+  SECTION("Check solver") {
+    // Create an IO object
+    auto io = std::make_unique<mpm::IO>(argc, argv);
+    // Run implicit MPM
+    auto mpm = std::make_unique<mpm::MPMImplicit<Dim>>(std::move(io));
+    // Solve
+    REQUIRE(mpm->solve() == true);
+    REQUIRE(mpm->linear_iterations() > 0);
+  }
+}
@@ -114,6 +114,35 @@ TEST_CASE("ReadMeshAscii is checked for 2D", "[ReadMesh][ReadMeshAscii][2D]") {
         }
       }
     }
+
+    // Check read mesh nodes and cells in one pass
+    SECTION("Check read mesh nodes and cells") {
+      // Create a read_mesh object
+      auto read_mesh = std::make_unique<mpm::ReadMeshAscii<dim>>();
+
+      std::vector<Eigen::Matrix<double, dim, 1>> check_coords;
+      std::vector<std::vector<mpm::Index>> check_node_ids;
+      read_mesh->read_mesh("mesh-2d.txt", check_coords, check_node_ids);
+      // Check number of nodes and cells
+      REQUIRE(check_coords.size() == coordinates.size());
+      REQUIRE(check_node_ids.size() == cells.size());
+      // Check coordinates of nodes
+      for (unsigned i = 0; i < coordinates.size(); ++i)
+        for (unsigned j = 0; j < dim; ++j)
+          REQUIRE(check_coords[i][j] ==
+                  Approx(coordinates[i][j]).epsilon(Tolerance));
+      // Check node ids of cells
+      for (unsigned i = 0; i < cells.size(); ++i) {
+        REQUIRE(check_node_ids[i].size() == cells[i].size());
+        for (unsigned j = 0; j < cells[i].size(); ++j)
+          REQUIRE(check_node_ids[i][j] == cells[i][j]);
+      }
+
+      // Non-existant file
+      read_mesh->read_mesh("mesh-missing.txt", check_coords, check_node_ids);
+      REQUIRE(check_coords.size() == 0);
+      REQUIRE(check_node_ids.size() == 0);
+    }
   }
 
   SECTION("Check particles file") {
@@ -373,6 +402,35 @@ TEST_CASE("ReadMeshAscii is checked for 3D", "[ReadMesh][ReadMeshAscii][3D]") {
         }
       }
     }
+
+    // Check read mesh nodes and cells in one pass
+    SECTION("Check read mesh nodes and cells") {
+      // Create a read_mesh object
+      auto read_mesh = std::make_unique<mpm::ReadMeshAscii<dim>>();
+
+      std::vector<Eigen::Matrix<double, dim, 1>> check_coords;
+      std::vector<std::vector<mpm::Index>> check_node_ids;
+      read_mesh->read_mesh("mesh-3d.txt", check_coords, check_node_ids);
+      // Check number of nodes and cells
+      REQUIRE(check_coords.size() == coordinates.size());
+      REQUIRE(check_node_ids.size() == cells.size());
+      // Check coordinates of nodes
+      for (unsigned i = 0; i < coordinates.size(); ++i)
+        for (unsigned j = 0; j < dim; ++j)
+          REQUIRE(check_coords[i][j] ==
+                  Approx(coordinates[i][j]).epsilon(Tolerance));
+      // Check node ids of cells
+      for (unsigned i = 0; i < cells.size(); ++i) {
+        REQUIRE(check_node_ids[i].size() == cells[i].size());
+        for (unsigned j = 0; j < cells[i].size(); ++j)
+          REQUIRE(check_node_ids[i][j] == cells[i][j]);
+      }
+
+      // Non-existant file
+      read_mesh->read_mesh("mesh-missing.txt", check_coords, check_node_ids);
+      REQUIRE(check_coords.size() == 0);
+      REQUIRE(check_node_ids.size() == 0);
+    }
   }
 
   SECTION("Check particles file") {
@@ -0,0 +1,109 @@
+#include <fstream>
+
+#include "catch.hpp"
+
+#include "binary_mesh.h"
+#include "read_mesh_binary.h"
+
+// Check ReadMeshBinary
+TEST_CASE("ReadMeshBinary is checked for 2D",
+          "[ReadMesh][ReadMeshBinary][2D]") {
+  // Dimension
+  const unsigned dim = 2;
+  // Tolerance
+  const double Tolerance = 1.E-7;
+
+  // Nodal coordinates
+  const std::vector<double> points{0., 0., 0.5, 0., 0.5, 0.5,
+                                   0., 0.5, 1.0, 0., 1.0, 0.5};
+  // Cell with node ids
+  const std::vector<uint64_t> cells{0, 1, 2, 3, 1, 4, 5, 2};
+  // Velocity constraints
+  const std::vector<mpm::BinaryConstraint> constraints{{0, 0, 10.5},
+                                                       {5, 1, -12.5}};
+
+  // Write binary files
+  REQUIRE(mpm::write_binary_mesh("mesh-2d.bin", dim, points, 4, cells, {}) ==
+          true);
+  REQUIRE(mpm::write_binary_mesh("particles-2d.bin", dim, points, 0, {}, {}) ==
+          true);
+  REQUIRE(mpm::write_binary_mesh("constraints-2d.bin", dim, {}, 0, {},
+                                 constraints) == true);
+  // Inconsistent sizes are rejected
+  REQUIRE(mpm::write_binary_mesh("invalid-2d.bin", dim, {0.}, 0, {}, {}) ==
+          false);
+  REQUIRE(mpm::write_binary_mesh("invalid-2d.bin", dim, points, 3, cells,
+                                 {}) == false);
+
+  // Create a read_mesh object
+  auto read_mesh = std::make_unique<mpm::ReadMeshBinary<dim>>();
+
+  SECTION("Check read mesh nodes and cells") {
+    auto coordinates = read_mesh->read_mesh_nodes("mesh-2d.bin");
+    REQUIRE(coordinates.size() == 6);
+    for (unsigned i = 0; i < coordinates.size(); ++i)
+      for (unsigned j = 0; j < dim; ++j)
+        REQUIRE(coordinates[i][j] ==
+                Approx(points[i * dim + j]).epsilon(Tolerance));
+
+    auto node_ids = read_mesh->read_mesh_cells("mesh-2d.bin");
+    REQUIRE(node_ids.size() == 2);
+    for (unsigned i = 0; i < node_ids.size(); ++i) {
+      REQUIRE(node_ids[i].size() == 4);
+      for (unsigned j = 0; j < node_ids[i].size(); ++j)
+        REQUIRE(node_ids[i][j] == cells[i * 4 + j]);
+    }
+
+    read_mesh->read_mesh("mesh-2d.bin", coordinates, node_ids);
+    REQUIRE(coordinates.size() == 6);
+    REQUIRE(node_ids.size() == 2);
+
+    // Missing file
+    read_mesh->read_mesh("mesh-missing.bin", coordinates, node_ids);
+    REQUIRE(coordinates.size() == 0);
+    REQUIRE(node_ids.size() == 0);
+  }
+
+  SECTION("Check read particles") {
+    const auto coordinates = read_mesh->read_particles("particles-2d.bin");
+    REQUIRE(coordinates.size() == 6);
+    for (unsigned i = 0; i < coordinates.size(); ++i)
+      for (unsigned j = 0; j < dim; ++j)
+        REQUIRE(coordinates[i][j] ==
+                Approx(points[i * dim + j]).epsilon(Tolerance));
+
+    // Dimension mismatch
+    auto read_mesh_3d = std::make_unique<mpm::ReadMeshBinary<3>>();
+    REQUIRE(read_mesh_3d->read_particles("particles-2d.bin").size() == 0);
+  }
+
+  SECTION("Check read velocity constraints") {
+    const auto check =
+        read_mesh->read_velocity_constraints("constraints-2d.bin");
+    REQUIRE(check.size() == constraints.size());
+    for (unsigned i = 0; i < check.size(); ++i) {
+      REQUIRE(std::get<0>(check[i]) == constraints[i].id);
+      REQUIRE(std::get<1>(check[i]) == constraints[i].direction);
+      REQUIRE(std::get<2>(check[i]) ==
+              Approx(constraints[i].velocity).epsilon(Tolerance));
+    }
+  }
+
+  SECTION("Check invalid and truncated files") {
+    // Not a binary mesh file
+    std::ofstream file("invalid-2d.bin");
+    file << "2\t1\n0. 0.\n";
+    file.close();
+    REQUIRE(read_mesh->read_mesh_nodes("invalid-2d.bin").size() == 0);
+
+    // Truncated binary mesh file
+    std::ifstream input("mesh-2d.bin", std::ios::binary);
+    std::vector<char> data((std::istreambuf_iterator<char>(input)),
+                           std::istreambuf_iterator<char>());
+    std::ofstream truncated("invalid-2d.bin", std::ios::binary);
+    truncated.write(data.data(), data.size() - 8);
+    truncated.close();
+    REQUIRE_THROWS(mpm::MappedBinaryMesh("invalid-2d.bin"));
+    REQUIRE(read_mesh->read_mesh_cells("invalid-2d.bin").size() == 0);
+  }
+}
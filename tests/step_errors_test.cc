@@ -0,0 +1,114 @@
+#include <memory>
+
+#include "Eigen/Dense"
+#include "catch.hpp"
+#include <tbb/parallel_for.h>
+
+#include "mesh.h"
+#include "node.h"
+#include "step_errors.h"
+
+//! \brief Check step errors are counted over threads and reset on collect
+TEST_CASE("Step errors are checked", "[step_errors]") {
+  // Discard failures recorded by other tests
+  mpm::StepErrors::instance().collect();
+
+  SECTION("Failures recorded by many threads are combined") {
+    const unsigned nfailures = 10000;
+    tbb::parallel_for(0u, nfailures, [](unsigned i) {
+      mpm::StepErrors::instance().record(
+          (i % 2) ? mpm::StepError::NodalMass : mpm::StepError::ParticleCell);
+    });
+
+    auto counters = mpm::StepErrors::instance().collect();
+    REQUIRE(counters[static_cast<unsigned>(mpm::StepError::NodalMass)] ==
+            nfailures / 2);
+    REQUIRE(counters[static_cast<unsigned>(mpm::StepError::ParticleCell)] ==
+            nfailures / 2);
+    REQUIRE(counters[static_cast<unsigned>(
+                mpm::StepError::DegreesOfFreedom)] == 0);
+
+    // Counters are reset after collecting
+    counters = mpm::StepErrors::instance().collect();
+    for (const auto count : counters) REQUIRE(count == 0);
+  }
+
+  SECTION("Node kernels record failures instead of throwing") {
+    const unsigned Dim = 2;
+    const unsigned Dof = 2;
+    const unsigned Nphases = 1;
+    const unsigned Nphase = 0;
+    Eigen::Matrix<double, Dim, 1> coords;
+    coords.setZero();
+    auto node = std::make_shared<mpm::Node<Dim, Dof, Nphases>>(0, coords);
+
+    // Zero mass
+    REQUIRE_NOTHROW(node->compute_velocity());
+    REQUIRE(node->compute_acceleration_velocity(Nphase, 0.1) == false);
+
+    // Mismatch in degrees of freedom
+    Eigen::VectorXd force = Eigen::VectorXd::Constant(Dof + 1, 1.);
+    REQUIRE(node->update_external_force(false, Nphase, force) == false);
+
+    const auto counters = mpm::StepErrors::instance().collect();
+    REQUIRE(counters[static_cast<unsigned>(mpm::StepError::NodalMass)] == 2);
+    REQUIRE(counters[static_cast<unsigned>(
+                mpm::StepError::DegreesOfFreedom)] == 1);
+  }
+
+  SECTION("Failures are recorded in the step errors of their scope") {
+    mpm::StepErrors first, second;
+    const unsigned nfailures = 1000;
+    tbb::parallel_for(0u, nfailures, [&](unsigned i) {
+      mpm::StepErrors::Scope scope((i % 2) ? &first : &second);
+      mpm::StepErrors::current().record(mpm::StepError::NodalMass);
+      {
+        // Nested scopes restore the enclosing scope
+        mpm::StepErrors::Scope nested(&second);
+        mpm::StepErrors::current().record(mpm::StepError::ParticleCell);
+      }
+      mpm::StepErrors::current().record(mpm::StepError::NodalMass);
+    });
+
+    auto counters = first.collect();
+    REQUIRE(counters[static_cast<unsigned>(mpm::StepError::NodalMass)] ==
+            nfailures);
+    REQUIRE(counters[static_cast<unsigned>(mpm::StepError::ParticleCell)] ==
+            0);
+    counters = second.collect();
+    REQUIRE(counters[static_cast<unsigned>(mpm::StepError::NodalMass)] ==
+            nfailures);
+    REQUIRE(counters[static_cast<unsigned>(mpm::StepError::ParticleCell)] ==
+            nfailures);
+    // Nothing is recorded in the default step errors
+    counters = mpm::StepErrors::instance().collect();
+    for (const auto count : counters) REQUIRE(count == 0);
+  }
+
+  SECTION("Kernels iterated by a mesh record in the mesh") {
+    const unsigned Dim = 2;
+    Eigen::Matrix<double, Dim, 1> coords;
+    coords.setZero();
+    auto mesh = std::make_shared<mpm::Mesh<Dim>>(0);
+    REQUIRE(mesh->add_node(
+                std::make_shared<mpm::Node<Dim, Dim, 1>>(0, coords)) == true);
+
+    // Zero mass
+    mesh->iterate_over_nodes(
+        [](const std::shared_ptr<mpm::NodeBase<Dim>>& node) {
+          node->compute_acceleration_velocity(0, 0.1);
+        });
+
+    auto counters = mesh->step_errors().collect();
+    REQUIRE(counters[static_cast<unsigned>(mpm::StepError::NodalMass)] == 1);
+    counters = mpm::StepErrors::instance().collect();
+    for (const auto count : counters) REQUIRE(count == 0);
+  }
+
+  SECTION("Names of failures are described") {
+    REQUIRE(mpm::StepErrors::description(mpm::StepError::NodalMass) ==
+            "nodal mass is zero or below threshold");
+    REQUIRE(mpm::StepErrors::description(mpm::StepError::ParticleMaterial) ==
+            "particle material is invalid");
+  }
+}
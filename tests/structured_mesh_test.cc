@@ -0,0 +1,154 @@
+#include "catch.hpp"
+
+#include "element.h"
+#include "factory.h"
+#include "mesh.h"
+#include "structured_mesh.h"
+
+// Check StructuredMesh
+TEST_CASE("StructuredMesh is checked for 2D",
+          "[ReadMesh][StructuredMesh][2D]") {
+  // Dimension
+  const unsigned Dim = 2;
+  // Tolerance
+  const double Tolerance = 1.E-9;
+
+  // Grid of 2 x 1 cells
+  Json properties = {
+      {"origin", {0., 0.}},
+      {"lengths", {1., 0.5}},
+      {"ncells", {2, 1}},
+      {"boundary_constraints",
+       {{{"boundary", "x_min"}, {"direction", 0}, {"velocity", 0.}},
+        {{"boundary", "y_max"}, {"direction", 1}, {"velocity", -1.5}}}}};
+
+  auto structured_mesh = std::make_shared<mpm::StructuredMesh<Dim>>();
+  structured_mesh->properties(properties);
+  REQUIRE(structured_mesh->nnodes() == 6);
+  REQUIRE(structured_mesh->ncells() == 2);
+
+  SECTION("Check nodes and cells") {
+    std::vector<Eigen::Matrix<double, Dim, 1>> coordinates;
+    std::vector<std::vector<mpm::Index>> cells;
+    structured_mesh->read_mesh("", coordinates, cells);
+
+    const std::vector<std::array<double, Dim>> check_coordinates{
+        {0., 0.}, {0.5, 0.}, {1., 0.}, {0., 0.5}, {0.5, 0.5}, {1., 0.5}};
+    REQUIRE(coordinates.size() == check_coordinates.size());
+    for (unsigned i = 0; i < coordinates.size(); ++i)
+      for (unsigned j = 0; j < Dim; ++j)
+        REQUIRE(coordinates[i](j) ==
+                Approx(check_coordinates[i][j]).epsilon(Tolerance));
+
+    const std::vector<std::vector<mpm::Index>> check_cells{{0, 1, 4, 3},
+                                                           {1, 2, 5, 4}};
+    REQUIRE(cells == check_cells);
+  }
+
+  SECTION("Check boundary constraints") {
+    const auto constraints = structured_mesh->read_velocity_constraints("");
+    const std::vector<std::tuple<mpm::Index, unsigned, double>> check{
+        {0, 0, 0.}, {3, 0, 0.}, {3, 1, -1.5}, {4, 1, -1.5}, {5, 1, -1.5}};
+    REQUIRE(constraints.size() == check.size());
+    for (unsigned i = 0; i < constraints.size(); ++i) {
+      REQUIRE(std::get<0>(constraints[i]) == std::get<0>(check[i]));
+      REQUIRE(std::get<1>(constraints[i]) == std::get<1>(check[i]));
+      REQUIRE(std::get<2>(constraints[i]) ==
+              Approx(std::get<2>(check[i])).epsilon(Tolerance));
+    }
+  }
+
+  SECTION("Check mesh creation and particle generation") {
+    auto mesh = std::make_shared<mpm::Mesh<Dim>>(0);
+    auto element = Factory<mpm::Element<Dim>>::instance()->create("ED2Q4");
+    REQUIRE(mesh->create_nodes(0, "N2D",
+                               structured_mesh->read_mesh_nodes("")) ==
+            true);
+    REQUIRE(mesh->create_cells(0, element,
+                               structured_mesh->read_mesh_cells("")) == true);
+    REQUIRE(mesh->ncells() == 2);
+    REQUIRE(mesh->assign_velocity_constraints(
+                structured_mesh->read_velocity_constraints("")) == true);
+    REQUIRE(mesh->generate_particles(0, "P2D", 2) == true);
+    REQUIRE(mesh->nparticles() == 8);
+  }
+
+  SECTION("Check invalid properties") {
+    properties["boundary_constraints"] = {
+        {{"boundary", "z_min"}, {"direction", 0}, {"velocity", 0.}}};
+    REQUIRE_THROWS(structured_mesh->properties(properties));
+    properties["boundary_constraints"] = {
+        {{"boundary", "x_max"}, {"direction", 2}, {"velocity", 0.}}};
+    REQUIRE_THROWS(structured_mesh->properties(properties));
+    properties["ncells"] = {0, 1};
+    REQUIRE_THROWS(structured_mesh->properties(properties));
+  }
+}
+
+// Check StructuredMesh
+TEST_CASE("StructuredMesh is checked for 3D",
+          "[ReadMesh][StructuredMesh][3D]") {
+  // Dimension
+  const unsigned Dim = 3;
+  // Tolerance
+  const double Tolerance = 1.E-9;
+
+  // Grid of 2 x 2 x 3 cells
+  Json properties = {
+      {"origin", {-1., 0., 2.}},
+      {"lengths", {2., 1., 3.}},
+      {"ncells", {2, 2, 3}},
+      {"boundary_constraints",
+       {{{"boundary", "z_min"}, {"direction", 2}, {"velocity", 0.}}}}};
+
+  auto structured_mesh = std::make_shared<mpm::StructuredMesh<Dim>>();
+  structured_mesh->properties(properties);
+  REQUIRE(structured_mesh->nnodes() == 36);
+  REQUIRE(structured_mesh->ncells() == 12);
+
+  SECTION("Check nodes and cells") {
+    std::vector<Eigen::Matrix<double, Dim, 1>> coordinates;
+    std::vector<std::vector<mpm::Index>> cells;
+    structured_mesh->read_mesh("", coordinates, cells);
+    REQUIRE(coordinates.size() == 36);
+    REQUIRE(cells.size() == 12);
+
+    // Last node is the upper corner
+    REQUIRE(coordinates.back()(0) == Approx(1.).epsilon(Tolerance));
+    REQUIRE(coordinates.back()(1) == Approx(1.).epsilon(Tolerance));
+    REQUIRE(coordinates.back()(2) == Approx(5.).epsilon(Tolerance));
+
+    // First cell
+    const std::vector<mpm::Index> check_cell{0, 1, 4, 3, 9, 10, 13, 12};
+    REQUIRE(cells.front() == check_cell);
+  }
+
+  SECTION("Check boundary constraints") {
+    const auto constraints = structured_mesh->read_velocity_constraints("");
+    REQUIRE(constraints.size() == 9);
+    for (unsigned i = 0; i < constraints.size(); ++i) {
+      REQUIRE(std::get<0>(constraints[i]) == i);
+      REQUIRE(std::get<1>(constraints[i]) == 2);
+    }
+  }
+
+  SECTION("Check mesh creation and particle generation") {
+    auto mesh = std::make_shared<mpm::Mesh<Dim>>(0);
+    auto element = Factory<mpm::Element<Dim>>::instance()->create("ED3H8");
+    REQUIRE(mesh->create_nodes(0, "N3D",
+                               structured_mesh->read_mesh_nodes("")) ==
+            true);
+    REQUIRE(mesh->create_cells(0, element,
+                               structured_mesh->read_mesh_cells("")) == true);
+    REQUIRE(mesh->ncells() == 12);
+    REQUIRE(mesh->generate_particles(0, "P3D", 1) == true);
+    REQUIRE(mesh->nparticles() == 12);
+
+    double volume = 0.;
+    mesh->iterate_over_particles(
+        [&volume](std::shared_ptr<mpm::ParticleBase<Dim>> particle) {
+          volume += particle->volume();
+        });
+    REQUIRE(volume == Approx(6.).epsilon(Tolerance));
+  }
+}
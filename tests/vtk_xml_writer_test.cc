@@ -0,0 +1,85 @@
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "vtk_xml_writer.h"
+
+// Check VTK XML writer
+TEST_CASE("VTK XML writer is checked", "[vtk][writer]") {
+  // Number of points
+  const std::size_t npoints = 3;
+  // Coordinates
+  const std::vector<double> coordinates = {0., 0., 0., 1., 0., 0., 1., 1., 0.};
+  // Fields
+  const std::vector<double> velocities = {1., 2., 3., 4., 5., 6., 7., 8., 9.};
+  const std::vector<double> mass = {1.5, 2.5, 3.5};
+  const std::vector<unsigned long long> ids = {0, 1, 2};
+  const std::vector<unsigned char> status = {1, 0, 1};
+
+  mpm::VtkXmlWriter vtk_writer(npoints, coordinates.data());
+  vtk_writer.add_point_data("velocities", 3, velocities.data());
+  vtk_writer.add_point_data("mass", 1, mass.data());
+  vtk_writer.add_point_data("id", 1, ids.data());
+  vtk_writer.add_point_data("status", 1, status.data());
+
+  // Read a file to a string
+  auto read_file = [](const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file),
+                       std::istreambuf_iterator<char>());
+  };
+
+  // Size of blocks of fields, coordinates and vertex cells with headers
+  const std::size_t nbytes =
+      (8 + npoints * 3 * 8) + (8 + npoints * 8) + (8 + npoints * 8) +
+      (8 + npoints) + (8 + npoints * 3 * 8) + 2 * (8 + npoints * 8);
+
+  // Check PolyData
+  SECTION("Check PolyData output") {
+    REQUIRE(vtk_writer.write("vtk-writer-test.vtp") == true);
+    const std::string vtp = read_file("vtk-writer-test.vtp");
+    REQUIRE(vtp.find("type=\"PolyData\"") != std::string::npos);
+    REQUIRE(vtp.find("NumberOfVerts=\"3\"") != std::string::npos);
+    REQUIRE(vtp.find("Name=\"velocities\" NumberOfComponents=\"3\"") !=
+            std::string::npos);
+    REQUIRE(vtp.find("type=\"UInt64\" Name=\"id\"") != std::string::npos);
+
+    // Appended data starts after the underscore
+    const std::size_t begin = vtp.find("_", vtp.find("<AppendedData"));
+    const std::size_t end = vtp.find("\n  </AppendedData>", begin);
+    REQUIRE(end - begin - 1 == nbytes);
+
+    // First block is the size and the data of velocities
+    uint64_t size;
+    std::copy(vtp.begin() + begin + 1, vtp.begin() + begin + 9,
+              reinterpret_cast<char*>(&size));
+    REQUIRE(size == npoints * 3 * sizeof(double));
+    double velocity;
+    std::copy(vtp.begin() + begin + 9 + 8, vtp.begin() + begin + 9 + 16,
+              reinterpret_cast<char*>(&velocity));
+    REQUIRE(velocity == Approx(2.).epsilon(1.E-12));
+  }
+
+  // Check UnstructuredGrid
+  SECTION("Check UnstructuredGrid output") {
+    REQUIRE(vtk_writer.write("vtk-writer-test.vtu") == true);
+    const std::string vtu = read_file("vtk-writer-test.vtu");
+    REQUIRE(vtu.find("type=\"UnstructuredGrid\"") != std::string::npos);
+    REQUIRE(vtu.find("NumberOfCells=\"3\"") != std::string::npos);
+    REQUIRE(vtu.find("Name=\"types\"") != std::string::npos);
+
+    const std::size_t begin = vtu.find("_", vtu.find("<AppendedData"));
+    const std::size_t end = vtu.find("\n  </AppendedData>", begin);
+    // Cell types are an additional block
+    REQUIRE(end - begin - 1 == nbytes + 8 + npoints);
+  }
+
+  // Check invalid file
+  SECTION("Check invalid file") {
+    REQUIRE(vtk_writer.write("invalid-folder/vtk-writer-test.vtp") == false);
+  }
+}